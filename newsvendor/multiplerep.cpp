@@ -167,9 +167,10 @@ int main ( int argc, char** argv )
 
    //other arrays
 
-   double *       gapest,              //gap estimate of single numCIs procedure in each replication
-          *       indivGaps;           //gap esimates for individual samples
-   int    *       indivCounts;
+   double *       gapest;              //gap estimate of single numCIs procedure in each replication
+   OverlappingBatchMeans
+                  obm( batchSize, gamma, numBatches );
+                                       //gap esimates for individual samples
 
    circ_sort      demand;
 
@@ -214,8 +215,6 @@ int main ( int argc, char** argv )
    
    demand.Initialize( batchSize );
    gapest  = new double [totssize]; 
-   indivGaps = new double[sampleSize];
-   indivCounts = new int[sampleSize];
 
    //find the location of the optimum solution 
    //in the sorted demand of the sampling problem
@@ -242,11 +241,7 @@ int main ( int argc, char** argv )
    // batchCounter and repCounter do nothing indpendent in this function.  They may need to be combined together for overlapping means
    for( repCounter = 0; repCounter < numCIs; repCounter++ )
    {
-      for( ii = 0; ii < sampleSize; ii++ )
-      {
-         indivGaps[ii] = 0.0;
-         indivCounts[ii] = 0;
-      }
+      obm.Clear();
       // We want the demands for each CI to be completely independent
       GenerateDemand( demand, batchSize, a, b, debugFile );
       for( batchCounter = 0; batchCounter < numBatches; batchCounter++ )
@@ -254,12 +249,13 @@ int main ( int argc, char** argv )
          // Was: GenerateDemand( demand, batchSize, a, b, debugFile );
          xnstar[batchCounter] = demand[discreteQuantile-1]; 
          gapest[(repCounter*numBatches)+batchCounter] = FindGapEstimate( demand, batchSize, discreteQuantile, xnstar[batchCounter], xhat, r, c, debugFile );
-         // Loop for the new Gbar setting
-         for( gammaCounter = 0; gammaCounter < batchSize; gammaCounter++ )
-         {
-            indivGaps[batchCounter*gamma + gammaCounter] += FindSampleProfit(xnstar[batchCounter],demand(gammaCounter),r,c,debugFile) - FindSampleProfit(xhat,demand(gammaCounter),r,c,debugFile);
-            indivCounts[batchCounter*gamma + gammaCounter] += 1;
-         }
+         // Loop for the new Gbar setting: only the samples near the ends of
+         // the sample need their own gaps, the gap estimate accounts for the rest
+         obm.AddBatch( batchCounter, gapest[(repCounter*numBatches)+batchCounter] );
+         for( gammaCounter = 0; gammaCounter < obm.HeadPoints( batchCounter ); gammaCounter++ )
+            obm.AddPoint( batchCounter, gammaCounter, FindSampleProfit(xnstar[batchCounter],demand(gammaCounter),r,c,debugFile) - FindSampleProfit(xhat,demand(gammaCounter),r,c,debugFile) );
+         for( gammaCounter = obm.TailStart( batchCounter ); gammaCounter < batchSize; gammaCounter++ )
+            obm.AddPoint( batchCounter, gammaCounter, FindSampleProfit(xnstar[batchCounter],demand(gammaCounter),r,c,debugFile) - FindSampleProfit(xhat,demand(gammaCounter),r,c,debugFile) );
          GenerateDemand( demand, gamma, a, b, debugFile );
 
          // --------------------------
@@ -272,13 +268,7 @@ int main ( int argc, char** argv )
       }  //end of loop with batchCounter (numBatches) 
       // Divide by the "vertical" component to get the true gap estimate
       // and finish by averaging
-      gbar[repCounter] = 0.0;
-      for( ii = 0; ii < sampleSize; ii++ )
-      {
-         indivGaps[ii] /= indivCounts[ii];
-         gbar[repCounter] += indivGaps[ii];
-      }
-      gbar[repCounter] /= sampleSize;
+      gbar[repCounter] = obm.GetMean();
 
       // GenerateDemand( demand, batchSize, a, b, debugFile );
    }  //end of for loop with numCIs
@@ -338,8 +328,6 @@ int main ( int argc, char** argv )
 
    //if (demand)  delete [] demand; 
    if (gapest)  delete [] gapest; 
-   if( indivGaps ) delete [] indivGaps; 
-   if( indivCounts ) delete [] indivCounts; 
 
    //demand  = NULL; 
    gapest  = NULL; 
@@ -699,20 +687,6 @@ double UnusedCalcVar ( double *y1, double *y2, double sum1, double sum2, int iss
 
 double CalculateVariance ( const double* y1, double ybar1, int size, int currRep, int degreesFreedom )
 {
-   int ii; 
-   double sv1, sumsquare; 
-   
-   sumsquare = 0.0; 
-
-   for( ii = 0; ii < size; ii++ )
-   {
-      // Change currRed*size to reflect overlapping batches.  I think currRep*gamma + ii should do it.
-      sv1 = y1[(currRep*size)+ii] - ybar1; 
-      sumsquare += pow(sv1,2);
-   }
-
-   sumsquare *= ( 1.0 / (double) degreesFreedom);
-
-   return sumsquare;    
+   return OverlappingBatchMeans::Variance( y1 + currRep*size, size, ybar1, degreesFreedom );
 } // end of CalculateVariance 
 
@@ -7,6 +7,7 @@
 #include <unistd.h>
 #include <string>
 #include "circ_sort.h"
+#include "obm_stat.h"
 
 using namespace std;
 using std::string;
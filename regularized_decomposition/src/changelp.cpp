@@ -14,7 +14,7 @@ SOURCE FILE NAME:	changelp.cpp
 CREATED:			1995.12.27
 LAST MODIFIED:		1996.04.09
 
-DEPENDENCIES:		stdtype.h, smartptr.h, changelp.h
+DEPENDENCIES:		stdtype.h, smartptr.h, changelp.h, mps_out.h
 					<assert.h>
 
 --------------------------------------------------------------------------------
@@ -30,6 +30,9 @@ SOURCE FILE CONTENTS:
 #ifndef __CHANGELP_H__
 #	include "changelp.h"
 #endif
+#ifndef __MPS_OUT_H__
+#	include "mps_out.h"
+#endif
 
 
 /*------------------------------------------------------------------------------
@@ -186,71 +189,57 @@ void ChangeMatrix::Permute( const Array<Int_T> &RowNum, // )
 
 /*------------------------------------------------------------------------------
 
-	virtual Bool_T ChangeCost::Write( FILE *fp, Int_T sc, Real_T prob ) const
-	virtual Bool_T ChangeRHS::Write( FILE *fp, Int_T sc, Real_T ) const
-	virtual Bool_T ChangeLoBND::Write( FILE *fp, Int_T sc, Real_T ) const
-	virtual Bool_T ChangeUpBND::Write( FILE *fp, Int_T sc, Real_T ) const
-	virtual Bool_T ChangeMatrix::Write( FILE *fp, Int_T sc, Real_T ) const
+	virtual void ChangeCost::Write( MPS_Output &Out, Int_T sc, Real_T prob )
+		const
+	virtual void ChangeRHS::Write( MPS_Output &Out, Int_T sc, Real_T ) const
+	virtual void ChangeLoBND::Write( MPS_Output &Out, Int_T sc, Real_T ) const
+	virtual void ChangeUpBND::Write( MPS_Output &Out, Int_T sc, Real_T ) const
+	virtual void ChangeMatrix::Write( MPS_Output &Out, Int_T sc, Real_T ) const
 
 PURPOSE:
 	Write a stochastic data file entry
 
 PARAMETERS:
-	FILE *fp, Int_T sc, Real_T prob
+	MPS_Output &Out, Int_T sc, Real_T prob
 
 RETURN VALUE:
-	Boolean success status.
+	None (output errors are reported by "MPS_Output::Flush()").
 
 SIDE EFFECTS:
 	None.
 
 ------------------------------------------------------------------------------*/
 
-Bool_T ChangeCost::Write( FILE *fp, Int_T sc, Real_T prob )
+void ChangeCost::Write( MPS_Output &Out, Int_T sc, Real_T prob )
 const
 {
-	assert( fp != NULL );
-
-	if( fprintf( fp, "    %-8s  %-8s  %12G\n",
-		MakeLabel( col, sc ), "COST", prob * value ) == EOF )
-		return False;
-
-	return True;
+	Out.Entry( "    ", MakeLabel( col, sc ), "COST", prob * value );
 }
 
 
-Bool_T ChangeRHS::Write( FILE *fp, Int_T sc, Real_T )
+void ChangeRHS::Write( MPS_Output &Out, Int_T sc, Real_T )
 const
 {
-	assert( fp != NULL );
-
-	if( fprintf( fp, "    %-8s  %-8s  %12G\n",
-		"RHS", MakeLabel( row, sc ), value ) == EOF )
-		return False;
-
-	return True;
+	Out.Entry( "    ", "RHS", MakeLabel( row, sc ), value );
 }
 
 
-Bool_T ChangeLoBND::Write( FILE *, Int_T, Real_T )
+void ChangeLoBND::Write( MPS_Output &, Int_T, Real_T )
 const
 {
 	abort();
-	return True;
 }
 
 
-Bool_T ChangeUpBND::Write( FILE *, Int_T, Real_T )
+void ChangeUpBND::Write( MPS_Output &, Int_T, Real_T )
 const
 {
 	abort();
-	return True;
 }
 
 
-Bool_T ChangeMatrix::Write( FILE *, Int_T, Real_T )
+void ChangeMatrix::Write( MPS_Output &, Int_T, Real_T )
 const
 {
 	abort();
-	return True;
 }
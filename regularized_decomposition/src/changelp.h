@@ -37,6 +37,8 @@ HEADER CONTENTS:
 #	include "mps_lp.h"
 #endif
 
+class MPS_Output;
+
 //==============================================================================
 //	Type definitions for scenario list elements. A two level hierarchy of
 //	objects is created with "changeLP" as a common abstract base class.
@@ -66,7 +68,7 @@ public:
 	virtual void Permute( const Array<Int_T> &RowNum,
 		const Array<Int_T> &ColNum ) pure;
 
-	virtual Bool_T Write( FILE *fp, Int_T sc, Real_T prob ) const pure;
+	virtual void Write( MPS_Output &Out, Int_T sc, Real_T prob ) const pure;
 };
 
 
@@ -89,7 +91,7 @@ public:
 
 	virtual void Permute( const Array<Int_T> &, const Array<Int_T> &ColNum );
 
-	virtual Bool_T Write( FILE *fp, Int_T sc, Real_T prob ) const;
+	virtual void Write( MPS_Output &Out, Int_T sc, Real_T prob ) const;
 };
 
 
@@ -112,7 +114,7 @@ public:
 
 	virtual void Permute( const Array<Int_T> &RowNum, const Array<Int_T> & );
 
-	virtual Bool_T Write( FILE *fp, Int_T sc, Real_T ) const;
+	virtual void Write( MPS_Output &Out, Int_T sc, Real_T ) const;
 };
 
 
@@ -135,7 +137,7 @@ public:
 
 	virtual void Permute( const Array<Int_T> &, const Array<Int_T> &ColNum );
 
-	virtual Bool_T Write( FILE *fp, Int_T sc, Real_T ) const;
+	virtual void Write( MPS_Output &Out, Int_T sc, Real_T ) const;
 };
 
 
@@ -158,7 +160,7 @@ public:
 
 	virtual void Permute( const Array<Int_T> &, const Array<Int_T> &ColNum );
 
-	virtual Bool_T Write( FILE *fp, Int_T sc, Real_T ) const;
+	virtual void Write( MPS_Output &Out, Int_T sc, Real_T ) const;
 };
 
 
@@ -182,7 +184,7 @@ public:
 	virtual void Permute( const Array<Int_T> &RowNum,
 		const Array<Int_T> &ColNum );
 
-	virtual Bool_T Write( FILE *fp, Int_T sc, Real_T ) const;
+	virtual void Write( MPS_Output &Out, Int_T sc, Real_T ) const;
 };
 
 //
@@ -0,0 +1,245 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		General purpose mathematical module.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE NAME:	distcomp.cpp
+CREATED:			2026.10.19
+LAST MODIFIED:		2026.10.19
+
+DEPENDENCIES:		distcomp.h, stdtype.h
+					<stdio.h>, <stdlib.h>, <math.h>, <assert.h>
+					<unistd.h>, <sys/types.h>, <sys/wait.h>, <sys/mman.h>
+					(UNIX only)
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE CONTENTS:
+	Distances of the dense scenario data vectors and the parallel execution of
+independent pieces of work (see "distcomp.h").
+
+--------------------------------------------------------------------------------
+
+PUBLIC INTERFACE:
+	Real_T L1_Distance( const Real_T *a, const Real_T *b, Int_T d )
+	void *AllocShared( size_t Size, Int_T Procs )
+	void FreeShared( void *p, size_t Size, Int_T Procs )
+	void RunInParallel( ParallelTask Task, void *Data, Int_T Procs )
+
+--------------------------------------------------------------------------------
+
+USED MACROS AND THEIR MEANING:
+	SUPPORT_PARALLEL_WORK	- defined (below) on systems with "fork()" and
+							"mmap()"; all the work is done by one process on
+							other systems.
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+
+#if defined( unix ) || defined( __unix ) || defined( __unix__ )
+#	define SUPPORT_PARALLEL_WORK
+#	include <unistd.h>
+#	include <sys/types.h>
+#	include <sys/wait.h>
+#	include <sys/mman.h>
+#endif
+
+#ifndef __DISTCOMP_H__
+#	include "distcomp.h"
+#endif
+
+
+/*------------------------------------------------------------------------------
+
+	Real_T L1_Distance( const Real_T *a, const Real_T *b, Int_T d )
+
+PURPOSE:
+	Computes the sum of absolute differences of two vectors of length "d".
+Four partial sums are kept, so that the additions do not wait for one another
+(and the compiler may use vector instructions).
+
+PARAMETERS:
+	const Real_T *a, const Real_T *b, Int_T d
+		The vectors and their length.
+
+RETURN VALUE:
+	The distance.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Real_T L1_Distance( const Real_T *a, const Real_T *b, Int_T d )
+{
+	Real_T s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+	Int_T k;
+
+	for( k = 0; k + 4 <= d; k += 4 )
+	{
+		s0 += fabs( a[k]   - b[k]   );
+		s1 += fabs( a[k+1] - b[k+1] );
+		s2 += fabs( a[k+2] - b[k+2] );
+		s3 += fabs( a[k+3] - b[k+3] );
+	}
+	for( ; k < d; k++ )
+		s0 += fabs( a[k] - b[k] );
+
+	return ( s0 + s1 ) + ( s2 + s3 );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void *AllocShared( size_t Size, Int_T Procs )
+	void FreeShared( void *p, size_t Size, Int_T Procs )
+
+PURPOSE:
+	Allocate and free a block of memory for the results of the work done by
+"Procs" processes (see "RunInParallel()"). With "Procs > 1" (and where it is
+supported) the memory is shared by the parent and its child processes. It is
+an ordinary heap block otherwise.
+
+PARAMETERS:
+	size_t Size
+		Size of the block in bytes.
+
+	Int_T Procs
+		Number of processes (the same for both functions).
+
+	void *p
+		The block.
+
+RETURN VALUE:
+	The block (or NULL, if it could not be allocated).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void *AllocShared( size_t Size, Int_T Procs )
+{
+	if( Size == 0 ) Size = 1;
+
+#if defined( SUPPORT_PARALLEL_WORK )
+	if( Procs > 1 )
+	{
+		void *p = mmap( NULL, Size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0 );
+
+		return ( p == MAP_FAILED ) ? NULL : p;
+	}
+#else
+	(void) Procs;
+#endif
+
+	return malloc( Size );
+}
+
+
+void FreeShared( void *p, size_t Size, Int_T Procs )
+{
+	if( p == NULL ) return;
+	if( Size == 0 ) Size = 1;
+
+#if defined( SUPPORT_PARALLEL_WORK )
+	if( Procs > 1 )
+	{
+		munmap( p, Size );
+		return;
+	}
+#else
+	(void) Size;
+	(void) Procs;
+#endif
+
+	free( p );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void RunInParallel( ParallelTask Task, void *Data, Int_T Procs )
+
+PURPOSE:
+	Does a piece of work by "Procs" processes. With "Procs > 1" (and where it
+is supported) "Procs - 1" child processes are started; child "i" calls
+"Task( Data, i, Procs )", while the parent calls "Task( Data, 0, Procs )" (the
+items are interleaved, so that all processes have about the same work). Should
+a child fail, its part of the work is done by the parent. Otherwise the parent
+does all the work.
+	The children see the data as they were at the moment of the call. The only
+results visible to the parent are those stored in the memory obtained from
+"AllocShared()" with the same "Procs".
+
+PARAMETERS:
+	ParallelTask Task, void *Data
+		The work and its data.
+
+	Int_T Procs
+		Number of processes.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void RunInParallel( ParallelTask Task, void *Data, Int_T Procs )
+{
+	assert( Task != NULL );
+
+#if defined( SUPPORT_PARALLEL_WORK )
+	if( Procs > 1 )
+	{
+		//----------------------------------------------------------------------
+		//	Start the children. Output buffers are flushed first, so that they
+		//	are not written twice. A child terminates with "_exit()".
+		//
+		pid_t *Child = new pid_t[ Procs ];
+		Int_T i;
+
+		fflush( stdout );
+		fflush( stderr );
+
+		for( i = 1; i < Procs; i++ )
+			if( ( Child[i] = fork() ) == 0 )
+			{
+				Task( Data, i, Procs );
+				_exit( 0 );
+			}
+
+		Task( Data, 0, Procs );
+
+		for( i = 1; i < Procs; i++ )
+		{
+			int Status;
+
+			if( Child[i] < 0 || waitpid( Child[i], &Status, 0 ) != Child[i] ||
+				!WIFEXITED( Status ) || WEXITSTATUS( Status ) != 0 )
+				Task( Data, i, Procs );
+		}
+
+		delete [] Child;
+		return;
+	}
+#else
+	(void) Procs;
+#endif
+
+	Task( Data, 0, 1 );
+}
@@ -0,0 +1,60 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		General purpose mathematical module.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+HEADER FILE NAME:	distcomp.h
+CREATED:			2026.10.19
+LAST MODIFIED:		2026.10.19
+
+DEPENDENCIES:		stdtype.h
+					<stddef.h>
+
+--------------------------------------------------------------------------------
+
+HEADER CONTENTS:
+	Tools for the computations on the scenario data in the dense (flattened)
+form, shared by the scenario reduction (see "scenred.cpp") and the scenario
+tree construction (see "scentree.cpp"): the distance of two data vectors and
+a simple way of doing independent pieces of work in several processes. The
+results of such work have to be stored in memory obtained from
+"AllocShared()", so that the parent process sees them.
+
+------------------------------------------------------------------------------*/
+
+#ifndef __DISTCOMP_H__
+#define __DISTCOMP_H__
+
+#include <stddef.h>
+
+#ifndef __STDTYPE_H__
+#	include "stdtype.h"
+#endif
+
+
+//==============================================================================
+//
+//	Function prototypes.
+//
+//==============================================================================
+
+Real_T L1_Distance( const Real_T *a, const Real_T *b, Int_T d );
+
+//
+//	A piece of work "Task( Data, First, Step )" should do the items "First",
+//	"First + Step", ... of the work.
+//
+typedef void (*ParallelTask)( void *Data, Int_T First, Int_T Step );
+
+void *AllocShared( size_t Size, Int_T Procs );
+void FreeShared( void *p, size_t Size, Int_T Procs );
+void RunInParallel( ParallelTask Task, void *Data, Int_T Procs );
+
+#endif
@@ -959,7 +959,7 @@ Beginning:
 	//--------------------------------------------------------------------------
 	//	Finally display a newline (if fp != NULL).
 	//
-	if( fp ) IO_status = vfprintf( fp, "\n", NULL );
+	if( fp ) IO_status = fputs( "\n", fp );
 
 	//--------------------------------------------------------------------------
 	//	See if output succeeded.
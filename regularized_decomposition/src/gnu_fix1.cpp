@@ -68,6 +68,10 @@ template class SmartPointerBase<unsigned int>;
 template class Array<unsigned int>;
 template class Ptr<unsigned int>;
 
+template class SmartPointerBase<unsigned char>;
+template class Array<unsigned char>;
+template class Ptr<unsigned char>;
+
 //------------------------------------------------------------------------------
 //	File "std_tmpl.h" templates' instatiations.
 //
@@ -101,6 +105,10 @@ template unsigned int *MALLOC( unsigned int *& Table, size_t len );
 template unsigned int *REALLOC( unsigned int *& Table, size_t len );
 template void FREE( unsigned int *& Table );
 
+template unsigned char *MALLOC( unsigned char *& Table, size_t len );
+template unsigned char *REALLOC( unsigned char *& Table, size_t len );
+template void FREE( unsigned char *& Table );
+
 template void FREE( char *& Table );
 
 //------------------------------------------------------------------------------
@@ -28,6 +28,17 @@ template Delta **MALLOC( Delta **& Table, size_t len );
 template Delta **REALLOC( Delta **& Table, size_t len );
 template void FREE( Delta **& Table );
 
+//
+//	Array<Delta>
+//
+template class SmartPointerBase<Delta>;
+template class Array<Delta>;
+template class Ptr<Delta>;
+
+template Delta *MALLOC( Delta *& Table, size_t len );
+template Delta *REALLOC( Delta *& Table, size_t len );
+template void FREE( Delta *& Table );
+
 //
 //	Array<Distribution *>
 //
@@ -52,6 +63,17 @@ template StochasticDataBlock **REALLOC( StochasticDataBlock **& Table,
 	size_t len );
 template void FREE( StochasticDataBlock **& Table );
 
+//
+//	Array<IndepStochVar *>
+//
+template class SmartPointerBase<IndepStochVar *>;
+template class Array<IndepStochVar *>;
+template class Ptr<IndepStochVar *>;
+
+template IndepStochVar **MALLOC( IndepStochVar **& Table, size_t len );
+template IndepStochVar **REALLOC( IndepStochVar **& Table, size_t len );
+template void FREE( IndepStochVar **& Table );
+
 //
 //	Array<Scenario *>
 //
@@ -13,8 +13,8 @@ SOURCE FILE NAME:	lexer.cpp
 CREATED:			1993.10.10
 LAST MODIFIED:		1995.10.23
 
-DEPENDENCIES:		compile.h, error.h, stdtype.h, lexer.h, mps_lp.h
-					<stdio.h>, <ctype.h>, <stdlib.h>, <assert.h>
+DEPENDENCIES:		compile.h, error.h, stdtype.h, lexer.h, mps_lp.h, myalloc.h
+					<stdio.h>, <ctype.h>, <stdlib.h>, <string.h>, <assert.h>
 
 --------------------------------------------------------------------------------
 
@@ -52,17 +52,29 @@ ignored; no warnings are issued.
 analysis and processing much faster. This is the list of those assumptions and
 their consequences:
 
-*	Input is divided into lines of text. It is read one text line at a time.
-	We only need an input buffer capable to hold one line of text. We never have
-	to re-read a line of input. In worst case we may sometimes have to go back
-	a couple of characters in the current line - a single buffer pointer will
-	be capable of holding all information for this limited backtracking.
+*	Input is divided into lines of text. It is read in large blocks, and the
+	lines are handed out one at a time directly from the block buffer (the
+	newline character is followed by a NULL written over the first character of
+	the next line; the character is restored when the next line is fetched).
+	The buffer grows when a line does not fit, so line length is not limited.
+	We never have to re-read a line of input. In worst case we may sometimes
+	have to go back a couple of characters in the current line - a single
+	buffer pointer will be capable of holding all information for this limited
+	backtracking.
+*	Numeric constants are converted directly from the buffer. Mantissas of up
+	to 15 significant digits with small decimal exponents are converted exactly
+	(and correctly rounded) with a single multiplication or division; all
+	others are passed to the standard "strtod" function.
+*	All lexer data are held in an object, so several files may be read at the
+	same time.
 *	In case of an error we ignore the rest of current line and proceed. This
 	almost substitutes for intelligent error analysis and recovery.
 
 --------------------------------------------------------------------------------
 
 PUBLIC INTERFACE:
+	Lexer::Lexer( void )
+	Lexer::~Lexer( void )
 	void Lexer::SetInputStream( const char *name, FILE *fp )
 	Bool_T Lexer::GetSpace( void )
 	Bool_T Lexer::GetKeyword( const char *Keyword,
@@ -77,6 +89,7 @@ PUBLIC INTERFACE:
 #include <stdio.h>
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 #ifndef __ERROR_H__
@@ -95,51 +108,26 @@ PUBLIC INTERFACE:
 #ifndef __LEXER_H__
 #	include "lexer.h"
 #endif
+#ifndef __MYALLOC_H__
+#	include "myalloc.h"
+#endif
 
 //==============================================================================
 //
-//	Static "Lexer" class data (both private and public).
+//	Static "Lexer" class data.
 //
 //==============================================================================
 
-//------------------------------------------------------------------------------
-//	Input stream descriptor pointer (as passed through "SetInputStream" call).
-//
-FILE *Lexer::Input;
-
-//------------------------------------------------------------------------------
-//	These four data store information concerning the input stream: stream
-//	descriptor pointer, filename (as passed through "SetInputStream" call)
-//	which may be used when issuing error messages, current line number (also
-//	for use by error message output) and finally file type (binary or MPS).
-//
-char Lexer::FileName[ Lexer::IO_BUF_LEN ];
-int Lexer::LineNumber;
-
-//------------------------------------------------------------------------------
-//	This value will be NULL whenever IO error will occur. Function "GetNewline"
-//	which is responsible for reading in new input lines uses ANSI C function
-//	"fgets", which returns a NULL pointer on error. The value returned by
-//	"fgets" is stored in this variable.
-//
-void *Lexer::IO_OK;
-
-//------------------------------------------------------------------------------
-//	This is file input buffer together with a pointer to current buffer
-//	position (the next character to read). The buffer holds one line of input.
-//
-char Lexer::Buf[ Lexer::IO_BUF_LEN ];
-char *Lexer::BufPtr;
+const char Lexer::EmptyString[1] = { '\0' };
 
 //------------------------------------------------------------------------------
-//	Values of lexical symbols: numeric constant (stored as double), type of
-//	constraint matrix row, type of variable and pointers to labels. The
-//	constraint and variable types are stored using symbolic values defined in
-//	header "lp_codes.h".
+//	Exact powers of ten (used for fast conversion of numeric constants).
 //
-double Lexer::Number;
-char *Lexer::LabelPtr[2];
-const char Lexer::EmptyString[1] = { '\0' };
+static const double Pow10[] = {
+	1e0,	1e1,	1e2,	1e3,	1e4,	1e5,	1e6,	1e7,
+	1e8,	1e9,	1e10,	1e11,	1e12,	1e13,	1e14,	1e15,
+	1e16,	1e17,	1e18,	1e19,	1e20,	1e21,	1e22
+	};
 
 //==============================================================================
 //
@@ -154,6 +142,47 @@ const char Lexer::EmptyString[1] = { '\0' };
 //
 //==============================================================================
 
+/*------------------------------------------------------------------------------
+
+	Lexer::Lexer( void )
+	Lexer::~Lexer( void )
+
+PURPOSE:
+	Constructor creates an object not attached to any input stream (see
+"SetInputStream()"). Destructor frees the input buffer.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Lexer::Lexer( void )
+	: Input( NULL ), Block( NULL ), BlockLen( 0 ), DataLen( 0 ), LineEnd( 0 ),
+	SaveChar( '\0' ), EndOfInput( True ), LineNumber( 0 ), IO_OK( False ),
+	Buf( NULL ), BufPtr( NULL ), BufEnd( NULL ), Number( 0.0 )
+{
+	*FileName		= '\0';
+	EmptyLine[0]	= '\n';
+	EmptyLine[1]	= '\0';
+	Buf = BufPtr	= EmptyLine;
+	BufEnd			= EmptyLine + 1;
+	LabelPtr[ 0 ]	=
+	LabelPtr[ 1 ]	= NULL;
+}
+
+
+Lexer::~Lexer( void )
+{
+	FREE( Block );
+}
+
+
 /*------------------------------------------------------------------------------
 
 	void Lexer::SetInputStream( const char *name, FILE *fp )
@@ -176,8 +205,9 @@ RETURN VALUE:
 	None.
 
 SIDE EFFECTS:
-	Clears all static data and then stores in it both input file name and input
+	Clears all object data and then stores in it both input file name and input
 stream descriptor. Also reads the first line and places it in the input buffer.
+The input buffer is allocated (or reused, if the object was used before).
 
 ------------------------------------------------------------------------------*/
 
@@ -187,14 +217,25 @@ void Lexer::SetInputStream( const char *name, FILE *fp )
 	assert( fp != NULL );
 
 	//--------------------------------------------------------------------------
-	//	Erase all static data.
+	//	Erase all object data.
 	//
 	Input			= NULL;
 	*FileName		= '\0';
 	LineNumber		= 0;
-	IO_OK			= (void *)1;
-	*Buf			= '\0';
-	BufPtr			= Buf;
+	IO_OK			= True;
+	EmptyLine[0]	= '\n';
+	EmptyLine[1]	= '\0';
+	Buf = BufPtr	= EmptyLine;
+	BufEnd			= EmptyLine + 1;
+
+	if( Block == NULL )
+	{
+		BlockLen = BLOCK_LEN;
+		MALLOC( Block, BlockLen + 1 );
+	}
+	DataLen = LineEnd = 0;
+	SaveChar		= '\0';
+	EndOfInput		= False;
 
 	Number			= 0.0e0;
 	LabelPtr[ 0 ]	=
@@ -203,9 +244,8 @@ void Lexer::SetInputStream( const char *name, FILE *fp )
 	//--------------------------------------------------------------------------
 	//	Copy the name of the input file.
 	//
-	char *c = FileName;
-	while( ( *c++ = *name++ ) != 0 )
-		;
+	strncpy( FileName, name, IO_BUF_LEN - 1 );
+	FileName[ IO_BUF_LEN - 1 ] = '\0';
 
 	//--------------------------------------------------------------------------
 	//	Check and initialize the stream (read the first line).
@@ -366,6 +406,15 @@ Bool_T Lexer::GetLabelFixed( int lbl, int StartCol, int EndCol )
 	assert( lbl >= 0 && lbl <= 1 && StartCol >= 0 && StartCol <= EndCol &&
 		EndCol <= 71 );
 
+	//--------------------------------------------------------------------------
+	//	Columns behind the end of the line are empty. (The length is not taken
+	//	from "strlen()", since labels read earlier are NULL-terminated in place.)
+	//
+	int LineLen = (int)( BufEnd - Buf );
+
+	if( StartCol > LineLen ) StartCol = LineLen;
+	if( EndCol >= LineLen ) EndCol = LineLen - 1;
+
 	char *_BufPtr = BufPtr = Buf + StartCol;
 	int i, len = EndCol - StartCol + 1;
 
@@ -386,7 +435,7 @@ Bool_T Lexer::GetLabelFixed( int lbl, int StartCol, int EndCol )
 	//--------------------------------------------------------------------------
 	//	Scan backwards to remove any trailing spaces.
 	//
-	while( *( _BufPtr - 1 ) == ' ' && _BufPtr > BufPtr )
+	while( _BufPtr > BufPtr && *( _BufPtr - 1 ) == ' ' )
 		_BufPtr--;
 
 	if( _BufPtr - BufPtr == 0 )				// Only spaces - no label found.
@@ -415,8 +464,8 @@ PURPOSE:
 
 where at least one digit (or decimal point) in whole is required in mantissa and
 in exponent.  After the numeric constant is successfully parsed, it is
-converted into a double (using ANSI C "atof()" function) and stored in a static
-variable "Number". Length and precision of the constant is not checked.
+converted into a double (see "Lexer::ToDouble()") and stored in the data member
+"Number". Length and precision of the constant is not checked.
 
 PARAMETERS:
 	None.
@@ -433,7 +482,6 @@ character thet may possibly belong to the nuumertic constant.
 Bool_T Lexer::GetNumeric( void )
 {
 	char *_BufPtr = BufPtr;
-	char SaveChar;
 	Bool_T DigitInMantissa = False;
 
 	const char *Messages[] = {
@@ -482,10 +530,7 @@ Bool_T Lexer::GetNumeric( void )
 		} while( isdigit( *_BufPtr ) );
 	}
 
-	SaveChar = *_BufPtr;
-	*_BufPtr = '\0';
-	Number = atof( BufPtr );
-	*_BufPtr = SaveChar;
+	Number = ToDouble( BufPtr, _BufPtr );
 
 //success:
 	BufPtr = _BufPtr;
@@ -507,8 +552,8 @@ PURPOSE:
 accepts spaces and tabs on the way. When a newline character is found, new
 input line is fetched from the stream and placed in the buffer. Comment lines
 (beginning with '*' character in the first column are skipped.
-	Static buffer is filled with new line data (if one is read) and the buffer
-pointer is set to the first position in buffer.
+	"Buf" is set to point to the new line (if one is read) and the buffer
+pointer is set to the first position in it.
 
 PARAMETERS:
 	Bool_T Force
@@ -518,12 +563,12 @@ PARAMETERS:
 RETURN VALUE:
 	Boolean success status. If "Force" is "True", failure means an I/O error.
 Otherwise it may either be that, or some non-spae characters were encountered
-before a newline was found. Also when the line is not terminated with a newline
-(i.e. input line is too long to hold it in the buffer) "False" is returned.
+before a newline was found.
 
 SIDE EFFECTS:
-	If a new line is fetched, the buffer is filled with new line data and
-the buffer pointer is set to the first position in buffer.
+	If a new line is fetched, "Buf" points to the new line data and the buffer
+pointer is set to the first position in it. Labels found in the previous line
+are no longer valid.
 
 ------------------------------------------------------------------------------*/
 
@@ -553,17 +598,18 @@ Bool_T Lexer::GetNewline( Bool_T Force )
 	{
 		do							// Skip comment lines or empty lines
 		{
-			_BufPtr = Buf;			// Reset global buffer pointer.
-			IO_OK = fgets( Buf, IO_BUF_LEN, Input );
+			IO_OK = FetchLine();
 			if( ! IO_OK )
 			{
-				BufPtr = Buf;
-				Buf[0] = '\n';
-				Buf[1] = '\0';
+				EmptyLine[0] = '\n';
+				EmptyLine[1] = '\0';
+				BufPtr = Buf = EmptyLine;
+				BufEnd = EmptyLine + 1;
 				goto error;
 			}
 			else
 				LineNumber++;
+			_BufPtr = Buf;			// Reset buffer pointer.
 		} while( *_BufPtr == '*' || *_BufPtr == '\n' );
 									// Also skip lines that contain only
 									// whitespace characters.
@@ -578,3 +624,187 @@ Bool_T Lexer::GetNewline( Bool_T Force )
 error:
 	return False;
 }
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T Lexer::FetchLine( void )
+
+PURPOSE:
+	Makes the next line of input the current one ("Buf"). The line is found in
+the block buffer. If the buffer holds no complete line, the incomplete one is
+moved to the beginning of the buffer and the rest of the buffer is filled with
+data from the input stream. If the line is longer than the buffer, the buffer
+is enlarged. The line (together with its newline character, if any) is
+terminated with a NULL. The character overwritten with it is restored on the
+next call.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	"False" at the end of input or on I/O error, "True" otherwise.
+
+SIDE EFFECTS:
+	May read data from the input stream and reallocate the buffer.
+
+------------------------------------------------------------------------------*/
+
+Bool_T Lexer::FetchLine( void )
+{
+	if( Input == NULL || Block == NULL ) return False;
+
+	Block[ LineEnd ] = SaveChar;
+
+	size_t Start = LineEnd, Scanned = LineEnd;
+	char *nl;
+
+	while( ( nl = (char *) memchr( Block + Scanned, '\n', DataLen - Scanned ) )
+		== NULL )
+	{
+		//----------------------------------------------------------------------
+		//	The last line of input need not end with a newline.
+		//
+		if( EndOfInput )
+		{
+			if( Start == DataLen ) return False;
+
+			LineEnd			= DataLen;
+			SaveChar		= '\0';
+			Block[ DataLen ]= '\0';
+			Buf				= Block + Start;
+			BufEnd			= Block + LineEnd;
+			return True;
+		}
+
+		//----------------------------------------------------------------------
+		//	Move the incomplete line to the front of the buffer. Enlarge the
+		//	buffer if the line fills it. Read more data.
+		//
+		if( Start > 0 )
+		{
+			memmove( Block, Block + Start, DataLen - Start );
+			DataLen -= Start;
+			Start = 0;
+		}
+		else if( DataLen == BlockLen )
+		{
+			BlockLen *= 2;
+			REALLOC( Block, BlockLen + 1 );
+		}
+		Scanned = DataLen;
+
+		size_t len = fread( Block + DataLen, 1, BlockLen - DataLen, Input );
+
+		if( len == 0 )
+		{
+			if( ferror( Input ) ) return False;
+			EndOfInput = True;
+		}
+		DataLen += len;
+	}
+
+	LineEnd				= (size_t)( nl - Block ) + 1;
+	SaveChar			= Block[ LineEnd ];
+	Block[ LineEnd ]	= '\0';
+	Buf					= Block + Start;
+	BufEnd				= Block + LineEnd;
+
+	return True;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	double Lexer::ToDouble( const char *Start, char *End )
+
+PURPOSE:
+	Converts a numeric constant (already checked by "GetNumeric()") into a
+double. If the mantissa has no more than 15 significant digits and the decimal
+exponent (after shifting the decimal point to the end of the mantissa) is within
+[-22,22], both the mantissa and the power of ten are exact doubles and the
+result is obtained with a single, correctly rounded multiplication or division.
+Otherwise (rarely) the standard "strtod" function is used.
+
+PARAMETERS:
+	const char *Start, char *End
+		The constant occupies the characters from "Start" up to (but not
+		including) "End". The character at "End" is temporarily overwritten
+		when "strtod" is called.
+
+RETURN VALUE:
+	The value of the constant.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+double Lexer::ToDouble( const char *Start, char *End )
+{
+	const char *c = Start;
+	Bool_T Negative = False;
+
+	if( *c == '+' || *c == '-' )
+	{
+		Negative = ( *c == '-' ) ? True : False;
+		for( c++; *c == ' ' || *c == '\t'; c++ )
+			;
+	}
+
+	const char *Unsigned = c;
+	double Mantissa = 0.0;
+	int Digits = 0, Exponent = 0;
+
+	for( ; c < End && isdigit( *c ); c++ )
+		if( Digits > 0 || *c != '0' )
+		{
+			Mantissa = Mantissa * 10.0 + ( *c - '0' );
+			Digits++;
+		}
+
+	if( c < End && *c == '.' )
+		for( c++; c < End && isdigit( *c ); c++ )
+		{
+			if( Digits > 0 || *c != '0' )
+			{
+				Mantissa = Mantissa * 10.0 + ( *c - '0' );
+				Digits++;
+			}
+			Exponent--;
+		}
+
+	if( c < End && ( *c == 'E' || *c == 'e' ) )
+	{
+		Bool_T NegExp = False;
+		int e = 0;
+
+		c++;
+		if( *c == '+' || *c == '-' )
+			NegExp = ( *c++ == '-' ) ? True : False;
+		for( ; c < End && isdigit( *c ) && e < 10000; c++ )
+			e = 10 * e + ( *c - '0' );
+		Exponent += NegExp ? -e : e;
+	}
+
+	//--------------------------------------------------------------------------
+	//	The exact (fast) case and the general case.
+	//
+	if( Digits <= 15 && Exponent >= -22 && Exponent <= 22 )
+	{
+		if( Exponent >= 0 )
+			Mantissa *= Pow10[ Exponent ];
+		else
+			Mantissa /= Pow10[ -Exponent ];
+	}
+	else
+	{
+		char Save = *End;
+
+		*End = '\0';
+		Mantissa = strtod( Unsigned, NULL );
+		*End = Save;
+	}
+
+	return Negative ? -Mantissa : Mantissa;
+}
@@ -19,7 +19,9 @@ DEPENDENCIES:		stdtype.h,
 --------------------------------------------------------------------------------
 
 HEADER CONTENTS:
-	x
+	Declaration of the lexical analyser class "Lexer". Each object reads one
+input stream, so several files may be parsed at the same time (each by its own
+object).
 
 ------------------------------------------------------------------------------*/
 
@@ -27,6 +29,7 @@ HEADER CONTENTS:
 #define __LEXER_H__
 
 #include <stdio.h>
+#include <stddef.h>
 
 #ifndef __STDTYPE_H__
 #	include "stdtype.h"
@@ -41,30 +44,51 @@ HEADER CONTENTS:
 class Lexer
 {
 private:
-	static FILE *Input;
+	FILE *Input;
+
+	char *Block;			// Input buffer: holds the current line and possibly
+							// some of the following ones.
+	size_t BlockLen,		// Allocated size of the buffer (minus one).
+		DataLen,			// Number of characters read into the buffer.
+		LineEnd;			// Position of the first character behind the
+							// current line.
+	char SaveChar;			// Character overwritten by the terminating NULL.
+	Bool_T EndOfInput;
+	char EmptyLine[2];		// A line presented at the end of input.
+
+	Bool_T FetchLine( void );
+
+	Lexer( const Lexer & );				// Not allowed: the buffer is owned
+	Lexer &operator=( const Lexer & );	// by the object.
+
+	static double ToDouble( const char *Start, char *End );
 
 public:
-	enum { IO_BUF_LEN = 512 };
-
-	static char FileName[ IO_BUF_LEN ];
-	static int LineNumber;
-	static void *IO_OK;
-	static char Buf[ IO_BUF_LEN ];
-	static char *BufPtr;
-	static double Number;
-	static char *LabelPtr[2];
+	enum { IO_BUF_LEN = 512, BLOCK_LEN = 64 * 1024 };
+
+	char FileName[ IO_BUF_LEN ];
+	int LineNumber;
+	Bool_T IO_OK;
+	char *Buf;				// The current line (a NULL-terminated string).
+	char *BufPtr;			// The next character to read in the current line.
+	char *BufEnd;			// The NULL terminating the current line.
+	double Number;
+	char *LabelPtr[2];
 	static const char EmptyString[1];
 
 public:
-	static void SetInputStream( const char *name, FILE *fp );
+	Lexer( void );
+	~Lexer( void );
+
+	void SetInputStream( const char *name, FILE *fp );
 
-	static Bool_T GetSpace( void );
-	static Bool_T GetKeyword( const char *Keyword,
+	Bool_T GetSpace( void );
+	Bool_T GetKeyword( const char *Keyword,
 		Bool_T CaseSensitive = False );
-	static Bool_T GetLabelFree( int lbl, int = 0, int = 0 );
-	static Bool_T GetLabelFixed( int lbl, int StartCol, int EndCol );
-	static Bool_T GetNumeric( void );
-	static Bool_T GetNewline( Bool_T Force = False );
+	Bool_T GetLabelFree( int lbl, int = 0, int = 0 );
+	Bool_T GetLabelFixed( int lbl, int StartCol, int EndCol );
+	Bool_T GetNumeric( void );
+	Bool_T GetNewline( Bool_T Force = False );
 };
 
 //==============================================================================
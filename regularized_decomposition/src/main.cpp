@@ -98,19 +98,70 @@ The modifications (mostly) in between //@BEGIN--- and //@END-----
 #ifndef __STOCHSOL_H__
 #	include "stochsol.h"
 #endif
+#ifndef __PROBCACH_H__
+#	include "probcach.h"
+#endif
+#ifndef __OBM_STAT_H__
+#	include "obm_stat.h"
+#endif
+#ifndef __MRP_CKPT_H__
+#	include "mrp_ckpt.h"
+#endif
+#ifndef __RAND01_H__
+#	include "rand01.h"
+#endif
+#ifndef __DISTCOMP_H__
+#	include "distcomp.h"
+#endif
 
 //==============================================================================
 //	Static functions used in the module --- prototypes.
 //
 static DeterministicLP *ReadDeterministicLP( void );
 
+static DeterministicLP *ReadCachedProblem( Scenarios *&Scen,
+	Int_T &Stage1Row, Int_T &Stage1Col, Int_T &Stage2Row, Int_T &Stage2Col );
+
 static Bool_T ReadTimeFile( MPS_LP &LP, Int_T &Stage1Row, Int_T &Stage1Col,
 	Int_T &Stage2Row, Int_T &Stage2Col );
 
-static Scenarios *ReadAndGenerateScenarios( DeterministicLP &LP, TimeInfo &TI );
+static Scenarios *ReadAndGenerateScenarios( DeterministicLP &LP,
+	Scenarios *Scen, Bool_T Background, TimeInfo &TI, Int_T Stage1Row,
+	Int_T Stage1Col, Int_T Stage2Row, Int_T Stage2Col );
+
+static Bool_T RD_Crash( DeterministicLP &DetermLP, Spc &SPC,
+	Array<Real_T> &x1, const Int_T x1n, Array<Int_T> &ColStat,
+	Array<Int_T> &RowStat, Bool_T &BasisFound );
+
+static void MapCrashBasis( DeterministicLP &DetermLP, RD_SubproblemLP &W,
+	const Array<Int_T> &ColStat, const Array<Int_T> &RowStat,
+	Array<Int_T> &Cols, Array<Int_T> &Rows );
 
-static Bool_T RD_Crash( const DeterministicLP &DetermLP, Spc &SPC,
-	Array<Real_T> &x1, const Int_T x1n );
+static Bool_T RD_ExpectedValue( DeterministicLP &DetermLP, Scenarios &Scen,
+	Spc &SPC, Array<Real_T> &x1, const Int_T x1n );
+
+static void RecordStartupTimes( TimeInfo &TI );
+
+static void SequentialSampling( MasterSolver &master, Scenarios &Scen,
+	StochSolution *&sol, const Int_T x1n, Int_T ObjScale );
+
+static void ReadFirstStagePoint( const char *FileName, Array<Real_T> &x,
+	const Int_T x1n );
+static void GetCandidateSolution( Array<Real_T> &xhat, const Int_T x1n );
+
+static Real_T ControlVariateMean( MasterSolver &master, Scenarios &Scen,
+	const Array<Real_T> &xhat, const Array<Real_T> &xev, const Int_T x1n,
+	Int_T batchSize, Int_T ObjScale );
+
+static Real_T PooledGapEstimate( MasterSolver &master, Scenarios &Scen,
+	StochSolution *sol, const Array<Real_T> &x1start,
+	const Array<Real_T> &xhat, const Int_T x1n, Int_T Samples,
+	Int_T SampleSize, Int_T ObjScale, Int_T Rep, double &gap, double &var,
+	double *zn );
+
+static Real_T JackknifeGap( MasterSolver &master, const StochSolution *sol,
+	const Int_T x1n, Int_T SampleSize, Int_T Groups, Int_T ObjScale,
+	double gap );
 
 //
 //	Static data.
@@ -258,24 +309,57 @@ void run( int argc, char *argv[] )
 	if( DecompOpt.Verbosity > V_NONE ) PrintCopyright();
 
 	//--------------------------------------------------------------------------
-	//	Read in the deterministic LP.
+	//	Open the run statistics file (if one was requested).
 	//
-	DeterministicLP *DetermLP = ReadDeterministicLP();
-
-
-	if( DetermLP == NULL ) FatalError( "Errors processing the core file." );
-	TI.MarkTime( TI_READ_LP );
+	if( *DecompOpt.StatsFile &&
+		!RunStat.Open( DecompOpt.StatsFile, DecompOpt.StatsFormat ) )
+		FatalError( "Cannot open the statistics file %s.",
+			DecompOpt.StatsFile );
 
 	//--------------------------------------------------------------------------
-	//	Read in the time file.
+	//	Read the deterministic LP, the division into stages and the
+	//	distributions from the problem cache (if there is a valid one).
 	//
+	DeterministicLP *DetermLP = NULL;
+	Scenarios *CachedScen = NULL;
 	Int_T Stage1Row, Stage1Col, Stage2Row, Stage2Col;
 
-	if( !ReadTimeFile( *DetermLP, Stage1Row, Stage1Col, Stage2Row, Stage2Col ) )
-		FatalError( "Errors processing the time file: %s\n",
-			DecompOpt.TimeFile );
+	if( *DecompOpt.CacheFile )
+		DetermLP = ReadCachedProblem( CachedScen, Stage1Row, Stage1Col,
+			Stage2Row, Stage2Col );
+
+	if( DetermLP == NULL )
+	{
+		//----------------------------------------------------------------------
+		//	Read in the deterministic LP.
+		//
+		DetermLP = ReadDeterministicLP();
+
+		if( DetermLP == NULL ) FatalError( "Errors processing the core file." );
+		TI.MarkTime( TI_READ_LP );
+
+		//----------------------------------------------------------------------
+		//	Read in the time file.
+		//
+		if( !ReadTimeFile( *DetermLP, Stage1Row, Stage1Col, Stage2Row,
+			Stage2Col ) )
+			FatalError( "Errors processing the time file: %s\n",
+				DecompOpt.TimeFile );
+	}
+	else
+		TI.MarkTime( TI_READ_LP );
 	TI.MarkTime( TI_READ_TIME );
 
+	//--------------------------------------------------------------------------
+	//	Start reading the stochastic data file in the background (it only
+	//	depends on the labels of the deterministic LP). It is read while the
+	//	crash LP is solved and collected in "ReadAndGenerateScenarios()".
+	//
+	Bool_T Background = False;
+
+	if( CachedScen == NULL && DecompOpt.ParallelRead )
+		Background = StartStochReader( DecompOpt.StochFile, *DetermLP );
+
 	//--------------------------------------------------------------------------
 	//	Check if there are any non-zeros in the part of the matrix, which should
 	//	be empty. If there are, signal error.
@@ -290,14 +374,18 @@ void run( int argc, char *argv[] )
 
 	Spc SPC;
 	SPC.Pricing = DecompOpt.Pricing;
+	SPC.KeepWeights = DecompOpt.KeepWeights;
 
 	//--------------------------------------------------------------------------
 	//	Run the RD crash: solve a deterministic problem.
 	//
 	Int_T x1n = Stage2Col;
 	Array<Real_T> x1( x1n, 0.0 );
+	Array<Int_T> CrashColStat, CrashRowStat;
+	Bool_T CrashBasisFound = False;
 
-	if( DecompOpt.DoCrash && !RD_Crash( *DetermLP, SPC, x1, x1n ) )
+	if( DecompOpt.DoCrash && !RD_Crash( *DetermLP, SPC, x1, x1n,
+		CrashColStat, CrashRowStat, CrashBasisFound ) )
 		FatalError( "RD crash failed." );
 
 
@@ -315,20 +403,32 @@ void run( int argc, char *argv[] )
 	//	Read the stochastic data file and call the scenario generating routine.
 	//	Then zero the random data in the deterministic LP object.
 	//
-	Scenarios *Scen = ReadAndGenerateScenarios( *DetermLP, TI);
+	Scenarios *Scen = ReadAndGenerateScenarios( *DetermLP, CachedScen,
+		Background, TI, Stage1Row, Stage1Col, Stage2Row, Stage2Col );
 	
 	if( Scen == NULL ) FatalError( "\nFailed to create the scenarios!" );
 
 	
-	//@BEGIN--------------------------------------------------------------------
-	// For Two-Replication Procedures, creating a second set of scenarios.
-	//
-//	Scenarios *Scen2 = ReadAndGenerateScenarios( *DetermLP, TI);
-//	if( Scen2 == NULL ) FatalError( "\nFailed to create the second set of scenarios!" );
-	
-	//@END----------------------------------------------------------------------
-	
 	
+	//--------------------------------------------------------------------------
+	//	Solve the expected value problem (before the random data are zeroed).
+	//	Its solution starts the first batch of every MRP replication (unless
+	//	the starting point is read from a file) and is the reference point of
+	//	the control variate. The crash point is used instead if it is not
+	//	available.
+	//
+	Array<Real_T> x1batch( x1n, 0.0 ), xev( x1n, 0.0 );
+
+	x1batch.Copy( x1, x1n, x1n );
+	xev.Copy( x1, x1n, x1n );
+	if( ( DecompOpt.EV_Start && !*DecompOpt.StartFile ) ||
+		DecompOpt.ControlVariate )
+		RD_ExpectedValue( *DetermLP, *Scen, SPC, xev, x1n );
+	if( *DecompOpt.StartFile )
+		ReadFirstStagePoint( DecompOpt.StartFile, x1batch, x1n );
+	else if( DecompOpt.EV_Start )
+		x1batch.Copy( xev, x1n, x1n );
+
 	DetermLP->ZeroRandomData( (*Scen)[0] );
 
 	Int_T ObjScale = DetermLP->ScaleObjective( *Scen );
@@ -379,19 +479,39 @@ void run( int argc, char *argv[] )
 		);
 	}
 
-	W.ToStandard( V_NONE );
-	W.InitializeRD_Subproblem();
-
 	//--------------------------------------------------------------------------
 	//	Renumber the rows and columns in scenarios. After that the deterministic
 	//	LP is no longer needed and may be disposed of.
 	//
 	DetermLP->RenumberIndiceInScenarios( *Scen, Stage2Col );
 
-	//@BEGIN-----------------------------------------------------------
-	//Need to renumber indices in the scenarios for the second sample 
-//	DetermLP->RenumberIndiceInScenarios( *Scen2, Stage2Col );
-	//@END-------------------------------------------------------------
+	//--------------------------------------------------------------------------
+	//	Presolve the second stage LP once (random data are protected, so that
+	//	the reduced LP is valid for all scenarios). Then scale it once. The
+	//	row/column maps and the scaling factors are kept in 'W' and applied to
+	//	every scenario's right hand side and cost.
+	//
+	if( DecompOpt.PresolveSub &&
+		!W.PresolveRD_Subproblem( *Scen, DecompOpt.Verbosity >= V_HIGH ?
+			V_LOW : V_NONE ) )
+		FatalError( "The second stage LP is infeasible or unbounded for all "
+			"scenarios." );
+
+	if( DecompOpt.ScaleSub && !W.ScaleLP( V_NONE ) )
+		FatalError( "Failed to scale the second stage LP." );
+
+	W.ToStandard( V_NONE );
+	W.InitializeRD_Subproblem();
+
+	//--------------------------------------------------------------------------
+	//	Translate the crash LP optimal basis into the terms of the (possibly
+	//	presolved) second stage LP. It will be used to start the subproblems.
+	//
+	Array<Int_T> CrashCols, CrashRows;
+
+	if( CrashBasisFound )
+		MapCrashBasis( *DetermLP, W, CrashColStat, CrashRowStat, CrashCols,
+			CrashRows );
 
 
 	delete DetermLP; DetermLP = NULL;
@@ -406,6 +526,8 @@ void run( int argc, char *argv[] )
 
 	SubMan.SetScenarios( *Scen );
 	SubMan.SetVerbosity( DecompOpt.Verbosity );
+	if( CrashBasisFound ) SubMan.SetCrashBasis( CrashCols, CrashRows );
+	RunStat.WatchSolver( SubMan.GetSubproblemSolver() );
 
 	//--------------------------------------------------------------------------
 	//	Create and initialize the master solver object. Solve the problem.
@@ -454,6 +576,10 @@ void run( int argc, char *argv[] )
 	if( ObjScale )
 		sol->result *= pow( 10.0, ObjScale );
 
+	RecordStartupTimes( TI );
+	RunStat.SetValue( RunStatistics::VAL_OBJECTIVE, sol->result );
+	RunStat.Record( RunStatistics::LV_STARTUP );
+
 	PrintSolution( DecompOpt.SolutionFile, sol );
 
 
@@ -464,6 +590,42 @@ void run( int argc, char *argv[] )
 			   i+1, sol->x[i] );
 	}
 
+	//--------------------------------------------------------------------------
+	//	Sequential sampling grows the sample of the problem just solved (it is
+	//	not followed by the multiple replication procedure).
+	//
+	if( DecompOpt.SeqSampling )
+	{
+		SequentialSampling( master, *Scen, sol, x1n, ObjScale );
+		PrintSolution( DecompOpt.SolutionFile, sol );
+
+		RunStat.Close();
+
+		delete Scen; Scen = NULL;
+		delete sol;
+		return;
+	}
+
+	//--------------------------------------------------------------------------
+	//	A reduced set of scenarios only gives a quick (what-if) solution. It is
+	//	not followed by the multiple replication procedure either: the master
+	//	is made for the reduced set, not for batches of the full sample size.
+	//
+	if( DecompOpt.ReduceTo > 0 )
+	{
+		RunStat.Close();
+
+		delete Scen; Scen = NULL;
+		delete sol;
+		return;
+	}
+
+	//--------------------------------------------------------------------------
+	//	The candidate solution whose optimality gap is estimated (its true gap
+	//	is "optg" below).
+	//
+	Array<Real_T> xhat( x1n, 0.0 );
+	GetCandidateSolution( xhat, x1n );
 
 
 	
@@ -474,20 +636,45 @@ void run( int argc, char *argv[] )
         // David Love -- Added number of nonoverlapping batches
         const int numNonOverBatches = DecompOpt.NumNonOverBatches;  // Number of nonoverlapping batches
         const int batchSize = DecompOpt.ScenNum;
+
+	//the single and the averaged two-replication procedures (SRP, A2RP)
+	//solve one or two independent samples of "batchSize" scenarios. These
+	//are their (non-overlapping) batches; the variance is that of the
+	//individual scenario gaps, pooled over the samples (see
+	//"PooledGapEstimate()"), so the confidence interval is divided by the
+	//total sample size
+	const Bool_T pooled = Bool_T( DecompOpt.Procedure != DecompOptions::MRP );
+
         // David Love -- Delete gamma when I have a working gamma input
-        const int gamma = DecompOpt.NonOverlap;
+        const int gamma = pooled ? batchSize : DecompOpt.NonOverlap;
 
         // David Love -- Rewrote the number of batches to work with overlapping
-	const int numBatches = floor( (numNonOverBatches - 1) * (double) batchSize / (double) gamma + 1 );      //this is the smaller loop for the MRP
+	const int numBatches = pooled ?
+		( DecompOpt.Procedure == DecompOptions::A2RP ? 2 : 1 ) :
+		floor( (numNonOverBatches - 1) * (double) batchSize / (double) gamma + 1 );      //this is the smaller loop for the MRP
         // David Love -- Degrees of freedom of variance operator
         const int sampleSize = batchSize + (numBatches-1)*gamma;
-        const double degreesFreedom = numBatches * ( (double) sampleSize / (double) batchSize - 1.0 );
-        const double ciDenom = 1.0;
+        const double degreesFreedom = pooled ?
+		numBatches * ( batchSize - 1.0 ) :
+		numBatches * ( (double) sampleSize / (double) batchSize - 1.0 );
+        const double ciDenom = pooled ? (double) sampleSize : 1.0;
 
         // David Love -- Counters for calculating total average gap
-        double *  indivGaps;     // Gap estimates for individual samples
-        int    *  indivCounts;   // Counter for "vertical" part of total gap average
+	OverlappingBatchMeans obm( batchSize, gamma, numBatches );
         double *  gapest;        // holds all of the gap estimators
+
+	//control variate: its overlapping batch means, its value for the batches,
+	//its mean (from a pilot run), the sums of the (gap, control) pairs of all
+	//batches and scenarios and the regression coefficient
+	OverlappingBatchMeans ctrlObm( batchSize, gamma, numBatches );
+	double *ctrlest = NULL;
+	double ctrlMean = 0.0, beta;
+	double sg, sc, sgc, scc;
+
+	//jackknife: the number of groups, the bias-corrected gap estimates of the
+	//replications and the sum of the bias estimates of the batches
+	const int jackGroups = DecompOpt.JackknifeGroups;
+	double *gjack, jbias = 0.0;
 	
 	int kk, oo; 
 	double *var, *gbar, *ci; 
@@ -504,11 +691,11 @@ void run( int argc, char *argv[] )
                 //164.84;          //apl1p, for xhat = (1111.11, 2300)
 		
 		//11737.350015; //cep1, for xhat=(0,0,1166.67,2500,0,500,1666.67,3000) 
-		1.0821600; //db1, for xhat=(11, 14, 8, 11, 7)
+		//1.0821600; //db1, for xhat=(11, 14, 8, 11, 7)
+		( DecompOpt.XhatGap >= 0.0 ) ? DecompOpt.XhatGap :
+		1.0821600;	//that of the built-in db1 candidate
 		
 		
-	double cov = 0.0; 
-
 	double mns, vrs;		//mean and variance for the inner loop 
 
         // The following two variables are not defined in the code when I got it.  Had to add them myself.
@@ -522,6 +709,7 @@ void run( int argc, char *argv[] )
 	var = new double[numCIs];
 	gbar = new double[numCIs];
 	ci = new double[numCIs];
+	gjack = new double[numCIs];
 	
 	znstarbar = new double[numCIs];
 
@@ -535,12 +723,75 @@ void run( int argc, char *argv[] )
         // exit(0);
         
         // David Love -- Initializers for calculating total gap average
-        indivGaps = new double[sampleSize];
-        indivCounts = new int[sampleSize];
         gapest = new double[numBatches];
 
+	//the results of the replications (and the checkpoint file): a resumed run
+	//takes the replications done so far from the file (if it was written by
+	//a run of the same design on the same problem)
+	MRP_Checkpoint ckpt, design;
+	int firstRep = 0;
+	double prevTime = 0.0;
+
+	design.Start( batchSize, gamma, numBatches, degreesFreedom, ciDenom, za,
+		optg, jackGroups );
+	if( !design.SetInputs( DecompOpt.CoreFile, DecompOpt.TimeFile,
+		DecompOpt.StochFile ) )
+		FatalError( "Cannot find the input files." );
+	design.SetMethod( DecompOpt.Sampling, DecompOpt.Antithetic,
+		DecompOpt.ControlVariate, DecompOpt.Procedure );
+	if( DecompOpt.Resume )
+	{
+		if( !ckpt.Read( DecompOpt.CheckpointFile ) )
+			FatalError( "Cannot read the checkpoint file %s.",
+				DecompOpt.CheckpointFile );
+		if( !ckpt.SameDesign( design ) || ckpt.GetReplications() > numCIs )
+			FatalError( "The checkpoint file %s was written by a different "
+				"MRP run.", DecompOpt.CheckpointFile );
+
+		firstRep = ckpt.GetReplications();
+		prevTime = ckpt.GetTime();
+		for( kk = 0; kk < firstRep; kk++ )
+			ckpt.GetReplication( kk, gbar[kk], var[kk], ci[kk], znstarbar[kk],
+				znstar + kk * numBatches, gjack[kk] );
+
+		if( DecompOpt.Verbosity >= V_LOW )
+			Print( "\nRESUMING THE MRP AT REPLICATION %d OF %d.\n",
+				firstRep + 1, numCIs );
+	}
+	else
+		ckpt.Append( design );	//an empty checkpoint takes the design
+	ckpt.Reserve( numCIs );
 
-	for(kk=0; kk<numCIs; kk++){
+	if( DecompOpt.ControlVariate )
+	{
+		ctrlest = new double[numBatches];
+		if( !ckpt.GetControlMean( ctrlMean ) )
+		{
+			ctrlMean = ControlVariateMean( master, *Scen, xhat, xev, x1n,
+				batchSize, ObjScale );
+			ckpt.SetControlMean( ctrlMean );
+		}
+	}
+
+	//the replications of a resumed run start from the saved generator states
+	//and the saved starting point, so they are those of an uninterrupted run
+	if( DecompOpt.Resume )
+	{
+		Random01::ReSeed( ckpt.GetState() );
+		Scenarios::SetBatchState( ckpt.GetBatchState() );
+		if( !ckpt.GetWarmStart( x1batch.start, x1n ) )
+			FatalError( "The checkpoint file %s holds no starting point of "
+				"the right size.", DecompOpt.CheckpointFile );
+	}
+	else
+	{
+		Scenarios::GetBatchState( ckpt.GetBatchState() );
+		ckpt.MarkOrigin();
+		ckpt.SetWarmStart( x1batch.start, x1n );
+	}
+
+
+	for(kk=firstRep; kk<numCIs; kk++){
                 time_t loopStartTime = time( NULL );
 
 		mns = 0.0; 
@@ -551,164 +802,182 @@ void run( int argc, char *argv[] )
                 printf( "Rep %d of %d, gamma = %d, m = %d, n = %d, nb = %d, degreesFreedom = %lf\n", kk, numCIs, gamma, batchSize, sampleSize, numBatches, degreesFreedom );
 
                 // David Love -- Initialize gap counters
-                for( int ii = 0; ii < sampleSize; ii++ )
-                {
-                   indivGaps[ii] = 0.0;
-                   indivCounts[ii] = 0;
-                }
-
-		// David Love -- Generate a full selection of scenarios for each batch
-                //Print( "j -- Beginning replication %d of %d\n", kk+1, numCIs );
-		Scen->ReGenerateScenarios( batchSize, batchSize ); 
-		for(oo = 0; oo<numBatches; oo++){
-                        // David Love -- ReGenerate back at the end of the loop.  Initialized outside the looop
-                        //Print( "j -- Batch %d of %d, overlap = %d\n", oo+1, numBatches, batchSize - gamma );
-			Scen->ReGenerateScenarios( batchSize, gamma ); 
-
-
-                        /* // @BEGIN Rebecca's code to print the scenarios
-                        // Tested and Confirmed: Overlapping is working correctly!!!
-                        Print( "SCEN Printing Scenarios\n" );
-                        Print( "SCEN Batch %d of %d\n", oo+1, numBatches );
-                        for (int scenCounter = 0; scenCounter < batchSize; scenCounter++)
-                        {
-                           Print( "SCEN " );
-                           Print("%d ", scenCounter+1);
-                           Scen->GetScenarioComponents(scenCounter);
-                           Print("\n");
-                        }
-                        Print("SCEN\n");
-                        */ // @END Rebecca's code
-
-
-			//solve sampling problem:
-			if( oo == 0 )
-                        {
-			   //this is to accelerate sol of sampling problem (cep1)
-			   //x1.start[0]= 0.00;
-			   //x1.start[1]= 0.00;
-			   //x1.start[2]= 1833.33333333;
-			   //x1.start[3]= 2500.00;
-			   //x1.start[4]= 0.00;
-			   //x1.start[5]= 0.00;
-			   //x1.start[6]= 2333.33333333;
-			   //x1.start[7]= 3000.00;
-
-			   //this is to accelerate solution of the sampling problem (pgp2) 
-			   //x1.start[0]= 1.5;
-			   //x1.start[1]= 5.5;
-			   //x1.start[2]= 5.0;
-			   //x1.start[3]= 5.5;
-
-                           //this is to accelerate solution of the sampling problem (apl1p)
-                           //x1.start[0]= 1800.0;
-                           //x1.start[1]= 1571.43;
-
-			   //this is to accelerate solution of the sampling problem (db1)
-			   x1.start[0]= 11.0;
-			   x1.start[1]= 13.0;
-			   x1.start[2]= 8.0;
-			   x1.start[3]= 12.0;
-			   x1.start[4]= 7.0;
-                        }
-                        else
-                        {
-                           for( int ss = 0; ss < x1n; ss++ )
-                           {
-                               x1.start[ss] = sol->x[ss];
-                           }
-                        }
-
-			master.SetStartingPoint( x1, x1n );  
+		obm.Clear();
+		ctrlObm.Clear();
+		sg = sc = sgc = scc = 0.0;
+		jbias = 0.0;
+
+		//the SRP and the A2RP solve their samples from the same point and
+		//pool the estimates (the batch statistics are those of the MRP)
+		if( pooled )
+			zn = PooledGapEstimate( master, *Scen, sol, x1batch, xhat, x1n,
+				numBatches, batchSize, ObjScale, kk, gbar[kk], vrs,
+				znstar + kk * numBatches );
+		else
+		{
+			// David Love -- Generate a full selection of scenarios for each batch
+	                //Print( "j -- Beginning replication %d of %d\n", kk+1, numCIs );
+			RunStat.Start( RunStatistics::PH_GEN_SCEN );
+			Scen->ReGenerateScenarios( batchSize, batchSize ); 
+			RunStat.Stop( RunStatistics::PH_GEN_SCEN );
+			for(oo = 0; oo<numBatches; oo++){
+	                        // David Love -- ReGenerate back at the end of the loop.  Initialized outside the looop
+	                        //Print( "j -- Batch %d of %d, overlap = %d\n", oo+1, numBatches, batchSize - gamma );
+				RunStat.Start( RunStatistics::PH_GEN_SCEN );
+				Scen->ReGenerateScenarios( batchSize, gamma ); 
+				RunStat.Stop( RunStatistics::PH_GEN_SCEN );
+
+
+	                        /* // @BEGIN Rebecca's code to print the scenarios
+	                        // Tested and Confirmed: Overlapping is working correctly!!!
+	                        Print( "SCEN Printing Scenarios\n" );
+	                        Print( "SCEN Batch %d of %d\n", oo+1, numBatches );
+	                        for (int scenCounter = 0; scenCounter < batchSize; scenCounter++)
+	                        {
+	                           Print( "SCEN " );
+	                           Print("%d ", scenCounter+1);
+	                           Scen->GetScenarioComponents(scenCounter);
+	                           Print("\n");
+	                        }
+	                        Print("SCEN\n");
+	                        */ // @END Rebecca's code
+
+
+				//solve sampling problem: the first batch starts from the expected
+				//value solution (or the crash point, or the point read from
+				//the "-start" file), the next ones from the previous batch
+				//optimum (and its penalty and cuts).
+				if( oo == 0 )
+				{
+					master.DropCommittee();
+					x1.Copy( x1batch, x1n, x1n );
+				}
+				else
+					for( int ss = 0; ss < x1n; ss++ )
+						x1.start[ss] = sol->x[ss];
+
+				master.SetStartingPoint( x1, x1n );  
 			
-			master.ReInit();
-			master.SetiStop(0); 
-			master.Solve();
-
-			master.FillSolution( sol );
-			if( ObjScale )	sol->result *= pow( 10.0, ObjScale );
-
-                        // David Love -- Commented out print statements, save room in file
-			// PrintSolution( DecompOpt.SolutionFile, sol );
-
-			// Print ("\nOPTIMAL DECISION VECTOR:\n");
-			// for (i = 0; i< x1n; i++){
-				// Print ("x*[%1d] = " 
-					   // "%10g\n", 
-					   // i+1, sol->x[i] );
-			// }
-
-			//store znstar
-
-			znstar[kk*numBatches+oo] = sol->result; 
-
-			zn += sol->result; 
+				master.ReInit();
+				master.SetiStop(0); 
+				RunStat.Start( RunStatistics::PH_SOLVE );
+				master.Solve();
+				RunStat.Stop( RunStatistics::PH_SOLVE );
+
+				master.FillSolution( sol );
+				if( ObjScale )	sol->result *= pow( 10.0, ObjScale );
+
+				//the next batch drops the first "gamma" scenarios of this one
+				//(the jackknife keeps all the cuts: the subsamples are solved
+				//from them first)
+				if( jackGroups > 0 )
+					master.KeepCommittee( 0 );
+				else if( DecompOpt.KeepCuts && oo + 1 < numBatches )
+					master.KeepCommittee( gamma );
+
+	                        // David Love -- Commented out print statements, save room in file
+				// PrintSolution( DecompOpt.SolutionFile, sol );
+
+				// Print ("\nOPTIMAL DECISION VECTOR:\n");
+				// for (i = 0; i< x1n; i++){
+					// Print ("x*[%1d] = " 
+						   // "%10g\n", 
+						   // i+1, sol->x[i] );
+				// }
+
+				//store znstar
+
+				znstar[kk*numBatches+oo] = sol->result; 
+
+				zn += sol->result; 
 			
-			//solve xhat solution:
-
-			//pgp2, this point is 0.63% from optimal
-			//x1.start[0]= 2.5;  
-			//x1.start[1]= 6.0;
-			//x1.start[2]= 3.5;
-			//x1.start[3]= 4.5;
-
-			///cep1, this point is 10.73% from the optimal, 
-			//x1.start[0]= 0.00;
-			//x1.start[1]= 125.0;
-			//x1.start[2]= 875.0;
-			//x1.start[3]= 2500.00;
-			//x1.start[4]= 0.00;
-			//x1.start[5]= 625.00;
-			//x1.start[6]= 1375.0;
-			//x1.start[7]= 3000.00;
-		
-			///cep1, this point is 361% from the optimal, 
-			//x1.start[0]= 650;
-			//x1.start[1]= 650;
-			//x1.start[2]= 650;
-			//x1.start[3]= 650;
-			//x1.start[4]= 150;
-			//x1.start[5]= 150;
-			//x1.start[6]= 150;
-			//x1.start[7]= 150;
-
-                        //apl1p, this point is ?? from the optimal,
-                        //x1.start[0]= 1111.11;
-                        //x1.start[1]= 2300;
-
-			//db1, this point is 0.006% from the optimal
-			x1.start[0]= 11.0; 
-			x1.start[1]= 14.0;
-			x1.start[2]= 8.0;
-			x1.start[3]= 11.0;
-			x1.start[4]= 7.0;
+				//evaluate the expected value solution on the batch (it has to
+				//come first: "istop = 11" keeps the costs of xhat intact)
+				if( DecompOpt.ControlVariate )
+				{
+					master.SetStartingPoint( xev, x1n );
+					master.SetiStop( 11 );
+					master.ReInit();
+					RunStat.Start( RunStatistics::PH_XHAT );
+					master.Solve();
+					RunStat.Stop( RunStatistics::PH_XHAT );
+				}
+
+				//solve xhat solution:
+
+				x1.Copy( xhat, x1n, x1n );
 		
 
-                        // David Love -- Clearling out printed Information
-			// Print("\nSTARTED XHAT SOLUTION...\n");
+	                        // David Love -- Clearling out printed Information
+				// Print("\nSTARTED XHAT SOLUTION...\n");
 				
-			master.SetStartingPoint( x1, x1n );  
-			master.SetiStop( 10 );	     
-  			master.ReInit();
-			master.Solve(); 
-
-                        // David Love -- Clearing out printed information
-			// Print("FINISHED XHAT SOLUTION...\n\n");
+				master.SetStartingPoint( x1, x1n );  
+				master.SetiStop( 10 );	     
+	  			master.ReInit();
+				RunStat.Start( RunStatistics::PH_XHAT );
+				master.Solve(); 
+				RunStat.Stop( RunStatistics::PH_XHAT );
+
+	                        // David Love -- Clearing out printed information
+				// Print("FINISHED XHAT SOLUTION...\n\n");
 			
-			gapest[oo] = (master.CalculateGap() * pow(10.0, ObjScale)); 
-                        //Print( "gapest[%d] = %lf\n", oo, gapest[oo] );
-
-                        // David Love -- Loop for the new "G Double Bar"
-                        for( int gammaCounter = 0; gammaCounter < batchSize; gammaCounter++ )
-                        {
-                           indivGaps[oo*gamma + gammaCounter] += ( master.GetIndivGap(gammaCounter) + master.GetIndivGap(batchSize) ) * pow(10.0, ObjScale);
-                           indivCounts[oo*gamma + gammaCounter] += 1;
-                           //Print( "indivGaps[%d] = %lf, indivCounts[%d] = %d\n", oo*gamma + gammaCounter, indivGaps[oo*gamma + gammaCounter], 
-                                 //oo*gamma + gammaCounter, indivCounts[oo*gamma + gammaCounter] );
-                           //Print( "ExpC[%d] = %lf, v[%d] = %lf\n", oo*gamma + gammaCounter, master.GetExpC(gammaCounter) + master.GetExpC(batchSize),
-                                 //oo*gamma + gammaCounter, master.GetV(gammaCounter) + master.GetV(batchSize) );
-                        }
-		} //end of for with "oo" (0 == oo < numBatches). 
+				gapest[oo] = (master.CalculateGap() * pow(10.0, ObjScale)); 
+	                        //Print( "gapest[%d] = %lf\n", oo, gapest[oo] );
+
+				if( DecompOpt.ControlVariate )
+				{
+					ctrlest[oo] = master.CalculateControl() * pow(10.0, ObjScale);
+					ctrlObm.AddBatch( oo, ctrlest[oo] );
+					for( int c = 0; c < batchSize; c++ )
+					{
+						double g = ( master.GetIndivGap(c) +
+							master.GetIndivGap(batchSize) ) * pow(10.0, ObjScale);
+						double h = ( master.GetIndivControl(c) +
+							master.GetIndivControl(batchSize) ) *
+							pow(10.0, ObjScale);
+
+						sg += g;	sc += h;
+						sgc += g * h;	scc += h * h;
+					}
+				}
+
+	                        // David Love -- Loop for the new "G Double Bar": only
+				// the scenarios near the ends of the sample are needed, the
+				// others are accounted for by the batch gap estimate
+				obm.AddBatch( oo, gapest[oo] );
+				const int head = obm.HeadPoints( oo ),
+					tail = obm.TailStart( oo );
+	                        for( int gammaCounter = 0; gammaCounter < batchSize; gammaCounter++ )
+	                        {
+				   if( gammaCounter == head ) gammaCounter = tail;
+				   if( gammaCounter == batchSize ) break;
+
+	                           obm.AddPoint( oo, gammaCounter, ( master.GetIndivGap(gammaCounter) + master.GetIndivGap(batchSize) ) * pow(10.0, ObjScale) );
+				   if( DecompOpt.ControlVariate )
+					ctrlObm.AddPoint( oo, gammaCounter,
+						( master.GetIndivControl(gammaCounter) +
+						master.GetIndivControl(batchSize) ) *
+						pow(10.0, ObjScale) );
+	                           //Print( "ExpC[%d] = %lf, v[%d] = %lf\n", oo*gamma + gammaCounter, master.GetExpC(gammaCounter) + master.GetExpC(batchSize),
+	                                 //oo*gamma + gammaCounter, master.GetV(gammaCounter) + master.GetV(batchSize) );
+	                        }
+
+				//jackknife: the batch is re-solved without each group of
+				//scenarios in turn (after this "v" holds the values of the
+				//last subsample)
+				if( jackGroups > 0 )
+				{
+					jbias += gapest[oo] - JackknifeGap( master, sol, x1n,
+						batchSize, jackGroups, ObjScale, gapest[oo] );
+					if( DecompOpt.KeepCuts && oo + 1 < numBatches )
+						master.ReuseCommittee( gamma );
+				}
+
+				RunStat.SetValue( RunStatistics::VAL_OBJECTIVE, sol->result );
+				RunStat.SetValue( RunStatistics::VAL_GAP, gapest[oo] );
+				RunStat.Record( RunStatistics::LV_BATCH, kk, oo );
+			} //end of for with "oo" (0 == oo < numBatches). 
+		} //end of the MRP batches
                 // David Love -- Print time required for each replication
                 endTime = time( NULL );
                 Print( "Rep Time: %0.0lf\n", difftime( endTime, loopStartTime ) );
@@ -717,23 +986,45 @@ void run( int argc, char *argv[] )
 		//MRP calculations:
 
                 // David Love -- New calculation of the gap estimate
-                gbar[kk] = 0.0;
-                for( int ii = 0; ii < sampleSize; ii++ )
-                {
-                   indivGaps[ii] /= indivCounts[ii];
-                   gbar[kk] += indivGaps[ii];
-                }
-                gbar[kk] /= sampleSize;
+		if( !pooled )
+			gbar[kk] = obm.GetMean();
+
+		//control variate: the coefficient is fitted on the individual
+		//scenarios of all batches, the batch estimates are corrected with
+		//the same one
+		if( DecompOpt.ControlVariate )
+		{
+			const double np = (double) numBatches * batchSize;
+			const double cbar = ctrlObm.GetMean();
+
+			sgc -= sg * sc / np;
+			scc -= sc * sc / np;
+			beta = ( scc > 0.0 ) ? sgc / scc : 0.0;
+
+			Print( "beta[%d]   = %lf (gbar without control = %lf)\n", kk,
+				beta, gbar[kk] );
+
+			gbar[kk] -= beta * ( cbar - ctrlMean );
+			for( int ii = 0; ii < numBatches; ii++ )
+				gapest[ii] -= beta * ( ctrlest[ii] - ctrlMean );
+		}
+
+		//the batches have the same bias, so the gap estimate is corrected
+		//by its average jackknife estimate. The correction may overshoot (a
+		//gap is never negative, so the estimate is cut off at zero); it is
+		//reported next to "gbar", not instead of it.
+		gjack[kk] = Max( gbar[kk] - jbias / (double) numBatches, 0.0 );
+		if( jackGroups > 0 )
+			Print( "gjack[%d]  = %lf (bias %lf)\n", kk, gjack[kk],
+				jbias / (double) numBatches );
+
                 Print( "gbar[%d]   = %lf\n", kk, gbar[kk] );
 		//mns /= (double) numBatches; 
 		//vrs /= (double) numBatches; 
 
-                vrs = 0.0;
-                for( int ii = 0; ii < numBatches; ii++ )
-                {
-                   vrs += pow( gapest[ii] - gbar[kk], 2 );
-                }
-                vrs /= (double) degreesFreedom;
+		if( !pooled )
+			vrs = OverlappingBatchMeans::Variance( gapest, numBatches,
+				gbar[kk], degreesFreedom );
 
 		//vrs = vrs - pow(mns, 2) ;
                 // David Love -- Had to change degrees of freedom
@@ -743,55 +1034,55 @@ void run( int argc, char *argv[] )
 		//gbar[kk] = mns; 
 		var[kk] = vrs; 
 
+		RunStat.SetValue( RunStatistics::VAL_GAP, gbar[kk] );
+		RunStat.SetValue( RunStatistics::VAL_VARIANCE, var[kk] );
+		RunStat.Record( RunStatistics::LV_REPLICATION, kk );
+
 		ci[kk] = gbar[kk] + za*sqrt(var[kk]) / sqrt(ciDenom); 
-		if(ci[kk] >= optg) cov++; 
 
 		//also calculate znstarbar
 
 		znstarbar[kk] = zn / (double) numBatches; 
+
+		//record the replication, write the checkpoint every
+		//"CheckpointEvery" replications and after the last one
+		ckpt.Record( kk, gbar[kk], var[kk], ci[kk], znstarbar[kk],
+			znstar + kk * numBatches, gjack[kk] );
+
+		//in the adaptive mode report the running statistics and stop once
+		//the coverage is known precisely enough ("-r" is then the limit)
+		Bool_T covStop = False;
+		if( DecompOpt.CoverageHW > 0.0 )
+		{
+			ckpt.PrintProgress();
+			covStop = Bool_T( kk + 1 >= DecompOpt.MinReplications &&
+				ckpt.CoverageHalfWidth() <= DecompOpt.CoverageHW );
+		}
+
+		if( *DecompOpt.CheckpointFile &&
+			( ( kk + 1 - firstRep ) % DecompOpt.CheckpointEvery == 0 ||
+			kk + 1 == numCIs || covStop ) )
+		{
+			Random01::GetSeed( ckpt.GetState() );
+			Scenarios::GetBatchState( ckpt.GetBatchState() );
+			ckpt.SetTime( prevTime + difftime( time( NULL ), startTime ) );
+			if( !ckpt.Write( DecompOpt.CheckpointFile ) )
+				Warning( "Unable to write the checkpoint file %s.",
+					DecompOpt.CheckpointFile );
+		}
+
+		if( covStop )
+		{
+			Print( "COVERAGE HALF-WIDTH %lf REACHED AFTER %d REPLICATIONS.\n",
+				ckpt.CoverageHalfWidth(), kk + 1 );
+			break;
+		}
 		
 	}  //end of loop with kk, 0 <= kk < numCIs
 
-        // David Love -- Statistics on variance calculations
-        double avgVar = 0.0;
-        for( kk = 0; kk < numCIs; kk++ )
-                avgVar += var[kk];
-        avgVar = avgVar / numCIs;
-        double varVariance = 0.0;
-        for( kk = 0; kk < numCIs; kk++ )
-           varVariance += pow( var[kk] - avgVar, 2 );
-        varVariance = varVariance / (numCIs-1);
-        // David Love -- Statistics on confidence interval width
-        double ciWidth = 0.0,
-               varCIWidth = 0.0;
-        for( kk = 0; kk < numCIs; kk++ )
-                ciWidth += za * sqrt( var[kk] ) / sqrt( ciDenom );
-        ciWidth = ciWidth / numCIs;
-        for( kk = 0; kk < numCIs; kk++ )
-           varCIWidth += pow( (za * sqrt( var[kk] ) / sqrt( ciDenom )) - ciWidth, 2 );
-        varCIWidth = varCIWidth / (numCIs-1);
-        // David Love -- Statistics on total CI size
-        // David Love -- 4/26/12, I am pretty sure that the lines below tih znstarber[kk] should actually contain gbar[kk].  
-        // But these things have already been calculated and stored above as ci[kk].
-        // The original lines of core are commented below my changes in the next two for loops.
-        double ciSize = 0.0,
-               varCISize = 0.0;
-        for( kk = 0; kk < numCIs; kk++ )
-                ciSize += ci[kk];
-                // ciSize += znstarbar[kk] + za * sqrt( var[kk] ) / sqrt( ciDenom );
-        ciSize = ciSize / numCIs;
-        for( kk = 0; kk < numCIs; kk++ )
-           varCISize += pow( ci[kk] - ciSize, 2 );
-           // varCISize += pow( (znstarbar[kk] + za * sqrt( var[kk] ) / sqrt( ciDenom )) - ciSize, 2 );
-        varCISize = varCISize / (numCIs-1);
-
-        //for( kk = 0; kk < numCIs; kk++ )
-           //ciWidth += znstarbar[kk];
-        //ciWidth /= numCIs;
-        //ciWidth += za * sqrt(avgVar) / sqrt( ciDenom );
-
-	//print results:
-	cov = (double) cov / numCIs;  
+	//print results: the statistics on the variance, the confidence interval
+	//width and size (of all replications, including those of the earlier
+	//runs of a resumed one) are computed by "MRP_Checkpoint::PrintSummary()"
 
         // David Love -- Clearing out printed information
 	// Print ("Optimality Gap = %f\n\n", optg); 
@@ -807,20 +1098,8 @@ void run( int argc, char *argv[] )
         // David Love -- Calculating the solution time
         endTime = time( NULL );
 
-        Print("BEGIN MRP\n");
-        Print("Batch Size = %d\n", batchSize);
-        Print("gamma = %d\n", gamma);
-        Print("CI Width = %lf\n", ciWidth);
-	Print ("Coverage, MRP: = %lf\n", cov); 
-        Print ("Average Variance = %lf\n", avgVar );
-        Print("Variance of Variance = %le\n", varVariance );
-        Print("Number Batches = %d\n", numBatches);
-        Print("Degrees Freedom = %lf\n", degreesFreedom);
-        Print("CI Denom = %lf\n", (double) ciDenom);
-        Print("Var CI Width = %lf\n", varCIWidth);
-        Print("CI Sze = %lf\n", ciSize);
-        Print("Var CI Size = %lf\n", varCISize);
-        Print("Time = %0.0lf\n", difftime( endTime, startTime ) );
+	ckpt.SetTime( prevTime + difftime( endTime, startTime ) );
+	ckpt.PrintSummary();
 
 	//print also the znbar
         // David Love -- Clearing out printed information
@@ -848,15 +1127,16 @@ void run( int argc, char *argv[] )
 	var = NULL; gbar = NULL; ci = NULL;
 
         // David Love -- Clean up memory
-        delete [] indivGaps;
-        delete [] indivCounts;
+	delete [] ctrlest;
+	delete [] gjack;
 
 
 
 //****************************************************************************************
 
+	RunStat.Close();
+
 	delete Scen; Scen = NULL;
-//	delete Scen2; Scen2 = NULL; 
 	
 	delete sol;
 	
@@ -923,7 +1203,85 @@ void PrintHelpScreen( const char *ProgName )
 "  -restart {tree|random|self*} - mode for subproblem solution restarts,\n"
 "  -v <none|low*|high>          - output verbosity level,\n"
 "  -txt_sol <solution_file>     - optional name of solution file,\n"
-"  -pric {rc|se|ase*}           - simplex optimizer pricing mode.\n"
+"  -cache <cache_file>          - optional name of binary problem cache file\n"
+"                                 (created if missing or out of date),\n"
+"  -pric {rc|se|ase*}           - simplex optimizer pricing mode,\n"
+"  -se_keep {on*|off}           - keep the steepest edge weights when the\n"
+"                                 subproblems are restarted,\n"
+"  -crash_basis {on*|off}       - start the subproblems from the crash LP\n"
+"                                 optimal basis,\n"
+"  -sub_scale {on*|off}         - scaling of the second stage LP,\n"
+"  -sub_presolve {on|off*}      - scenario-safe presolve of the second\n"
+"                                 stage LP,\n"
+"  -ev_start {on*|off}          - start the first batch of a replication\n"
+"                                 from the expected value solution (off:\n"
+"                                 from the crash point),\n"
+"  -start <start_file>          - optional name of file with the first\n"
+"                                 stage values the first batch of a\n"
+"                                 replication starts from (instead),\n"
+"  -keep_cuts {on*|off}         - pass the final penalty and the active\n"
+"                                 cuts of the overlapping scenarios on\n"
+"                                 to the next batch,\n"
+"  -par_read {on|off*}          - read the stoch file in a background\n"
+"                                 process while the crash LP is solved,\n"
+"  -stats <stats_file>          - optional name of file for the timings and\n"
+"                                 counters of every batch and replication,\n"
+"  -stats_fmt {csv*|json}       - format of the statistics file,\n"
+"  -seq {on|off*}               - sequential sampling: grow the sample\n"
+"                                 until the gap of the previous solution\n"
+"                                 is small enough (no replications),\n"
+"  -seq_max <number>            - maximum sample size (default: 64 times\n"
+"                                 the initial sample size),\n"
+"  -seq_growth <factor>         - sample growth factor (default 2),\n"
+"  -seq_eps <tolerance>         - relative gap tolerance (default 1e-3),\n"
+"  -sampling {mc*|lhs|rqmc}     - scenario sampling: Monte Carlo, Latin\n"
+"                                 hypercube or randomized quasi-Monte\n"
+"                                 Carlo (scrambled Sobol' points),\n"
+"  -antithetic {on|off*}        - sample the scenarios in antithetic pairs,\n"
+"  -cv {on|off*}                - control variate (the expected value\n"
+"                                 solution) for the MRP gap estimates,\n"
+"  -cv_pilot <batches>          - number of batches of the pilot run which\n"
+"                                 estimates the control mean (default 10),\n"
+"  -checkpoint <ckpt_file>      - optional name of file for the results of\n"
+"                                 the MRP replications done so far (and\n"
+"                                 the data needed to resume the run),\n"
+"  -ckpt_every <replications>   - checkpoint frequency (default 1),\n"
+"  -resume {on|off*}            - go on with the run saved in the\n"
+"                                 checkpoint file,\n"
+"  -cov_hw <half-width>         - stop the MRP when the confidence interval\n"
+"                                 on the coverage is this narrow (default\n"
+"                                 0 - do all the replications),\n"
+"  -min_reps <replications>     - minimum number of replications before\n"
+"                                 such a stop (default 30),\n"
+"  -reduce <scenarios>          - reduce the scenarios to this many by the\n"
+"                                 fast forward selection and solve the\n"
+"                                 reduced problem only (no MRP),\n"
+"  -red_dist {std*|weighted}    - scenario distance used by the reduction,\n"
+"  -dist_procs <processes>      - number of processes computing the\n"
+"                                 scenario distances for the reduction and\n"
+"                                 the tree restart (default 1),\n"
+"  -xhat <xhat_file>            - optional name of file with the first\n"
+"                                 stage values of the candidate solution\n"
+"                                 (default: the db1 candidate, which may\n"
+"                                 only be used for db1),\n"
+"  -xhat_gap <gap>              - true optimality gap of the candidate,\n"
+"                                 for the coverage (required with -xhat;\n"
+"                                 default 1.08216, that of the db1\n"
+"                                 candidate),\n"
+"  -procedure {mrp*|srp|a2rp}   - optimality gap estimation: multiple,\n"
+"                                 single or averaged two-replication\n"
+"                                 procedure (the last two solve one or two\n"
+"                                 samples of \"-s\" scenarios),\n"
+"  -rep_procs <processes>       - number of processes solving the two\n"
+"                                 samples of the A2RP or the jackknife\n"
+"                                 subsamples (default 1),\n"
+"  -jackknife <groups>          - correct the bias of the MRP gap by the\n"
+"                                 jackknife with this many groups of\n"
+"                                 scenarios (default 0 - no correction);\n"
+"                                 the corrected gap \"gjack\" (cut off at\n"
+"                                 zero) may overshoot and its coverage fall\n"
+"                                 below the nominal one, so it does not\n"
+"                                 replace \"gbar\".\n"
 "\n"
 "Asterisk marks default values. You may specify the problem files using\n"
 "either the first option or all of the next three options.\n",
@@ -944,7 +1302,9 @@ void PrintTimings( TimeInfo &TI, bool first)
 			GenScenTime		= TI.TimeDifference( TI_READ_SCEN,	TI_GEN_SCEN ),
 			DivideTime		= TI.TimeDifference( TI_GEN_SCEN,	TI_LP_DIVIDE ),
 			SolveTime		= TI.TimeDifference( TI_LP_DIVIDE,	TI_SOLVE ),
-			TotalTime		= TI.TimeDifference( TI_START,		TI_SOLVE );
+			TotalTime		= TI.TimeDifference( TI_START,		TI_SOLVE ),
+			StartupWall		= TI.WallTimeDifference( TI_START,	TI_LP_DIVIDE ),
+			TotalWall		= TI.WallTimeDifference( TI_START,	TI_SOLVE );
 
 		Print(
 			"\nTimings:\n"
@@ -956,6 +1316,8 @@ void PrintTimings( TimeInfo &TI, bool first)
 			"\t%-40s:%7.5f\n"
 			"\t%-40s:%7.5f\n"
 			"\t%s\n"
+			"\t%-40s:%7.1f\n"
+			"\t%-40s:%7.5f\n"
 			"\t%-40s:%7.1f\n",
 
 			"Read LP",						ReadLP_Time,
@@ -966,7 +1328,9 @@ void PrintTimings( TimeInfo &TI, bool first)
 			"RD crash",						RD_CrashTime,
 			"Solve",						SolveTime,
 			"----------------------------------------",
-			"TOTAL",						TotalTime
+			"TOTAL",						TotalTime,
+			"Startup (wall clock)",			StartupWall,
+			"TOTAL (wall clock)",			TotalWall
 		);
 	}
 	else
@@ -991,6 +1355,830 @@ void PrintTimings( TimeInfo &TI, bool first)
 }
 
 
+/*------------------------------------------------------------------------------
+
+	static void RecordStartupTimes( TimeInfo &TI )
+
+PURPOSE:
+	Passes the times of the start-up phases (measured by "TI") to the run
+statistics object. They become a part of its start-up record.
+
+PARAMETERS:
+	TimeInfo &TI
+		Times of the events up to (and including) the first solution.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static void RecordStartupTimes( TimeInfo &TI )
+{
+	static const struct { RunStatistics::Phase Phase; int From, To; } Map[] =
+	{
+		{ RunStatistics::PH_READ_LP,	TI_START,		TI_READ_LP		},
+		{ RunStatistics::PH_READ_TIME,	TI_READ_LP,		TI_READ_TIME	},
+		{ RunStatistics::PH_CRASH,		TI_READ_TIME,	TI_RD_CRASH		},
+		{ RunStatistics::PH_READ_SCEN,	TI_RD_CRASH,	TI_READ_SCEN	},
+		{ RunStatistics::PH_GEN_SCEN,	TI_READ_SCEN,	TI_GEN_SCEN		},
+		{ RunStatistics::PH_DIVIDE,		TI_GEN_SCEN,	TI_LP_DIVIDE	},
+		{ RunStatistics::PH_SOLVE,		TI_LP_DIVIDE,	TI_SOLVE		}
+	};
+
+	for( size_t i = 0; i < sizeof( Map ) / sizeof( Map[0] ); i++ )
+		RunStat.AddTime( Map[i].Phase,
+			TI.TimeDifference( Map[i].From, Map[i].To ),
+			TI.WallTimeDifference( Map[i].From, Map[i].To ) );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static void SequentialSampling( MasterSolver &master, Scenarios &Scen,
+		StochSolution *&sol, const Int_T x1n, Int_T ObjScale )
+
+PURPOSE:
+	Sequential sampling procedure. Starting from the solved sampled problem,
+the sample is repeatedly grown by the factor "DecompOpt.SeqGrowth" (new
+scenarios are appended, the old ones are kept) and the enlarged problem is
+re-solved from the previous committee of cuts and subproblem bases. The
+solution of the previous (smaller) problem is the candidate: its optimality
+gap is estimated on the enlarged sample (single replication procedure). The
+procedure stops when the upper confidence bound on the gap
+
+		G + z * sqrt( var / N )
+
+does not exceed "DecompOpt.SeqEps * max( |z_N|, 1 )" or the sample reached
+"DecompOpt.SeqMax" scenarios. The one-sided 90% quantile (the one used by the
+multiple replication procedure) is used for "z".
+
+PARAMETERS:
+	MasterSolver &master
+		The master solver (after the first, optimal solution).
+
+	Scenarios &Scen
+		The scenario repository of the sampled problem.
+
+	StochSolution *&sol
+		On entry the first solution, on return the solution of the largest
+		sampled problem (reallocated, as its size grows with the sample).
+
+	const Int_T x1n
+		Number of the first stage variables.
+
+	Int_T ObjScale
+		Decimal exponent of the objective scaling (see
+		"DeterministicLP::ScaleObjective()").
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	Appends scenarios to "Scen". Writes one batch record per stage to the
+run statistics.
+
+------------------------------------------------------------------------------*/
+
+static void SequentialSampling( MasterSolver &master, Scenarios &Scen, // )
+	StochSolution *&sol, const Int_T x1n, Int_T ObjScale )
+{
+	const Real_T za = 1.282,
+		scale = ObjScale ? pow( 10.0, ObjScale ) : 1.0;
+
+	Array<Real_T> xhat( x1n, 0.0 );
+	Int_T N = Scen.GetNumberOfScenarios(), i;
+
+	if( DecompOpt.Verbosity >= V_LOW )
+		Print( "\nSEQUENTIAL SAMPLING (growth %g, at most %ld scenarios, "
+			"tolerance %g):\n"
+			"\t%5s  %10s  %16s  %12s  %12s\n",
+			(double) DecompOpt.SeqGrowth, (long) DecompOpt.SeqMax,
+			(double) DecompOpt.SeqEps,
+			"STAGE", "SAMPLE", "OBJECTIVE", "GAP", "CI WIDTH" );
+
+	for( Int_T stage = 1; N < DecompOpt.SeqMax; stage++ )
+	{
+		//----------------------------------------------------------------------
+		//	The solution of the current sample becomes the candidate. Grow the
+		//	sample and solve the enlarged problem from where the last one ended.
+		//
+		for( i = 0; i < x1n; i++ )
+			xhat[i] = sol->x[i];
+
+		Int_T Nnew = Int_T( ceil( N * DecompOpt.SeqGrowth ) );
+
+		if( Nnew > DecompOpt.SeqMax ) Nnew = DecompOpt.SeqMax;
+
+		RunStat.Start( RunStatistics::PH_GEN_SCEN );
+		Scen.AppendScenario( Nnew );
+		RunStat.Stop( RunStatistics::PH_GEN_SCEN );
+		if( Nnew <= N ) break;
+
+		master.AddScenarios( Nnew );
+		RunStat.Start( RunStatistics::PH_SOLVE );
+		master.Solve();
+		RunStat.Stop( RunStatistics::PH_SOLVE );
+
+		delete sol;
+		sol = master.GetSolution();
+		if( ObjScale ) sol->result *= scale;
+
+		//----------------------------------------------------------------------
+		//	Estimate the gap of the candidate on the enlarged sample.
+		//
+		Real_T gap, var;
+
+		RunStat.Start( RunStatistics::PH_XHAT );
+		Bool_T feasible = master.EvaluateCandidate( xhat, gap, var );
+		RunStat.Stop( RunStatistics::PH_XHAT );
+
+		gap *= scale;
+		var *= scale * scale;
+
+		Real_T width = za * sqrt( var / Nnew );
+
+		if( DecompOpt.Verbosity >= V_LOW )
+		{
+			if( feasible )
+				Print( "\t%5d  %10ld  %16.8E  %12.4E  %12.4E\n", (int) stage,
+					(long) Nnew, (double) sol->result, (double) gap,
+					(double) width );
+			else
+				Print( "\t%5d  %10ld  %16.8E  %12s  %12s\n", (int) stage,
+					(long) Nnew, (double) sol->result, "INFEASIBLE", "" );
+		}
+
+		RunStat.SetValue( RunStatistics::VAL_OBJECTIVE, sol->result );
+		if( feasible )
+		{
+			RunStat.SetValue( RunStatistics::VAL_GAP, gap );
+			RunStat.SetValue( RunStatistics::VAL_VARIANCE, var );
+		}
+		RunStat.Record( RunStatistics::LV_BATCH, 0, stage );
+
+		N = Nnew;
+
+		if( feasible && gap + width <=
+			DecompOpt.SeqEps * Max( fabs( sol->result ), 1.0 ) )
+		{
+			if( DecompOpt.Verbosity >= V_LOW )
+			{
+				Print( "\nCANDIDATE SOLUTION ACCEPTED (gap bound %G):\n",
+					(double) ( gap + width ) );
+				for( i = 0; i < x1n; i++ )
+					Print( "xhat[%1d] = %10g\n", (int) i+1, (double) xhat[i] );
+			}
+			return;
+		}
+	}
+
+	if( DecompOpt.Verbosity >= V_LOW )
+		Print( "\nMAXIMUM SAMPLE SIZE REACHED; GAP TOLERANCE NOT MET.\n" );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static void ReadFirstStagePoint( const char *FileName, Array<Real_T> &x,
+		const Int_T x1n )
+
+PURPOSE:
+	Reads the values of all "x1n" first stage variables (separated by white
+space) from a file: the candidate solution (option "-xhat") or the starting
+point of the first batch (option "-start").
+
+PARAMETERS:
+	const char *FileName
+		The file name.
+
+	Array<Real_T> &x, const Int_T x1n
+		On return the point, and the number of the first stage variables.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	Terminates the program if the file cannot be read or holds too few values.
+
+------------------------------------------------------------------------------*/
+
+static void ReadFirstStagePoint( const char *FileName, Array<Real_T> &x, // )
+	const Int_T x1n )
+{
+	FILE *fp = fopen( FileName, "r" );
+	if( fp == NULL )
+		FatalError( "Unable to open the first stage point file %s.",
+			FileName );
+
+	Int_T i;
+	double v;
+
+	for( i = 0; i < x1n && fscanf( fp, "%lf", &v ) == 1; i++ )
+		x[i] = v;
+	fclose( fp );
+
+	if( i < x1n )
+		FatalError( "The file %s holds %d values (%d first stage "
+			"variables).", FileName, (int) i, (int) x1n );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static void GetCandidateSolution( Array<Real_T> &xhat, const Int_T x1n )
+
+PURPOSE:
+	Stores the candidate solution (whose optimality gap is estimated) in
+"xhat". It is read from the file "DecompOpt.XhatFile", which has to hold the
+values of all "x1n" first stage variables (separated by white space). Without
+the file the candidate found for db1 is taken; it may only be used for a
+problem with as many first stage variables.
+
+PARAMETERS:
+	Array<Real_T> &xhat, const Int_T x1n
+		On return the candidate, and the number of the first stage
+		variables.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	Terminates the program if the candidate cannot be read or does not fit
+the problem.
+
+------------------------------------------------------------------------------*/
+
+static void GetCandidateSolution( Array<Real_T> &xhat, const Int_T x1n )
+{
+	if( *DecompOpt.XhatFile )
+	{
+		ReadFirstStagePoint( DecompOpt.XhatFile, xhat, x1n );
+		return;
+	}
+
+	//the candidates used before for the other problems (they may be given
+	//in a file now)
+
+	//pgp2, this point is 0.63% from optimal
+	//x1.start[0]= 2.5;  
+	//x1.start[1]= 6.0;
+	//x1.start[2]= 3.5;
+	//x1.start[3]= 4.5;
+
+	///cep1, this point is 10.73% from the optimal, 
+	//x1.start[0]= 0.00;
+	//x1.start[1]= 125.0;
+	//x1.start[2]= 875.0;
+	//x1.start[3]= 2500.00;
+	//x1.start[4]= 0.00;
+	//x1.start[5]= 625.00;
+	//x1.start[6]= 1375.0;
+	//x1.start[7]= 3000.00;
+		
+	///cep1, this point is 361% from the optimal, 
+	//x1.start[0]= 650;
+	//x1.start[1]= 650;
+	//x1.start[2]= 650;
+	//x1.start[3]= 650;
+	//x1.start[4]= 150;
+	//x1.start[5]= 150;
+	//x1.start[6]= 150;
+	//x1.start[7]= 150;
+
+	//apl1p, this point is ?? from the optimal,
+	//x1.start[0]= 1111.11;
+	//x1.start[1]= 2300;
+
+	//db1, this point is 0.006% from the optimal
+	static const Real_T db1[] = { 11.0, 14.0, 8.0, 11.0, 7.0 };
+	const Int_T db1n = Int_T( sizeof db1 / sizeof *db1 );
+
+	if( x1n != db1n )
+		FatalError( "The built-in candidate solution has %d first stage "
+			"variables (%d in the problem); use option -xhat.", (int) db1n,
+			(int) x1n );
+
+	for( Int_T i = 0; i < x1n; i++ )
+		xhat[i] = db1[i];
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static Real_T ControlVariateMean( MasterSolver &master, Scenarios &Scen,
+		const Array<Real_T> &xhat, const Array<Real_T> &xev, const Int_T x1n,
+		Int_T batchSize, Int_T ObjScale )
+
+PURPOSE:
+	Pilot run of the control variate estimator of the gap. The control variate
+of a scenario is the cost of the candidate solution less the cost of the
+expected value solution; it shares the first term with the gap of the
+candidate. Its mean is estimated here on "DecompOpt.CV_Pilot" independent
+batches of "batchSize" scenarios (no sampled problem is solved, the two points
+are only evaluated).
+
+PARAMETERS:
+	MasterSolver &master
+		The master solver (after the first, optimal solution).
+
+	Scenarios &Scen
+		The scenario repository (regenerated here).
+
+	const Array<Real_T> &xhat, const Int_T x1n
+		The candidate solution and the number of the first stage variables.
+
+	const Array<Real_T> &xev
+		The expected value solution.
+
+	Int_T batchSize, Int_T ObjScale
+		Batch size and the decimal exponent of the objective scaling.
+
+RETURN VALUE:
+	The mean of the control variate (in the original objective scale).
+
+SIDE EFFECTS:
+	Consumes random numbers. Leaves the scenarios of the last pilot batch in
+"Scen".
+
+------------------------------------------------------------------------------*/
+
+static Real_T ControlVariateMean( MasterSolver &master, Scenarios &Scen, // )
+	const Array<Real_T> &xhat, const Array<Real_T> &xev, const Int_T x1n,
+	Int_T batchSize, Int_T ObjScale )
+{
+	Real_T mean = 0.0;
+
+	for( Int_T b = 0; b < DecompOpt.CV_Pilot; b++ )
+	{
+		RunStat.Start( RunStatistics::PH_GEN_SCEN );
+		Scen.ReGenerateScenarios( batchSize, batchSize );
+		RunStat.Stop( RunStatistics::PH_GEN_SCEN );
+
+		RunStat.Start( RunStatistics::PH_XHAT );
+		master.SetStartingPoint( xev, x1n );
+		master.SetiStop( 11 );
+		master.ReInit();
+		master.Solve();
+
+		master.SetStartingPoint( xhat, x1n );
+		master.SetiStop( 10 );
+		master.ReInit();
+		master.Solve();
+		RunStat.Stop( RunStatistics::PH_XHAT );
+
+		mean += master.CalculateControl();
+	}
+	mean *= pow( 10.0, ObjScale ) / DecompOpt.CV_Pilot;
+
+	if( DecompOpt.Verbosity >= V_LOW )
+		Print( "\nCONTROL VARIATE MEAN (%d PILOT BATCHES): %G\n",
+			(int) DecompOpt.CV_Pilot, (double) mean );
+
+	return mean;
+}
+
+
+//------------------------------------------------------------------------------
+//	The work of "PooledGapEstimate()": the samples "First", "First + Step",
+//	... are solved by "SolveSamples()" (a task for "RunInParallel()"). The
+//	results are stored in the shared memory.
+//
+struct SampleResult
+{
+	Real_T Zn, Gap, Var;		// Optimal value, gap estimate and variance of
+								// the individual scenario gaps.
+	Bool_T Feasible;			// Is the candidate feasible for the sample?
+};
+
+struct SampleWork
+{
+	MasterSolver *Master;
+	Scenarios *Scen;
+	StochSolution *Sol;
+	const Array<Real_T> *Start,	// Starting point of the solves and the
+		*Xhat;					// candidate solution.
+	Int_T x1n, SampleSize, Samples;
+	Real_T Scale;				// Objective scale factor.
+	MTRand::uint32 *State;		// [Samples*MTRand::SAVE] Generator states
+								// the samples are drawn from (NULL - one
+								// after another).
+	SampleResult *Res;			// [Samples] Results.
+};
+
+
+static void SolveSamples( void *Data, Int_T First, Int_T Step )
+{
+	SampleWork &w = *(SampleWork *) Data;
+	MasterSolver &master = *w.Master;
+
+	for( Int_T i = First; i < w.Samples; i += Step )
+	{
+		SampleResult &r = w.Res[i];
+
+		//----------------------------------------------------------------------
+		//	Only the first sample is solved with the output on (the output of
+		//	the solves done in parallel would be mixed).
+		//
+		if( i > 0 ) SetDefaultPrintOutput( NULL );
+
+		RunStat.Start( RunStatistics::PH_GEN_SCEN );
+		if( w.State != NULL )
+			Scenarios::SetBatchState( w.State + i * MTRand::SAVE );
+		w.Scen->ReGenerateScenarios( w.SampleSize, w.SampleSize );
+		RunStat.Stop( RunStatistics::PH_GEN_SCEN );
+
+		master.DropCommittee();
+		master.SetStartingPoint( *w.Start, w.x1n );
+		master.ReInit();
+		master.SetiStop( 0 );
+		RunStat.Start( RunStatistics::PH_SOLVE );
+		master.Solve();
+		RunStat.Stop( RunStatistics::PH_SOLVE );
+
+		master.FillSolution( w.Sol );
+		r.Zn = w.Sol->result * w.Scale;
+
+		RunStat.Start( RunStatistics::PH_XHAT );
+		r.Feasible = master.EvaluateCandidate( *w.Xhat, r.Gap, r.Var );
+		RunStat.Stop( RunStatistics::PH_XHAT );
+
+		r.Gap *= w.Scale;
+		r.Var *= w.Scale * w.Scale;
+
+		if( i > 0 ) SetDefaultPrintOutput( stdout );
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static Real_T PooledGapEstimate( MasterSolver &master, Scenarios &Scen,
+		StochSolution *sol, const Array<Real_T> &x1start,
+		const Array<Real_T> &xhat, const Int_T x1n, Int_T Samples,
+		Int_T SampleSize, Int_T ObjScale, Int_T Rep, double &gap,
+		double &var, double *zn )
+
+PURPOSE:
+	One replication of the single ("Samples == 1") or the averaged two-
+replication procedure ("Samples == 2") of Bayraksan and Morton. Each of the
+"Samples" independent samples of "SampleSize" scenarios is solved from
+"x1start" (without the cuts of the previous problem) and the candidate
+solution is evaluated on it (see "MasterSolver::EvaluateCandidate()"). The gap
+estimates and the sample variances of the individual scenario gaps are
+averaged. The upper confidence bound on the gap is then
+
+		G + z * sqrt( var / ( Samples * SampleSize ) ).
+
+	The samples are solved by "DecompOpt.RepProcs" processes. Their scenarios
+are drawn from the generator states they would start from in a serial run, so
+the samples do not depend on the number of processes. (The subproblems start
+from the bases of the previous solves done by the same process, so the
+estimates may differ slightly under degeneracy.)
+
+PARAMETERS:
+	MasterSolver &master
+		The master solver.
+
+	Scenarios &Scen
+		The scenario repository (regenerated here).
+
+	StochSolution *sol
+		Work solution object.
+
+	const Array<Real_T> &x1start, const Array<Real_T> &xhat,
+	const Int_T x1n
+		The starting point, the candidate solution and the number of the
+		first stage variables.
+
+	Int_T Samples, Int_T SampleSize
+		Number and size of the samples.
+
+	Int_T ObjScale
+		Decimal exponent of the objective scaling.
+
+	Int_T Rep
+		Number of the replication (for the run statistics).
+
+	double &gap, double &var
+		On return: the pooled gap estimate and variance.
+
+	double *zn
+		[Samples] On return: the optimal values of the sampled problems.
+
+RETURN VALUE:
+	The sum of the optimal values.
+
+SIDE EFFECTS:
+	Consumes random numbers. Writes one batch record per sample to the run
+statistics.
+
+------------------------------------------------------------------------------*/
+
+static Real_T PooledGapEstimate( MasterSolver &master, Scenarios &Scen, // )
+	StochSolution *sol, const Array<Real_T> &x1start,
+	const Array<Real_T> &xhat, const Int_T x1n, Int_T Samples,
+	Int_T SampleSize, Int_T ObjScale, Int_T Rep, double &gap, double &var,
+	double *zn )
+{
+	const Int_T Procs = Min( DecompOpt.RepProcs, Samples );
+	const Real_T scale = ObjScale ? pow( 10.0, ObjScale ) : 1.0;
+
+	MTRand::uint32 *State = NULL;
+	Real_T sum = 0.0;
+	Int_T i;
+
+	//--------------------------------------------------------------------------
+	//	Samples solved in parallel are drawn from the generator states of the
+	//	serial run (recorded here, together with the one the next replication
+	//	starts from).
+	//
+	if( Procs > 1 )
+	{
+		State = new MTRand::uint32[ ( Samples + 1 ) * MTRand::SAVE ];
+
+		RunStat.Start( RunStatistics::PH_GEN_SCEN );
+		for( i = 0; i < Samples; i++ )
+		{
+			Scenarios::GetBatchState( State + i * MTRand::SAVE );
+			Scen.ReGenerateScenarios( SampleSize, SampleSize );
+		}
+		Scenarios::GetBatchState( State + Samples * MTRand::SAVE );
+		RunStat.Stop( RunStatistics::PH_GEN_SCEN );
+	}
+
+	SampleResult *Res = (SampleResult *) AllocShared( Samples *
+		sizeof( SampleResult ), Procs );
+
+	if( Res == NULL ) FatalError( "Not enough memory for the sample results." );
+
+	SampleWork w;
+
+	w.Master		= &master;
+	w.Scen			= &Scen;
+	w.Sol			= sol;
+	w.Start			= &x1start;
+	w.Xhat			= &xhat;
+	w.x1n			= x1n;
+	w.SampleSize	= SampleSize;
+	w.Samples		= Samples;
+	w.Scale			= scale;
+	w.State			= State;
+	w.Res			= Res;
+	RunInParallel( SolveSamples, &w, Procs );
+
+	if( State != NULL )
+	{
+		Scenarios::SetBatchState( State + Samples * MTRand::SAVE );
+		Random01::ReSeed( State + Samples * MTRand::SAVE );
+		delete [] State;
+	}
+
+	//--------------------------------------------------------------------------
+	//	Pool the estimates.
+	//
+	gap = var = 0.0;
+	for( i = 0; i < Samples; i++ )
+	{
+		const SampleResult &r = Res[i];
+
+		if( !r.Feasible )
+			Warning( "The candidate solution is infeasible for sample %d.",
+				(int) i+1 );
+
+		Print( "sample[%d] = %lf, gap %lf, var %lf\n", (int) i, r.Zn, r.Gap,
+			r.Var );
+
+		zn[i] = r.Zn;
+		sum += r.Zn;
+		gap += r.Gap;
+		var += r.Var;
+
+		RunStat.SetValue( RunStatistics::VAL_OBJECTIVE, r.Zn );
+		RunStat.SetValue( RunStatistics::VAL_GAP, r.Gap );
+		RunStat.SetValue( RunStatistics::VAL_VARIANCE, r.Var );
+		RunStat.Record( RunStatistics::LV_BATCH, Rep, i );
+	}
+	gap /= Samples;
+	var /= Samples;
+
+	FreeShared( Res, Samples * sizeof( SampleResult ), Procs );
+
+	return sum;
+}
+
+
+//------------------------------------------------------------------------------
+//	Data of the subsamples of the jackknife solved by each process (see
+//	"JackknifeGap()").
+//
+struct JackknifeWork
+{
+	MasterSolver *Master;
+	StochSolution *Sol;
+	const Array<Real_T> *Start;	// Starting point of the solves.
+	const Real_T *Prob;			// [SampleSize] Scenario weights.
+	Int_T x1n, SampleSize, Groups;
+	Real_T Scale;				// Objective scale factor.
+	Real_T *Zn;					// [Groups] Optimal values of the subsamples
+	Bool_T *Optimal;			// and whether the solves reached them.
+};
+
+
+//	The group of scenario "c" (the groups are contiguous and differ in size
+//	by at most one scenario).
+static inline Int_T JackknifeGroup( Int_T c, Int_T SampleSize, Int_T Groups )
+{ return ( c * Groups ) / SampleSize; }
+
+
+static void SolveSubsamples( void *Data, Int_T First, Int_T Step )
+{
+	JackknifeWork &w = *(JackknifeWork *) Data;
+	MasterSolver &master = *w.Master;
+
+	for( Int_T j = First; j < w.Groups; j += Step )
+	{
+		Real_T left = 0.0;
+		Int_T c;
+
+		//----------------------------------------------------------------------
+		//	The scenarios of group "j" get zero weight, the weights of the
+		//	others are scaled to sum up to one.
+		//
+		for( c = 0; c < w.SampleSize; c++ )
+			if( JackknifeGroup( c, w.SampleSize, w.Groups ) != j )
+				left += w.Prob[c];
+		for( c = 0; c < w.SampleSize; c++ )
+			master.SetWeight( c,
+				( JackknifeGroup( c, w.SampleSize, w.Groups ) == j ) ?
+				0.0 : w.Prob[c] / left );
+
+		//----------------------------------------------------------------------
+		//	Each subsample starts from the batch optimum and its cuts. The
+		//	solves print nothing (those done in parallel would be mixed).
+		//
+		SetDefaultPrintOutput( NULL );
+		master.ReuseCommittee( 0 );
+		master.SetStartingPoint( *w.Start, w.x1n );
+		master.ReInit();
+		master.SetiStop( 0 );
+		RunStat.Start( RunStatistics::PH_SOLVE );
+		master.Solve();
+		RunStat.Stop( RunStatistics::PH_SOLVE );
+		SetDefaultPrintOutput( stdout );
+
+		master.FillSolution( w.Sol );
+		w.Zn[j] = w.Sol->result * w.Scale;
+		w.Optimal[j] = Bool_T( master.GetiStop() == 2 );
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static Real_T JackknifeGap( MasterSolver &master,
+		const StochSolution *sol, const Int_T x1n, Int_T SampleSize,
+		Int_T Groups, Int_T ObjScale, double gap )
+
+PURPOSE:
+	The delete-a-group jackknife estimate of the optimality gap of the
+candidate solution on one MRP batch. The optimal value "zn" of the sampled
+problem is biased downwards (and the gap estimate "gap" upwards). The sample is
+divided into "Groups" groups of scenarios and the problem is re-solved without
+each of them in turn (the scenarios of the group get zero weight). With
+"G(j)" the gap estimate of the subsample without group "j" (its cost of the
+candidate less its optimal value) the corrected estimate is
+
+		Groups * gap - ( Groups - 1 ) * ( G(1) + ... + G(Groups) ) / Groups.
+
+	The subsamples are solved from the batch optimum and the cuts kept after
+its solution (see "MasterSolver::ReuseCommittee()"), by "DecompOpt.RepProcs"
+processes. Past the first sweep the subproblems of the left-out group are not
+solved again (see "SolveBlocks()"). The costs of the candidate are those of the
+batch evaluation.
+	A subsample solve stopped short of the optimum (by the iteration limit)
+would overestimate its gap, and so inflate the correction. Then the batch is
+not corrected.
+
+PARAMETERS:
+	MasterSolver &master
+		The master solver, right after the evaluation of the candidate on the
+		batch, with the cuts of the batch solution kept (the scenario weights
+		are restored on return).
+
+	const StochSolution *sol
+		The batch solution (scaled).
+
+	const Int_T x1n
+		The number of the first stage variables.
+
+	Int_T SampleSize, Int_T Groups
+		The batch size and the number of the groups.
+
+	Int_T ObjScale
+		Decimal exponent of the objective scaling.
+
+	double gap
+		The gap estimate of the batch (scaled).
+
+RETURN VALUE:
+	The corrected gap estimate ("gap" if a subsample was not solved to
+optimality).
+
+SIDE EFFECTS:
+	The master holds the last subsample solution.
+
+------------------------------------------------------------------------------*/
+
+static Real_T JackknifeGap( MasterSolver &master, // )
+	const StochSolution *sol, const Int_T x1n, Int_T SampleSize,
+	Int_T Groups, Int_T ObjScale, double gap )
+{
+	assert( Groups > 1 && Groups <= SampleSize );
+
+	const Int_T Procs = Min( DecompOpt.RepProcs, Groups );
+	const Real_T scale = ObjScale ? pow( 10.0, ObjScale ) : 1.0;
+
+	Array<Real_T> start( x1n, 0.0 ), Prob( SampleSize, 0.0 ),
+		cost( Groups, 0.0 ), weight( Groups, 0.0 );
+	StochSolution jsol( SampleSize + 1, x1n );
+	Real_T TotalCost = 0.0, TotalWeight = 0.0;
+	Int_T c, j;
+
+	//--------------------------------------------------------------------------
+	//	The cost of the candidate on each subsample: the probability weighted
+	//	cost of the scenarios left in (all less those of the group) and the
+	//	first stage cost.
+	//
+	for( c = 0; c < x1n; c++ )
+		start[c] = sol->x[c];
+
+	for( c = 0; c < SampleSize; c++ )
+	{
+		j = JackknifeGroup( c, SampleSize, Groups );
+		Prob[c] = master.GetWeight( c );
+		cost[j] += Prob[c] * master.GetExpC( c );
+		weight[j] += Prob[c];
+	}
+	for( j = 0; j < Groups; j++ )
+	{
+		TotalCost += cost[j];
+		TotalWeight += weight[j];
+	}
+	for( j = 0; j < Groups; j++ )
+		cost[j] = ( TotalCost - cost[j] ) / ( TotalWeight - weight[j] ) +
+			master.GetExpC( SampleSize );
+
+	Real_T *Zn = (Real_T *) AllocShared( Groups * sizeof( Real_T ), Procs );
+	Bool_T *Optimal = (Bool_T *) AllocShared( Groups * sizeof( Bool_T ),
+		Procs );
+
+	if( Zn == NULL || Optimal == NULL )
+		FatalError( "Not enough memory for the jackknife." );
+
+	JackknifeWork w;
+
+	w.Master		= &master;
+	w.Sol			= &jsol;
+	w.Start			= &start;
+	w.Prob			= Prob.start;
+	w.x1n			= x1n;
+	w.SampleSize	= SampleSize;
+	w.Groups		= Groups;
+	w.Scale			= scale;
+	w.Zn			= Zn;
+	w.Optimal		= Optimal;
+	RunInParallel( SolveSubsamples, &w, Procs );
+
+	for( c = 0; c < SampleSize; c++ )
+		master.SetWeight( c, Prob[c] );
+
+	//--------------------------------------------------------------------------
+	//	The average gap estimate of the subsamples.
+	//
+	Real_T sum = 0.0;
+	Bool_T solved = True;
+
+	for( j = 0; j < Groups; j++ )
+	{
+		sum += cost[j] * scale - Zn[j];
+		if( !Optimal[j] )
+		{
+			Warning( "Jackknife subsample %d not solved to optimality; the "
+				"batch gap is not corrected.", (int) j+1 );
+			solved = False;
+		}
+	}
+
+	FreeShared( Zn, Groups * sizeof( Real_T ), Procs );
+	FreeShared( Optimal, Groups * sizeof( Bool_T ), Procs );
+
+	return solved ? Groups * gap - ( Groups - 1 ) * sum / Groups : gap;
+}
+
+
 void PrintSubproblemStatistics( const Solver &s )
 {
 	Print(
@@ -1119,6 +2307,67 @@ static DeterministicLP *ReadDeterministicLP( void )
 }
 
 
+/*------------------------------------------------------------------------------
+
+	static DeterministicLP *ReadCachedProblem( Scenarios *&Scen,
+		Int_T &Stage1Row, Int_T &Stage1Col, Int_T &Stage2Row,
+		Int_T &Stage2Col )
+
+PURPOSE:
+	Reads the deterministic LP, its division into stages and the distributions
+from the problem cache file (see "probcach.h"). Failure is not an error: the
+cache may not exist yet or may be out of date. The input files are read then
+(and the cache is rewritten).
+
+PARAMETERS:
+	Scenarios *&Scen
+		"Return value" - the scenario repository object with all distributions
+		read in (and no scenarios generated), or NULL on failure.
+
+	Int_T &Stage1Row, Int_T &Stage1Col, Int_T &Stage2Row, Int_T &Stage2Col
+		"Return values" - they define LP division into stages.
+
+RETURN VALUE:
+	Deterministic LP object pointer on success, NULL pointer on failure.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static DeterministicLP *ReadCachedProblem( Scenarios *&Scen, // )
+	Int_T &Stage1Row, Int_T &Stage1Col, Int_T &Stage2Row, Int_T &Stage2Col )
+{
+	if( DecompOpt.Verbosity >= V_LOW )
+		Print( "\nREADING THE PROBLEM CACHE..." );
+
+	DeterministicLP *LP = new DeterministicLP;
+	Scen = ( DecompOpt.Restart == RD_SubproblemManager::TREE ) ?
+		new TreeOfScenarios : new Scenarios;
+
+	if( LP == NULL || Scen == NULL ) FatalError( "Out of memory." );
+
+	if( !ReadProblemCache( DecompOpt.CacheFile, DecompOpt.CoreFile,
+		DecompOpt.TimeFile, DecompOpt.StochFile, *LP, Stage1Row, Stage1Col,
+		Stage2Row, Stage2Col, *Scen ) || LP->GetCostRow() < 0 )
+	{
+		delete LP;
+		delete Scen;
+		LP = NULL;
+		Scen = NULL;
+
+		if( DecompOpt.Verbosity >= V_LOW )
+			Print( "MISSING OR OUT OF DATE.\n" );
+		return NULL;
+	}
+
+	if( DecompOpt.Verbosity >= V_LOW )
+		Print( "DONE.\n" );
+
+	return LP;
+}
+
+
 /*------------------------------------------------------------------------------
 
 	static Bool_T ReadTimeFile( MPS_LP &LP, Int_T &Stage1Row, Int_T &Stage1Col, 
@@ -1173,15 +2422,33 @@ static Bool_T ReadTimeFile( MPS_LP &LP, Int_T &Stage1Row, Int_T &Stage1Col, // )
 /*------------------------------------------------------------------------------
 
 	static Scenarios *ReadAndGenerateScenarios( DeterministicLP &LP,
-		TimeInfo &TI )
+		Scenarios *Scen, Bool_T Background, TimeInfo &TI, Int_T Stage1Row,
+		Int_T Stage1Col, Int_T Stage2Row, Int_T Stage2Col )
 
 PURPOSE:
 	This function opens the file (name stored in the "DecompOpt" structure.
+If the distributions were already read from the problem cache, the file is not
+read again. If a background reader was started for the file, the distributions
+are collected from it. Otherwise, when a cache file name was given, the cache is
+written after the file is read.
 
 PARAMETERS:
 	DeterministicLP &LP
 		Deterministic LP structure.
 
+	Scenarios *Scen
+		Scenario repository read from the problem cache or NULL.
+
+	Bool_T Background
+		True if the file is being read by a background process (see
+		"StartStochReader()").
+
+	TimeInfo &TI
+		Time information object.
+
+	Int_T Stage1Row, Int_T Stage1Col, Int_T Stage2Row, Int_T Stage2Col
+		LP division into stages (only stored in the problem cache).
+
 RETURN VALUE:
 	A pointer to created scenario repository object, or NULL if the attempt to
 create the object failed.
@@ -1191,34 +2458,68 @@ SIDE EFFECTS:
 
 ------------------------------------------------------------------------------*/
 
-static Scenarios *ReadAndGenerateScenarios( DeterministicLP &LP, TimeInfo &TI )
+static Scenarios *ReadAndGenerateScenarios( DeterministicLP &LP, // )
+	Scenarios *Scen, Bool_T Background, TimeInfo &TI, Int_T Stage1Row,
+	Int_T Stage1Col, Int_T Stage2Row, Int_T Stage2Col )
 {
-	//--------------------------------------------------------------------------
-	//	Create an appropriate scenario repository object.
-	//
-	Scenarios *Scen = ( DecompOpt.Restart == RD_SubproblemManager::TREE ) ?
-		new TreeOfScenarios : new Scenarios;
-
-	if( Scen == NULL ) FatalError( "Out of memory." );
-
-	//--------------------------------------------------------------------------
-	//	Open, read and then close the file.
-	//
-	if( DecompOpt.Verbosity >= V_LOW )
-		Print( "\nREADING THE STOCH FILE AND GENERATING SCENARIOS..." );
+	Bool_T Success = True;
 
-	FILE *fp = fopen( DecompOpt.StochFile, "r"  );
-	if( !fp ) FatalError( "Unable to open stoch file %s.", DecompOpt.StochFile );
-
-	Bool_T Success = Scen->ReadScenarioFile( DecompOpt.StochFile, fp, LP );
+	if( Scen == NULL )
+	{
+		//----------------------------------------------------------------------
+		//	Create an appropriate scenario repository object.
+		//
+		Scen = ( DecompOpt.Restart == RD_SubproblemManager::TREE ) ?
+			new TreeOfScenarios : new Scenarios;
+
+		if( Scen == NULL ) FatalError( "Out of memory." );
+
+		//----------------------------------------------------------------------
+		//	Open, read and then close the file (or collect the distributions
+		//	from the background reader).
+		//
+		if( DecompOpt.Verbosity >= V_LOW )
+			Print( "\nREADING THE STOCH FILE AND GENERATING SCENARIOS..." );
+
+		if( Background )
+			Success = FinishStochReader( *Scen );
+		else
+		{
+			FILE *fp = fopen( DecompOpt.StochFile, "r"  );
+			if( !fp )
+				FatalError( "Unable to open stoch file %s.",
+					DecompOpt.StochFile );
+
+			Success = Scen->ReadScenarioFile( DecompOpt.StochFile, fp, LP );
+			fclose( fp );
+		}
+
+		//----------------------------------------------------------------------
+		//	Store the data in the problem cache (if requested).
+		//
+		if( Success && *DecompOpt.CacheFile &&
+			!WriteProblemCache( DecompOpt.CacheFile, DecompOpt.CoreFile,
+				DecompOpt.TimeFile, DecompOpt.StochFile, LP, Stage1Row,
+				Stage1Col, Stage2Row, Stage2Col, *Scen ) )
+			Warning( "Unable to write the problem cache file %s.",
+				DecompOpt.CacheFile );
+	}
+	else if( DecompOpt.Verbosity >= V_LOW )
+		Print( "\nGENERATING SCENARIOS..." );
 	TI.MarkTime( TI_READ_SCEN );
 
 	if( Success )
+	{
+		Scen->SetSampling( DecompOpt.Sampling, DecompOpt.Antithetic );
+		if( DecompOpt.Restart == RD_SubproblemManager::TREE )
+			( (TreeOfScenarios *) Scen )->SetProcesses( DecompOpt.DistProcs );
 		Success = Scen->GenerateScenarios( DecompOpt.ScenNum );
+	}
+	if( Success && DecompOpt.ReduceTo > 0 )
+		Success = Scen->ReduceScenarios( DecompOpt.ReduceTo,
+			DecompOpt.ReduceDist, DecompOpt.DistProcs );
 	TI.MarkTime( TI_GEN_SCEN );
 
-	fclose( fp );
-
 	if( Success == False )
 	{
 		delete Scen;
@@ -1232,8 +2533,9 @@ static Scenarios *ReadAndGenerateScenarios( DeterministicLP &LP, TimeInfo &TI )
 }
 
 
-static Bool_T RD_Crash( const DeterministicLP &DetermLP, Spc &SPC, // )
-	Array<Real_T> &x1, const Int_T x1n )
+static Bool_T RD_Crash( DeterministicLP &DetermLP, Spc &SPC, // )
+	Array<Real_T> &x1, const Int_T x1n, Array<Int_T> &ColStat,
+	Array<Int_T> &RowStat, Bool_T &BasisFound )
 {
 	if( DecompOpt.Verbosity >= V_LOW )
 		Print( "\nRUNNING RD CRASH (a deterministic LP solution)..." );
@@ -1281,6 +2583,36 @@ static Bool_T RD_Crash( const DeterministicLP &DetermLP, Spc &SPC, // )
 	x1.Copy( sol->x, sol->GetAllocN(), x1n, x1n );
 	delete sol;
 
+	//--------------------------------------------------------------------------
+	//	Store the optimal basis, expressed in terms of the rows and columns of
+	//	the deterministic LP (the crash LP lacks the objective row).
+	//
+	if( SolverStatus == SR_OPTIMUM && DecompOpt.CrashBasis )
+	{
+		Int_T n = OneScenLP.GetStructN(),
+			m = OneScenLP.GetM(),
+			i, k;
+		Array<Int_T> Cols( n ), Rows( m );
+
+		Solv.GetBasisStatus( Cols, Rows );
+
+		assert( n == DetermLP.GetN() );
+		ColStat.Resize( n );
+		ColStat.Copy( Cols, n, n );
+
+		SortedArrayOfLabels &CrashRowLabels	= OneScenLP.RevealRowLabels(),
+			&RowLabels						= DetermLP.RevealRowLabels();
+
+		RowStat.Resize( DetermLP.GetM() );
+		RowStat.Fill( A2B_UNDEF, DetermLP.GetM() );
+		for( i = 0; i < m; i++ )
+			if( ( k = RowLabels.FindLabel( CrashRowLabels.FindLabel( i ) ) )
+				>= 0 )
+				RowStat[k] = Rows[i];
+
+		BasisFound = True;
+	}
+
 	//--------------------------------------------------------------------------
 	//	Return the success status.
 	//
@@ -1289,3 +2621,128 @@ static Bool_T RD_Crash( const DeterministicLP &DetermLP, Spc &SPC, // )
 	return True;
 }
 
+
+/*------------------------------------------------------------------------------
+
+	static Bool_T RD_ExpectedValue( DeterministicLP &DetermLP,
+		Scenarios &Scen, Spc &SPC, Array<Real_T> &x1, const Int_T x1n )
+
+PURPOSE:
+	Solves the expected value problem: the deterministic LP with all random data
+replaced by their expected values. Must be called before the random data are
+zeroed and before the indice in the scenarios are renumbered.
+
+PARAMETERS:
+	DeterministicLP &DetermLP, Scenarios &Scen
+		The deterministic LP and the scenarios read for it.
+
+	Spc &SPC
+		Simplex optimizer settings.
+
+	Array<Real_T> &x1, const Int_T x1n
+		On success the first stage part of the solution.
+
+RETURN VALUE:
+	"True" if the expected value problem was solved to optimality.
+
+SIDE EFFECTS:
+	The random data in "DetermLP" are overwritten.
+
+------------------------------------------------------------------------------*/
+
+static Bool_T RD_ExpectedValue( DeterministicLP &DetermLP, Scenarios &Scen, // )
+	Spc &SPC, Array<Real_T> &x1, const Int_T x1n )
+{
+	if( DecompOpt.Verbosity >= V_LOW )
+		Print( "\nSOLVING THE EXPECTED VALUE PROBLEM..." );
+
+	Scen.SetExpectedValues( DetermLP );
+
+	SimplexLP EV_LP;
+
+	if( ! EV_LP.CreateAsSubmatrix( DetermLP, 0, DetermLP.GetM(), 0,
+		DetermLP.GetN(), DetermLP.GetCostRow() ) )
+	{
+		Warning( "Problems creating the expected value LP." );
+		return False;
+	}
+
+	EV_LP.ScaleLP( V_NONE );
+	EV_LP.ToStandard( V_NONE );
+
+	Solver Solv( EV_LP, SPC );
+
+	Solv.InitializeSolver( V_NONE );
+	if( Solv.Solve( V_NONE ) != SR_OPTIMUM )
+	{
+		if( DecompOpt.Verbosity >= V_LOW )
+			Print( " NOT SOLVED. Using the crash point.\n" );
+		return False;
+	}
+
+	Solution *sol = Solv.GetSolution( Solution::Primal, False );
+	EV_LP.ProcessSolution( *sol );
+
+	x1.Copy( sol->x, sol->GetAllocN(), x1n, x1n );
+	delete sol;
+
+	if( DecompOpt.Verbosity >= V_LOW )
+		Print( "DONE!\n" );
+	return True;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static void MapCrashBasis( DeterministicLP &DetermLP, RD_SubproblemLP &W,
+		const Array<Int_T> &ColStat, const Array<Int_T> &RowStat,
+		Array<Int_T> &Cols, Array<Int_T> &Rows )
+
+PURPOSE:
+	Extracts the second stage part of the crash LP optimal basis. The rows and
+columns of the second stage LP are matched with those of the deterministic LP by
+their labels (which remain valid after the second stage LP is presolved).
+
+PARAMETERS:
+	DeterministicLP &DetermLP, RD_SubproblemLP &W
+		The deterministic LP and the second stage LP.
+
+	const Array<Int_T> &ColStat, const Array<Int_T> &RowStat
+		Status of the columns and rows of the deterministic LP (as computed by
+		"RD_Crash()").
+
+	Array<Int_T> &Cols, Array<Int_T> &Rows
+		On exit: status of the structural columns and rows of 'W'.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static void MapCrashBasis( DeterministicLP &DetermLP, RD_SubproblemLP &W, // )
+	const Array<Int_T> &ColStat, const Array<Int_T> &RowStat,
+	Array<Int_T> &Cols, Array<Int_T> &Rows )
+{
+	Int_T n = W.GetStructN(),
+		m = W.GetM(),
+		i, k;
+
+	SortedArrayOfLabels &ColLabels	= DetermLP.RevealColumnLabels(),
+		&RowLabels					= DetermLP.RevealRowLabels(),
+		&SubColLabels				= W.RevealColumnLabels(),
+		&SubRowLabels				= W.RevealRowLabels();
+
+	Cols.Resize( n );
+	for( i = 0; i < n; i++ )
+		Cols[i] = ( ( k = ColLabels.FindLabel( SubColLabels.FindLabel( i ) ) )
+			>= 0 ) ? ColStat[k] : A2B_UNDEF;
+
+	Rows.Resize( m );
+	for( i = 0; i < m; i++ )
+		Rows[i] = ( ( k = RowLabels.FindLabel( SubRowLabels.FindLabel( i ) ) )
+			>= 0 ) ? RowStat[k] : A2B_UNDEF;
+}
+
@@ -38,6 +38,12 @@ HEADER CONTENTS:
 #ifndef __PARSESPC_H__
 #	include "parsespc.h"
 #endif
+#ifndef __RUN_STAT_H__
+#	include "run_stat.h"
+#endif
+#ifndef __SAMPLER_H__
+#	include "sampler.h"
+#endif
 
 
 //==============================================================================
@@ -75,17 +81,96 @@ public:
 	Int_T ScenNum;
 	Bool_T AllScen;
 
-	FileName CoreFile, TimeFile, StochFile, SolutionFile;
+	FileName CoreFile, TimeFile, StochFile, SolutionFile, CacheFile;
 
 	RD_SubproblemManager::RestartMode Restart;
 
 	VerbLevel Verbosity;
 
 	PricingScheme Pricing;
+	Bool_T KeepWeights;		// Keep the steepest edge weights on restarts.
 
 	Bool_T DoCrash;
+	Bool_T CrashBasis;		// Start the subproblems from the second stage
+							// part of the crash LP optimal basis.
 	Real_T InitPen;
 
+	Bool_T ScaleSub;		// Scale the second stage LP once, before solution.
+	Bool_T PresolveSub;		// Presolve the second stage LP once (only the
+							// reductions valid for all scenarios).
+
+	Bool_T EV_Start;		// Start the first batch of each replication from
+							// the expected value problem solution (or else
+							// from the crash point).
+	FileName StartFile;		// The starting point of the first batch (if
+							// given; overrides "EV_Start").
+	Bool_T KeepCuts;		// Pass the final penalty and the active cuts of
+							// the overlapping scenarios on to the next batch.
+	Bool_T ParallelRead;	// Read the stoch file in a background process
+							// while the crash LP is solved.
+
+	FileName StatsFile;		// Timings and counters of the run are written
+							// to this file (if given) in this format.
+	RunStatistics::Format StatsFormat;
+
+	Bool_T SeqSampling;		// Sequential sampling: after the first solution
+							// grow the sample by the factor "SeqGrowth" (up
+							// to "SeqMax" scenarios) until the confidence
+							// bound on the gap of the previous solution is
+							// at most "SeqEps" (relative to the objective).
+	Int_T SeqMax;
+	Real_T SeqGrowth, SeqEps;
+
+	UniformSampler::Method Sampling;	// Source of the uniform numbers of
+							// the scenario sample: Monte Carlo, Latin
+							// hypercube or scrambled Sobol' points.
+	Bool_T Antithetic;		// Sample the scenarios in antithetic pairs.
+
+	Bool_T ControlVariate;	// Correct the MRP gap estimates with the
+							// control variate (cost of xhat less the cost of
+							// the expected value solution), whose mean is
+							// estimated on "CV_Pilot" batches.
+	Int_T CV_Pilot;
+
+	FileName CheckpointFile;	// The results of the MRP replications and the
+							// generator states are written to this file (if
+							// given) every "CheckpointEvery" replications.
+	Int_T CheckpointEvery;
+	Bool_T Resume;			// Go on with the run saved in the checkpoint
+							// file.
+
+	Real_T CoverageHW;		// Stop the MRP (after at least "MinReplications"
+							// replications) when the half-width of the
+							// confidence interval on the coverage is at most
+							// this (0 - always do all the replications).
+	Int_T MinReplications;
+
+	Int_T ReduceTo;			// Reduce the scenarios to this many (0 - no
+							// reduction) by the fast forward selection with
+							// the distance "ReduceDist".
+	Scenario::DistanceMode ReduceDist;
+	Int_T DistProcs;		// Number of processes computing the scenario
+							// distances (for the reduction and the tree of
+							// scenarios).
+
+	FileName XhatFile;		// The first stage values of the candidate
+							// solution whose optimality gap is estimated
+	Real_T XhatGap;			// (if not given: the built-in db1 point) and
+							// its true gap (for the coverage; negative - not
+							// given, which is only allowed for db1).
+
+	enum GapProcedure { MRP, SRP, A2RP };
+	GapProcedure Procedure;	// Procedure estimating the optimality gap of
+							// the candidate solution: multiple, single or
+							// averaged two-replication procedure.
+	Int_T RepProcs;			// Number of processes solving the samples of
+							// an A2RP replication (or the subsamples of the
+							// jackknife).
+	Int_T JackknifeGroups;	// Correct the bias of the MRP batch gap
+							// estimates by the jackknife, leaving out each
+							// of this many groups of scenarios in turn (0 -
+							// no correction).
+
         // David Love -- Added the parameter gamma
         Int_T NonOverlap;
         // David Love -- Added to read replication from command line
@@ -101,9 +186,22 @@ public:
 inline
 DecompOptions::DecompOptions( void )
 	: ScenNum( 0 ), AllScen( False ), Restart( RD_SubproblemManager::SELF ),
-	Verbosity( V_LOW ), Pricing( PRS_ASE ), DoCrash( True ), InitPen( 1 ),
+	Verbosity( V_LOW ), Pricing( PRS_ASE ),
+	KeepWeights( True ), DoCrash( True ), CrashBasis( True ),
+	InitPen( 1 ),
+	ScaleSub( True ), PresolveSub( False ), EV_Start( True ),
+	KeepCuts( True ), ParallelRead( False ), StatsFormat( RunStatistics::CSV ),
+	SeqSampling( False ), SeqMax( 0 ), SeqGrowth( 2.0 ), SeqEps( 1.0e-3 ),
+	Sampling( UniformSampler::MC ), Antithetic( False ),
+	ControlVariate( False ), CV_Pilot( 10 ), CheckpointEvery( 1 ),
+	Resume( False ), CoverageHW( 0.0 ), MinReplications( 30 ),
+	ReduceTo( 0 ), ReduceDist( Scenario::STD_NORM ), DistProcs( 1 ),
+	XhatGap( -1.0 ), Procedure( MRP ), RepProcs( 1 ), JackknifeGroups( 0 ),
         NonOverlap( 0 )
-{ *CoreFile = *StochFile = *TimeFile = *SolutionFile = '\0'; }
+{
+	*CoreFile = *StochFile = *TimeFile = *SolutionFile = *CacheFile =
+		*StatsFile = *CheckpointFile = *XhatFile = *StartFile = '\0';
+}
 
 //For L-shaped, set InitPen (1e-6)
 
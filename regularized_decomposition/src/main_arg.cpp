@@ -64,12 +64,44 @@ static void SetCoreFile( const char *argument );
 static void SetTimeFile( const char *argument );
 static void SetStochFile( const char *argument );
 static void SetSolutionFile( const char *argument );
+static void SetCacheFile( const char *argument );
 static void SetRestartMode( const char *argument );
 static void SetProblem( const char *argument );
 static void SetVerbosity( const char *argument );
 static void SetPricingMode( const char *argument );
+static void SetKeepWeights( const char *argument );
 static void SetCrashType( const char *argument );
+static void SetCrashBasis( const char *argument );
 static void SetInitialPenalty( const char *argument );
+static void SetSubproblemScaling( const char *argument );
+static void SetSubproblemPresolve( const char *argument );
+static void SetEV_Start( const char *argument );
+static void SetStartFile( const char *argument );
+static void SetKeepCuts( const char *argument );
+static void SetParallelRead( const char *argument );
+static void SetStatsFile( const char *argument );
+static void SetStatsFormat( const char *argument );
+static void SetSeqSampling( const char *argument );
+static void SetSeqMax( const char *argument );
+static void SetSeqGrowth( const char *argument );
+static void SetSeqEps( const char *argument );
+static void SetSampling( const char *argument );
+static void SetAntithetic( const char *argument );
+static void SetControlVariate( const char *argument );
+static void SetCV_Pilot( const char *argument );
+static void SetCheckpointFile( const char *argument );
+static void SetCheckpointEvery( const char *argument );
+static void SetResume( const char *argument );
+static void SetCoverageHW( const char *argument );
+static void SetMinReplications( const char *argument );
+static void SetReduceTo( const char *argument );
+static void SetReduceDist( const char *argument );
+static void SetDistProcs( const char *argument );
+static void SetXhatFile( const char *argument );
+static void SetXhatGap( const char *argument );
+static void SetProcedure( const char *argument );
+static void SetRepProcs( const char *argument );
+static void SetJackknifeGroups( const char *argument );
 // David Love -- get gamma from the input
 static void SetNonOverlap( const char *argument );
 // David Love -- get number of replications from input
@@ -99,6 +131,7 @@ Bool_T ParseArguments( int argc, char *argv[], DecompOptions &opt )
 	Cfg.AddOption( new OptionWithArgument(	"tim",		SetTimeFile ) );
 	Cfg.AddOption( new OptionWithArgument(	"sto",		SetStochFile ) );
 	Cfg.AddOption( new OptionWithArgument(	"txt_sol",	SetSolutionFile ) );
+	Cfg.AddOption( new OptionWithArgument(	"cache",	SetCacheFile ) );
 	Cfg.AddOption( new OptionWithArgument(	"problem",	SetProblem ) );
 	Cfg.AddOption( new Argument(						SetProblem ) );
 	Cfg.AddOption( new OptionWithArgument(	"s",		SetScenarioNumber ) );
@@ -106,8 +139,39 @@ Bool_T ParseArguments( int argc, char *argv[], DecompOptions &opt )
 	Cfg.AddOption( new OptionWithArgument(	"restart",	SetRestartMode ) );
 	Cfg.AddOption( new OptionWithArgument(	"v",		SetVerbosity ) );
 	Cfg.AddOption( new OptionWithArgument(	"pric",		SetPricingMode ) );
+	Cfg.AddOption( new OptionWithArgument(	"se_keep",	SetKeepWeights ) );
 	Cfg.AddOption( new OptionWithArgument(	"crash",	SetCrashType ) );
+	Cfg.AddOption( new OptionWithArgument(	"crash_basis",	SetCrashBasis ) );
 	Cfg.AddOption( new OptionWithArgument(	"penalty",	SetInitialPenalty ) );
+	Cfg.AddOption( new OptionWithArgument(	"sub_scale",	SetSubproblemScaling ) );
+	Cfg.AddOption( new OptionWithArgument(	"sub_presolve",	SetSubproblemPresolve ) );
+	Cfg.AddOption( new OptionWithArgument(	"ev_start",	SetEV_Start ) );
+	Cfg.AddOption( new OptionWithArgument(	"start",	SetStartFile ) );
+	Cfg.AddOption( new OptionWithArgument(	"keep_cuts",	SetKeepCuts ) );
+	Cfg.AddOption( new OptionWithArgument(	"par_read",	SetParallelRead ) );
+	Cfg.AddOption( new OptionWithArgument(	"stats",	SetStatsFile ) );
+	Cfg.AddOption( new OptionWithArgument(	"stats_fmt",	SetStatsFormat ) );
+	Cfg.AddOption( new OptionWithArgument(	"seq",		SetSeqSampling ) );
+	Cfg.AddOption( new OptionWithArgument(	"seq_max",	SetSeqMax ) );
+	Cfg.AddOption( new OptionWithArgument(	"seq_growth",	SetSeqGrowth ) );
+	Cfg.AddOption( new OptionWithArgument(	"seq_eps",	SetSeqEps ) );
+	Cfg.AddOption( new OptionWithArgument(	"sampling",	SetSampling ) );
+	Cfg.AddOption( new OptionWithArgument(	"antithetic",	SetAntithetic ) );
+	Cfg.AddOption( new OptionWithArgument(	"cv",		SetControlVariate ) );
+	Cfg.AddOption( new OptionWithArgument(	"cv_pilot",	SetCV_Pilot ) );
+	Cfg.AddOption( new OptionWithArgument(	"checkpoint",	SetCheckpointFile ) );
+	Cfg.AddOption( new OptionWithArgument(	"ckpt_every",	SetCheckpointEvery ) );
+	Cfg.AddOption( new OptionWithArgument(	"resume",	SetResume ) );
+	Cfg.AddOption( new OptionWithArgument(	"cov_hw",	SetCoverageHW ) );
+	Cfg.AddOption( new OptionWithArgument(	"min_reps",	SetMinReplications ) );
+	Cfg.AddOption( new OptionWithArgument(	"reduce",	SetReduceTo ) );
+	Cfg.AddOption( new OptionWithArgument(	"red_dist",	SetReduceDist ) );
+	Cfg.AddOption( new OptionWithArgument(	"dist_procs",	SetDistProcs ) );
+	Cfg.AddOption( new OptionWithArgument(	"xhat",		SetXhatFile ) );
+	Cfg.AddOption( new OptionWithArgument(	"xhat_gap",	SetXhatGap ) );
+	Cfg.AddOption( new OptionWithArgument(	"procedure",	SetProcedure ) );
+	Cfg.AddOption( new OptionWithArgument(	"rep_procs",	SetRepProcs ) );
+	Cfg.AddOption( new OptionWithArgument(	"jackknife",	SetJackknifeGroups ) );
         // David Love -- Get the value of gamma NonOverlap
 	Cfg.AddOption( new OptionWithArgument(	"g",	        SetNonOverlap ) );
         // David Love -- Get the number of replications
@@ -131,6 +195,80 @@ Bool_T ParseArguments( int argc, char *argv[], DecompOptions &opt )
 		Error( "Number of scenarios to generate not specified." );
 	}
 
+	if( DecOpt->Resume && !*(DecOpt->CheckpointFile) )
+	{
+		valid = False;
+		Error( "A run may only be resumed from a checkpoint file." );
+	}
+
+	if( DecOpt->ReduceTo > 0 && DecOpt->Restart == RD_SubproblemManager::TREE )
+	{
+		valid = False;
+		Error( "Scenario reduction may not be used with the tree restart." );
+	}
+
+	if( DecOpt->ReduceTo > 0 && DecOpt->SeqSampling )
+	{
+		valid = False;
+		Error( "Scenario reduction may not be used with sequential "
+			"sampling." );
+	}
+
+	//--------------------------------------------------------------------------
+	//	The coverage is computed from the true gap of the candidate, which is
+	//	only known for the built-in one (that of db1).
+	//
+	if( *(DecOpt->XhatFile) && DecOpt->XhatGap < 0.0 )
+	{
+		valid = False;
+		Error( "The true optimality gap of the candidate solution (option "
+			"-xhat_gap) has to be given with option -xhat." );
+	}
+
+	//--------------------------------------------------------------------------
+	//	The single and the averaged two-replication procedures pool the
+	//	variances of the individual scenario gaps, so they need at least two
+	//	scenarios in a sample. They have no control variate.
+	//
+	if( DecOpt->Procedure != DecompOptions::MRP )
+	{
+		if( DecOpt->ScenNum == 1 )
+		{
+			valid = False;
+			Error( "The SRP and the A2RP need samples of at least two "
+				"scenarios." );
+		}
+		if( DecOpt->ControlVariate )
+		{
+			valid = False;
+			Error( "The control variate may only be used with the MRP." );
+		}
+		if( DecOpt->SeqSampling )
+		{
+			valid = False;
+			Error( "Sequential sampling may not be used with the SRP or the "
+				"A2RP." );
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	//	The jackknife re-solves the MRP batches without each group of
+	//	scenarios in turn (every group has to have some scenarios).
+	//
+	if( DecOpt->JackknifeGroups > 0 )
+	{
+		if( DecOpt->JackknifeGroups > DecOpt->ScenNum )
+		{
+			valid = False;
+			Error( "More jackknife groups than scenarios in a batch." );
+		}
+		if( DecOpt->Procedure != DecompOptions::MRP || DecOpt->SeqSampling )
+		{
+			valid = False;
+			Error( "The jackknife may only be used with the MRP." );
+		}
+	}
+
         // David Love -- If no gamma is provided, set gamma = m
         if( DecOpt->NonOverlap == 0 )
         {
@@ -163,6 +301,36 @@ Bool_T ParseArguments( int argc, char *argv[], DecompOptions &opt )
            Error( "Number of repitions must be positive" );
         }
 
+	//--------------------------------------------------------------------------
+	//	Sequential sampling grows a sampled problem. The scenario tree is not
+	//	extended with the appended scenarios, so the tree restarts are not
+	//	available.
+	//
+	if( DecOpt->SeqSampling )
+	{
+		if( DecOpt->ScenNum <= 1 )
+		{
+			valid = False;
+			Error( "Sequential sampling needs a sample of at least two "
+				"scenarios." );
+		}
+		else if( DecOpt->SeqMax == 0 )
+			DecOpt->SeqMax = 64 * DecOpt->ScenNum;
+		else if( DecOpt->SeqMax < DecOpt->ScenNum )
+		{
+			valid = False;
+			Error( "Maximum sequential sample size smaller than the initial "
+				"sample size." );
+		}
+
+		if( DecOpt->Restart == RD_SubproblemManager::TREE )
+		{
+			Warning( "Tree restarts unavailable with sequential sampling; "
+				"using self restarts." );
+			DecOpt->Restart = RD_SubproblemManager::SELF;
+		}
+	}
+
 	assert( !valid || ( DecOpt->ScenNum == -1 && DecOpt->AllScen ) ||
 		( DecOpt->ScenNum > 0 && !DecOpt->AllScen ) );
 
@@ -258,6 +426,24 @@ static void SetSolutionFile( const char *argument )
 }
 
 
+static void SetCacheFile( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( DecOpt->CacheFile[0] == '\0' )
+	{
+		strncpy( DecOpt->CacheFile, argument, DecompOptions::FILE_NAME_LEN );
+		DecOpt->CacheFile[DecompOptions::FILE_NAME_LEN] = '\0';
+	}
+	else
+	{
+		Error( "More than one cache file specified." );
+		valid = False;
+	}
+}
+
+
 static void SetRestartMode( const char *argument )
 {
 	assert( DecOpt != NULL );
@@ -365,6 +551,23 @@ static void SetPricingMode( const char *argument )
 }
 
 
+static void SetKeepWeights( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->KeepWeights = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->KeepWeights = False;
+	else
+	{
+		Error( "Unrecognized steepest edge weights mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
 static void SetCrashType( const char *argument )
 {
 	assert( DecOpt != NULL );
@@ -388,6 +591,23 @@ static void SetCrashType( const char *argument )
 }
 
 
+static void SetCrashBasis( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->CrashBasis = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->CrashBasis = False;
+	else
+	{
+		Error( "Unrecognized crash basis mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
 static void SetInitialPenalty( const char *argument )
 {
 	assert( DecOpt != NULL );
@@ -407,6 +627,507 @@ static void SetInitialPenalty( const char *argument )
 		DecOpt->InitPen = pen;
 }
 
+static void SetSubproblemScaling( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->ScaleSub = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->ScaleSub = False;
+	else
+	{
+		Error( "Unrecognized subproblem scaling mode: %s.", argument );
+		valid = False;
+	}
+}
+
+static void SetSubproblemPresolve( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->PresolveSub = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->PresolveSub = False;
+	else
+	{
+		Error( "Unrecognized subproblem presolve mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetEV_Start( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->EV_Start = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->EV_Start = False;
+	else
+	{
+		Error( "Unrecognized expected value start mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetStartFile( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( DecOpt->StartFile[0] == '\0' )
+	{
+		strncpy( DecOpt->StartFile, argument, DecompOptions::FILE_NAME_LEN );
+		DecOpt->StartFile[DecompOptions::FILE_NAME_LEN] = '\0';
+	}
+	else
+	{
+		Error( "More than one starting point file specified." );
+		valid = False;
+	}
+}
+
+
+static void SetKeepCuts( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->KeepCuts = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->KeepCuts = False;
+	else
+	{
+		Error( "Unrecognized cut carry-over mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetParallelRead( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->ParallelRead = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->ParallelRead = False;
+	else
+	{
+		Error( "Unrecognized parallel read mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetStatsFile( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( DecOpt->StatsFile[0] == '\0' )
+	{
+		strncpy( DecOpt->StatsFile, argument, DecompOptions::FILE_NAME_LEN );
+		DecOpt->StatsFile[DecompOptions::FILE_NAME_LEN] = '\0';
+	}
+	else
+	{
+		Error( "More than one statistics file specified." );
+		valid = False;
+	}
+}
+
+
+static void SetStatsFormat( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "csv" ) == 0 )
+		DecOpt->StatsFormat = RunStatistics::CSV;
+	else if( strcmp( argument, "json" ) == 0 )
+		DecOpt->StatsFormat = RunStatistics::JSON;
+	else
+	{
+		Error( "Unrecognized statistics format: %s.", argument );
+		valid = False;
+	}
+}
+
+static void SetSeqSampling( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->SeqSampling = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->SeqSampling = False;
+	else
+	{
+		Error( "Unrecognized sequential sampling mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetSeqMax( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	DecOpt->SeqMax = (Int_T) atol( argument );
+
+	if( DecOpt->SeqMax <= 0 )
+	{
+		Error( "Invalid maximum sequential sample size: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetSeqGrowth( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	Real_T growth = atof( argument );
+
+	if( growth <= 1.0 )
+	{
+		Error( "Sample growth factor must be greater than one: %s.",
+			argument );
+		valid = False;
+	}
+	else
+		DecOpt->SeqGrowth = growth;
+}
+
+
+static void SetSeqEps( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	Real_T eps = atof( argument );
+
+	if( eps <= 0.0 )
+	{
+		Error( "Invalid sequential sampling tolerance: %s.", argument );
+		valid = False;
+	}
+	else
+		DecOpt->SeqEps = eps;
+}
+
+
+static void SetSampling( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "mc" ) == 0 )
+		DecOpt->Sampling = UniformSampler::MC;
+	else if( strcmp( argument, "lhs" ) == 0 )
+		DecOpt->Sampling = UniformSampler::LHS;
+	else if( strcmp( argument, "rqmc" ) == 0 )
+		DecOpt->Sampling = UniformSampler::RQMC;
+	else
+	{
+		Error( "Unrecognized sampling method: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetAntithetic( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->Antithetic = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->Antithetic = False;
+	else
+	{
+		Error( "Unrecognized antithetic sampling mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetControlVariate( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->ControlVariate = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->ControlVariate = False;
+	else
+	{
+		Error( "Unrecognized control variate mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetCV_Pilot( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	int batches = atoi( argument );
+
+	if( batches <= 0 )
+	{
+		Error( "Invalid number of control variate pilot batches: %s.",
+			argument );
+		valid = False;
+	}
+	else
+		DecOpt->CV_Pilot = batches;
+}
+
+
+static void SetCheckpointFile( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( DecOpt->CheckpointFile[0] == '\0' )
+	{
+		strncpy( DecOpt->CheckpointFile, argument,
+			DecompOptions::FILE_NAME_LEN );
+		DecOpt->CheckpointFile[DecompOptions::FILE_NAME_LEN] = '\0';
+	}
+	else
+	{
+		Error( "More than one checkpoint file specified." );
+		valid = False;
+	}
+}
+
+
+static void SetCheckpointEvery( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	int reps = atoi( argument );
+
+	if( reps <= 0 )
+	{
+		Error( "Invalid number of replications between checkpoints: %s.",
+			argument );
+		valid = False;
+	}
+	else
+		DecOpt->CheckpointEvery = reps;
+}
+
+
+static void SetResume( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "on" ) == 0 )
+		DecOpt->Resume = True;
+	else if( strcmp( argument, "off" ) == 0 )
+		DecOpt->Resume = False;
+	else
+	{
+		Error( "Unrecognized resume mode: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetCoverageHW( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	Real_T hw = atof( argument );
+
+	if( hw < 0.0 || hw >= 1.0 )
+	{
+		Error( "Invalid coverage half-width: %s.", argument );
+		valid = False;
+	}
+	else
+		DecOpt->CoverageHW = hw;
+}
+
+
+static void SetMinReplications( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	int reps = atoi( argument );
+
+	if( reps <= 0 )
+	{
+		Error( "Invalid minimum number of replications: %s.", argument );
+		valid = False;
+	}
+	else
+		DecOpt->MinReplications = reps;
+}
+
+
+static void SetReduceTo( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	int scen = atoi( argument );
+
+	if( scen <= 0 )
+	{
+		Error( "Invalid number of scenarios to keep: %s.", argument );
+		valid = False;
+	}
+	else
+		DecOpt->ReduceTo = scen;
+}
+
+
+static void SetReduceDist( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "std" ) == 0 )
+		DecOpt->ReduceDist = Scenario::STD_NORM;
+	else if( strcmp( argument, "weighted" ) == 0 )
+		DecOpt->ReduceDist = Scenario::WEIGHTED_NORM;
+	else
+	{
+		Error( "Unrecognized scenario distance: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetDistProcs( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	int procs = atoi( argument );
+
+	if( procs <= 0 )
+	{
+		Error( "Invalid number of processes: %s.", argument );
+		valid = False;
+	}
+	else
+		DecOpt->DistProcs = procs;
+}
+
+
+static void SetXhatFile( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( DecOpt->XhatFile[0] == '\0' )
+	{
+		strncpy( DecOpt->XhatFile, argument, DecompOptions::FILE_NAME_LEN );
+		DecOpt->XhatFile[DecompOptions::FILE_NAME_LEN] = '\0';
+	}
+	else
+	{
+		Error( "More than one candidate solution file specified." );
+		valid = False;
+	}
+}
+
+
+static void SetXhatGap( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	Real_T gap = atof( argument );
+
+	if( gap < 0.0 )
+	{
+		Error( "Invalid optimality gap of the candidate solution: %s.",
+			argument );
+		valid = False;
+	}
+	else
+		DecOpt->XhatGap = gap;
+}
+
+
+static void SetProcedure( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	if( strcmp( argument, "mrp" ) == 0 )
+		DecOpt->Procedure = DecompOptions::MRP;
+	else if( strcmp( argument, "srp" ) == 0 )
+		DecOpt->Procedure = DecompOptions::SRP;
+	else if( strcmp( argument, "a2rp" ) == 0 )
+		DecOpt->Procedure = DecompOptions::A2RP;
+	else
+	{
+		Error( "Unrecognized gap estimation procedure: %s.", argument );
+		valid = False;
+	}
+}
+
+
+static void SetRepProcs( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	int procs = atoi( argument );
+
+	if( procs <= 0 )
+	{
+		Error( "Invalid number of processes: %s.", argument );
+		valid = False;
+	}
+	else
+		DecOpt->RepProcs = procs;
+}
+
+
+static void SetJackknifeGroups( const char *argument )
+{
+	assert( DecOpt != NULL );
+	assert( argument != NULL );
+
+	int groups = atoi( argument );
+
+	if( groups == 1 || groups < 0 )
+	{
+		Error( "Invalid number of jackknife groups: %s.", argument );
+		valid = False;
+	}
+	else
+		DecOpt->JackknifeGroups = groups;
+}
+
 // David Love -- Set the value of gamma
 static void SetNonOverlap( const char *argument )
 {
@@ -73,6 +73,18 @@ char *MakeLabel( Int_T j, Int_T scen, char *dst )
 	if( j > 0xffff || scen > 0xffff )
 		FatalError( "Problem too big for the current labeling scheme." );
 
-	sprintf( dst, "%04x%04x", (int)scen, (int)j );
+	//
+	//	Same as 'sprintf( dst, "%04x%04x", scen, j )', but much faster (the
+	//	function is called for every entry of the output file).
+	//
+	static const char Hex[] = "0123456789abcdef";
+
+	for( int i = 3; i >= 0; i--, scen >>= 4, j >>= 4 )
+	{
+		dst[i]		= Hex[ scen & 0xf ];
+		dst[i + 4]	= Hex[ j & 0xf ];
+	}
+	dst[8] = '\0';
+
 	return dst;
 }
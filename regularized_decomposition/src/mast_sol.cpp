@@ -59,6 +59,16 @@ STATIC DATA:
 #endif
 
 
+//@BEGIN-----------
+//	Penalty and committee size at the last optimum (set by "q1cmte_").
+extern Real_T PEN;
+extern Int_T NFIX2, M2;
+
+//	Number of scenarios before the last append (read by "q1cmte_").
+extern Int_T InitScen;
+//@END-------------
+
+
 /*------------------------------------------------------------------------------
 
 	MasterSolver::MasterSolver( const SolvableLP &lp, const Scenarios &Scen )
@@ -85,7 +95,7 @@ SIDE EFFECTS:
 
 MasterSolver::MasterSolver( const SolvableLP &lp, const Scenarios &Scen )
 	: n( lp.GetN() ), l( Int_T( Scen.GetNumberOfScenarios() + 1 ) ),
-	mdmat( lp.GetM() ),
+	lcap( l ), mdmat( lp.GetM() ),
 	itmax( 1000 ), istop( 0 ), levprt( 3 ), initpen( PENALTY_DEF ),
 	dmat( (Real_T *) lp.GetNonZerosByRows() ),
 	jcol( (Int_T *) lp.GetColumnNumbers() ),
@@ -99,7 +109,9 @@ MasterSolver::MasterSolver( const SolvableLP &lp, const Scenarios &Scen )
 	irn( NULL ), istat( NULL ),
 	marks( NULL ), status( NULL ),
 	Objective( 0.0 ), SubMan( NULL ),
-	ExpC( l ), ExpCost (0.0), ExpC2( l ), ExpCost2 (0.0)  
+	ExpC( l ), ExpCost (0.0), ExpC2( l ), ExpCost2 (0.0),
+	nkept( 0 ), gkept( n*n ), akept( n ), bkept( n ), penkept( 0.0 ),
+	nstored( 0 ), penstored( 0.0 )
 {
 	//--------------------------------------------------------------------------
 	//	Check the dimensions of the problem.
@@ -381,16 +393,151 @@ Int_T MasterSolver::Solve( void )
 	//				 pointer to the start of that array
 	//@END---------------------------------------------------------------
 	
+	//--------------------------------------------------------------------------
+	//	The kept cuts and penalty are only used by a cold start.
+	//
+	Int_T nseed		= 0;
+	Real_T pen		= initpen;
+
+	if( istop == 0 )
+	{
+		nseed = nkept;
+		if( penkept > 0.0 ) pen = penkept;
+		nkept	= 0;
+		penkept	= 0.0;
+	}
+
 	q1cmte_( n, l, x, y, yb, xmin, xmax, v.start, weight.start, mdmat, dmat, jcol, iptr,
 		bmin, bmax, marks, status, g.start, a.start, iblock.start, icheck.start, ieq.start, 
 		drow.start, ibasic.start, pricba.start, inonba, irn, istat, pricnb, pi, q, r, z, w, 
-		col, dpb.start, itmax, &istop, *SubMan, levprt, initpen, ExpC.start, ExpCost, 
-		ExpC2.start, ExpCost2);
+		col, dpb.start, itmax, &istop, *SubMan, levprt, pen, ExpC.start, ExpCost, 
+		ExpC2.start, ExpCost2, nseed, gkept.start, akept.start, bkept.start );
 
 	return 0;
 }
 
 
+/*------------------------------------------------------------------------------
+
+	void MasterSolver::KeepCommittee( Int_T shift )
+
+PURPOSE:
+	Stores the active non-basic cuts and the final penalty of the last
+solution, so that they may start the next solve. The next problem is assumed to reuse the scenarios of the
+current one, shifted by "shift" positions (block "b + shift" becomes block "b").
+Only the cuts of such overlapping blocks are kept. The cuts of the first stage
+objective and the first stage constraints are not kept, as they are recreated
+anyway.
+	The active objective cuts are stored by "q1cmte_" as differences to the
+basic cut of their block, so they are restored before being stored.
+
+PARAMETERS:
+	Int_T shift
+		The number of scenarios dropped from the front of the sample.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	Nothing is kept, unless the last solve found the optimum.
+
+------------------------------------------------------------------------------*/
+
+void MasterSolver::KeepCommittee( Int_T shift )
+{
+	assert( shift >= 0 );
+
+	nkept	= nstored	= 0;
+	penkept	= penstored	= 0.0;
+	if( istop != 2 ) return;
+
+	penkept = Max( Min( PEN, (Real_T) PENALTY_HI ), (Real_T) PENALTY_LO );
+
+	for( Int_T i = 0; i < M2 && nkept < n; i++ )
+	{
+		Int_T ii	= inonba[NFIX2+i] - 1,
+			ib		= iblock[ii],
+			b		= ( ib < 0 ) ? -ib : ib;
+
+		if( b <= shift || b >= l ) continue;
+
+		Real_T *gk = gkept.start + nkept * n;
+		Int_T j;
+
+		for( j = 0; j < n; j++ )
+			gk[j] = g[ii*n+j];
+		akept[nkept] = a[ii];
+
+		if( ib > 0 )
+		{
+			Int_T jj = ibasic[ib-1] - 1;
+
+			for( j = 0; j < n; j++ )
+				gk[j] += g[jj*n+j];
+			akept[nkept] += a[jj];
+			bkept[nkept] = b - shift;
+		}
+		else
+			bkept[nkept] = shift - b;
+
+		nkept++;
+	}
+
+	nstored		= nkept;
+	penstored	= penkept;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void MasterSolver::ReuseCommittee( Int_T shift )
+
+PURPOSE:
+	Makes the cuts and the penalty stored by the last "KeepCommittee()" start
+the next cold start solve again (a solve uses them only once). The cuts are
+subgradient cuts of the individual scenarios, so they remain valid when the
+scenario weights change. As in "KeepCommittee()", the next problem may
+drop the first "shift" scenarios; the cuts of the dropped scenarios are then
+discarded for good.
+
+PARAMETERS:
+	Int_T shift
+		The number of scenarios dropped from the front of the sample.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void MasterSolver::ReuseCommittee( Int_T shift )
+{
+	assert( shift >= 0 );
+
+	nkept = 0;
+	for( Int_T k = 0; k < nstored; k++ )
+	{
+		Int_T b = ( bkept[k] < 0 ) ? -bkept[k] : bkept[k];
+
+		if( b <= shift ) continue;
+
+		if( nkept < k )
+		{
+			for( Int_T j = 0; j < n; j++ )
+				gkept[nkept*n+j] = gkept[k*n+j];
+			akept[nkept] = akept[k];
+		}
+		bkept[nkept] = ( bkept[k] < 0 ) ? shift - b : b - shift;
+		nkept++;
+	}
+
+	nstored	= nkept;
+	penkept	= penstored;
+}
+
+
 /*------------------------------------------------------------------------------
 
 	StochSolution *MasterSolver::GetSolution( void )
@@ -444,7 +591,6 @@ StochSolution *MasterSolver::GetSolution( void )
 void MasterSolver::ReInitialize( int InitScen )
 {
 	//ReInitialize the work vectors that have sizes related to "l"
-	//by resizing to correct size 
 	//so that when number of scenarios is changed (increased) 
 	//they are good to go...
 
@@ -452,52 +598,179 @@ void MasterSolver::ReInitialize( int InitScen )
 	//takes InitScen, initial number of scenarios as a parameter and assumes, 
 	//"l", total number of scenarios, is adjusted to its new value beforehand.
 
-	g.Resize(n*(n+2*l)); 
-	a.Resize(n+2*l); 
-	v.Resize(l); 
-	weight.Resize(l); 
+	//The vectors are only reallocated when "l" exceeds their capacity
+	//"lcap". The capacity is then (at least) doubled, so that a sample grown
+	//by single scenarios costs an amortised constant number of copies per
+	//scenario. "q1cmte_" never looks beyond "l".
 
-	pricba.Resize(l); 
-	dpb.Resize(l);
-	
-	iblock.Resize(n+2*l);	
-    ibasic.Resize(l);
-    icheck.Resize(n+2*l);
-	ieq.Resize(n+2*l);	
-	drow.Resize(n+2*l);
+	assert( InitScen + 1 <= l );
 
-	ExpC.Resize(l); 
-	ExpC2.Resize(l); 
+	if( l > lcap )
+	{
+		Int_T OldCap = lcap;
+
+		lcap = Max( l, 2 * lcap );
+
+		g.Resize( n*(n+2*lcap) );
+		a.Resize( n+2*lcap );
+		v.Resize( lcap );
+		weight.Resize( lcap );
+
+		pricba.Resize( lcap );
+		dpb.Resize( lcap );
+
+		iblock.Resize( n+2*lcap );
+		ibasic.Resize( lcap );
+		icheck.Resize( n+2*lcap );
+		ieq.Resize( n+2*lcap );
+		drow.Resize( n+2*lcap );
+
+		ExpC.Resize( lcap );
+		ExpC2.Resize( lcap );
+
+		g.Fill(		0.0,		n*(n+2*lcap),	n*(n+2*OldCap)	);
+		a.Fill(		0.0,		n+2*lcap,		n+2*OldCap		);
+		iblock.Fill(	(Int_T) 0,	n+2*lcap,		n+2*OldCap		);
+		icheck.Fill(	(Int_T) 0,	n+2*lcap,		n+2*OldCap		);
+		ieq.Fill(		(Int_T) 0,	n+2*lcap,		n+2*OldCap		);
+		drow.Fill(		(Int_T) 0,	n+2*lcap,		n+2*OldCap		);
+
+		v.Fill(			0.0,		lcap,			OldCap			);
+		weight.Fill(	0.0,		lcap,			OldCap			);
+		pricba.Fill(	0.0,		lcap,			OldCap			);
+		dpb.Fill(		0.0,		lcap,			OldCap			);
+		ibasic.Fill(	(Int_T) 0,	lcap,			OldCap			);
+		ExpC.Fill(		0.0,		lcap,			OldCap			);
+		ExpC2.Fill(		0.0,		lcap,			OldCap			);
+	}
 
-	
-	//Initialize new elements to 0
+	//Initialize new elements to 0 (below the capacity they may still hold
+	//data of an earlier, larger problem)
 
-	int len, start; 
-	len = n+2*l; 
-	start = n + 2*(InitScen+1); 
+	Int_T i,
+		start	= n + 2*(InitScen+1),
+		len		= n + 2*l;
 
-	iblock.Fill(0, len, start); 
-	icheck.Fill(0, len, start);
-	drow.Fill(  0, len, start);
-	ieq.Fill(   0, len, start);
+	for( i = start; i < len; i++ )
+	{
+		a[i]		= 0.0;
+		iblock[i]	= icheck[i] = ieq[i] = drow[i] = 0;
+	}
 
-	a.Fill(   0.0, len, start);
+	for( i = n*start; i < n*len; i++ )
+		g[i] = 0.0;
 
-	len *= n; 
-	start = n*(n+2*(InitScen+1)); 
-	g.Fill(0.0, len, start);
+	for( i = InitScen + 1; i < l; i++ )
+	{
+		v[i] = weight[i] = pricba[i] = dpb[i] = ExpC[i] = ExpC2[i] = 0.0;
+		ibasic[i] = 0;
+	}
+}
 
-	len = l;
-	start = InitScen + 1;
-	
-	v.Fill(      0.0, len, start);
-	weight.Fill( 0.0, len, start);
-	pricba.Fill(0.0, len, start);
-	dpb.Fill(      0, len, start);
-	ibasic.Fill(   0, len, start);
-
-	ExpC.Fill(   0.0, len, start);
-	ExpC2.Fill(   0.0, len, start);
+
+/*------------------------------------------------------------------------------
+
+	void MasterSolver::AddScenarios( Int_T NewNum )
+
+PURPOSE:
+	Prepares the master for the solution of the problem after the scenario
+repository has grown to "NewNum" scenarios (see "Scenarios::AppendScenario()").
+If the last solve found the optimum, the next "Solve()" continues from it: the
+committee of cuts, the bases of the subproblems and the penalty are kept and
+only the cuts of the new scenarios are added. Otherwise the next solve is a
+cold start from the last regularization point.
+
+PARAMETERS:
+	Int_T NewNum
+		The new number of scenarios (greater than the current one).
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	Sets the global "InitScen" to the previous number of scenarios. Informs
+the subproblem manager of the new scenarios.
+
+------------------------------------------------------------------------------*/
+
+void MasterSolver::AddScenarios( Int_T NewNum )
+{
+	assert( SubMan != NULL );
+	assert( NewNum + 1 > l );
+
+	InitScen = l - 1;
+	l = NewNum + 1;
+	ReInitialize( InitScen );
+	SubMan->AppendScenarios( NewNum );
+
+	if( istop == 2 )
+		istop = 9;
+	else
+	{
+		SetWeights();
+		istop = 0;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T MasterSolver::EvaluateCandidate( const Array<Real_T> &xhat,
+		Real_T &gap, Real_T &var )
+
+PURPOSE:
+	Estimates the optimality gap of a candidate first stage solution "xhat" on
+the current sample (single replication procedure): all the subproblems are
+solved at "xhat" and compared with the last optimal solution of the sampled
+problem. Unlike "Solve()" with "istop = 10" this leaves the committee of cuts
+and the subproblem solver states intact, so that the next "AddScenarios()" may
+still restart from them.
+
+PARAMETERS:
+	const Array<Real_T> &xhat
+		The candidate solution.
+
+	Real_T &gap, Real_T &var
+		On return: the gap estimate and the sample variance of the
+		differences of the individual scenario costs.
+
+RETURN VALUE:
+	False if "xhat" turned out infeasible for some scenario (the estimates
+are then meaningless), True otherwise.
+
+SIDE EFFECTS:
+	Overwrites "ExpC" and "ExpCost".
+
+------------------------------------------------------------------------------*/
+
+Bool_T MasterSolver::EvaluateCandidate( const Array<Real_T> &xhat, // )
+	Real_T &gap, Real_T &var )
+{
+	assert( SubMan != NULL );
+	assert( l > 2 );
+
+	Array<Real_T> grad( n, 0.0 );
+	Bool_T feasible = True;
+	Real_T val;
+	Int_T i;
+
+	//All the blocks are solved (the first stage objective last), so that the
+	//subproblem manager sees a complete sweep.
+	ExpCost = 0.0;
+	for( i = 0; i < l; i++ )
+	{
+		if( !SubMan->SolveSubproblem( i+1, n, xhat.start, val, grad.start ) )
+			feasible = False;
+		ExpC[i] = val;
+		ExpCost += weight[i] * val;
+	}
+
+	Objective = 0.0;
+	for( i = 0; i < l; i++ )
+		Objective += v[i] * weight[i];
+
+	var = CalculateVariance( gap );
+	return feasible;
 }
 
 
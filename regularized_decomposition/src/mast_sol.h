@@ -66,6 +66,7 @@ private:
 	//
 	Int_T     n,		// Number of the first stage variables.
 		      l,		// Number of blocks.
+		   lcap,		// Number of blocks the block arrays have room for.
 		  mdmat;		// Number of the first stage constraints.
 	
 	//--------------------------------------------------------------------------
@@ -115,7 +116,8 @@ private:
 				weight; // [l] Cuts' weights (objective also treated as a cut, its weight =1)
 	
 	//These are defined as Array<Real_T> to allow for quick updating when the number
-	//of scenarios (l) is increased.
+	//of scenarios (l) is increased. All the arrays sized by "l" are actually
+	//sized by "lcap" (see "ReInitialize()").
 
 	//--------------------------------------------------------------------------
 	// Vectors used for Solving the Master Problem
@@ -205,6 +207,21 @@ private:
 	// Note2: These are not used unles istop = 10 or 11! 
 	//@END----------------------------------------------------------------------
 
+	//--------------------------------------------------------------------------
+	//	Cuts and penalty kept from the previous solution (see
+	//	"KeepCommittee()"). They are used once, by the next cold start solve.
+	//
+	Int_T nkept;			// Number of the kept cuts (at most n).
+	Array<Real_T> gkept,	// [n*n] Gradients of the kept cuts.
+				akept;		// [n] Intercepts of the kept cuts.
+	Array<Int_T> bkept;		// [n] Blocks of the kept cuts (negative for
+							// feasibility cuts).
+	Real_T penkept;			// Final penalty of the previous solution (zero
+							// if none was kept).
+	Int_T nstored;			// Number of the cuts stored in "gkept" etc. and
+	Real_T penstored;		// their penalty (they stay there after a solve
+							// used them, see "ReuseCommittee()").
+
 
 public:
 	MasterSolver( const SolvableLP &lp, const Scenarios &Scen );
@@ -225,8 +242,10 @@ public:
 	//   when a new scenario(s) is (are) added:
 	
 	void SetiStop( int is );
+	int GetiStop( void ) const;	//why the last solve stopped (2 - optimum)
 	void Setl ( int il ); 
 	void ReInitialize( int InitScen ); 
+	void AddScenarios( Int_T NewNum );
 
 	//This is just for reinitialization w/o adding a new scenario
 
@@ -237,6 +256,9 @@ public:
 	Real_T CalculateVariance (Real_T& gap); 
 	Real_T CalculateVariance2 (void); 
 	Real_T CalculateGap ( void ); 
+	Real_T CalculateControl ( void );
+	Bool_T EvaluateCandidate( const Array<Real_T> &xhat, Real_T &gap,
+		Real_T &var );
 	void SetWeights ( void ); 
 
         // David Love -- Added to get the individual gap estimates
@@ -245,6 +267,13 @@ public:
            return ExpC[index] - v[index];
         }
 
+	//The difference of the costs of the two evaluated points for a scenario
+	//(the control variate of the gap, see "CalculateControl()").
+	Real_T GetIndivControl( int index )
+	{
+		return ExpC[index] - ExpC2[index];
+	}
+
         // David Love -- Get the cost of xhat and xi.  For debugging
         Real_T GetExpC( int index )
         {
@@ -257,11 +286,27 @@ public:
            return v[index];
         }
 
+	//The weight (probability) of a scenario in the master objective. It is
+	//set from the scenario probability by the constructor.
+	Real_T GetWeight( int index ) const
+	{
+		return weight[index];
+	}
+
+	void SetWeight( int index, Real_T w )
+	{
+		weight[index] = w;
+	}
+
 	//This function is Similar to GetSolution but is created to prevent
 	//memory leak.
 
 	void FillSolution( StochSolution *sol ); 
 
+	void KeepCommittee( Int_T shift );
+	void ReuseCommittee( Int_T shift );
+	void DropCommittee( void );
+
 	//@END----------------------------------------------------------------------
 };
 
@@ -286,10 +331,19 @@ inline
 void MasterSolver::SetiStop( int is )
 { istop = is; }
 
+inline
+int MasterSolver::GetiStop( void )
+const
+{ return istop; }
+
 inline
 void MasterSolver::Setl( int il )
 { l = il; }
 
+inline
+void MasterSolver::DropCommittee( void )
+{ nkept = nstored = 0; penkept = penstored = 0.0; }
+
 inline 
 void MasterSolver::SetWeights ( void )
 {
@@ -316,6 +370,18 @@ Real_T MasterSolver::CalculateGap (void)
 	return  ExpCost - Objective;  //minimization problem
 }
 
+
+inline
+Real_T MasterSolver::CalculateControl (void)
+{
+	//This function assumes that xhat was evaluated with "istop = 10" and a
+	//second point (the expected value solution) with "istop = 11" on the same
+	//scenarios. The difference of their costs is strongly correlated with the
+	//gap of xhat and serves as its control variate.
+
+	return  ExpCost - ExpCost2;
+}
+
 //@END----------------------------------------------
 
 #endif
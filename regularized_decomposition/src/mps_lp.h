@@ -280,11 +280,21 @@ public:
 	//	FREE and FIXED MPS file formats conform (in as much as possible) to
 	//	input file formats of the IBM's MPSX linear programming package.
 	//
+	//	"WriteBin" and "ReadBin" store and restore the whole object (incl. the
+	//	labels) in binary form, as a part of an open file (see "probcach.cpp").
+	//	"WriteLP_Bin" writes a complete binary LP file, "ReadLP_Bin" reads it
+	//	and "IsBinaryLP" recognizes it.
+	//
 public:
 	Bool_T ReadLP( const char *FileName, VerbLevel Verbosity );
 	Bool_T ReadLP( const char *FileName, FILE *LP_File, VerbLevel Verbosity );
 	Bool_T WriteMPS( const char *MPS_File, VerbLevel Verbosity ) const;
 	virtual Bool_T WriteMPS( FILE *MPS_File, VerbLevel Verbosity ) const;
+	Bool_T WriteBin( FILE *fp ) const;
+	Bool_T ReadBin( FILE *fp );
+	Bool_T WriteLP_Bin( const char *FileName ) const;
+	Bool_T ReadLP_Bin( FILE *fp );
+	static Bool_T IsBinaryLP( FILE *fp );
 	
 /*#ifdef SUPPORT_LP_DIT 
 	Bool_T ReadLP_DIT( const char *FileName, VerbLevel Verbosity );
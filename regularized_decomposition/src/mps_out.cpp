@@ -0,0 +1,330 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		File input / output routines.
+PROJECT CODE:		----------------
+PROJECT FULL NAME:	----------------
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE NAME:	mps_out.cpp
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.18
+
+DEPENDENCIES:		mps_out.h, stdtype.h, myalloc.h
+					<stdio.h>, <stdarg.h>, <math.h>, <assert.h>
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE CONTENTS:
+	Implementation of class "MPS_Output" (a buffered MPS file writer).
+
+--------------------------------------------------------------------------------
+
+PUBLIC INTERFACE:
+	MPS_Output::MPS_Output( FILE *_fp )
+	MPS_Output::~MPS_Output( void )
+
+	void MPS_Output::Text( const char *s )
+	void MPS_Output::Field( const char *s )
+	void MPS_Output::Number( Real_T x )
+	void MPS_Output::Printf( const char *Format, ... )
+	Bool_T MPS_Output::Flush( void )
+
+	static int MPS_Output::FormatG( char *Dst, Real_T x )
+
+STATIC DATA:
+	static const double Pow10[]
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <assert.h>
+
+#ifndef __MPS_OUT_H__
+#	include "mps_out.h"
+#endif
+#ifndef __MYALLOC_H__
+#	include "myalloc.h"
+#endif
+
+
+//------------------------------------------------------------------------------
+//	Powers of ten used by the number conversion.
+//
+static const double Pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+	1e9 };
+
+
+/*------------------------------------------------------------------------------
+
+	MPS_Output::MPS_Output( FILE *_fp )
+	MPS_Output::~MPS_Output( void )
+
+PURPOSE:
+	Constructor and destructor. The destructor writes whatever is left in the
+buffer (the result is lost, so "Flush()" should be called explicitly first).
+
+PARAMETERS:
+	FILE *_fp
+		An open output stream.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+MPS_Output::MPS_Output( FILE *_fp )
+	: fp( _fp ), Buf( NULL ), Len( 0 ), IO_OK( True )
+{
+	assert( fp != NULL );
+
+	MALLOC( Buf, BUF_LEN );
+}
+
+
+MPS_Output::~MPS_Output( void )
+{
+	Flush();
+	FREE( Buf );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void MPS_Output::Text( const char *s )
+	void MPS_Output::Field( const char *s )
+	void MPS_Output::Number( Real_T x )
+	void MPS_Output::Printf( const char *Format, ... )
+
+PURPOSE:
+	Append a string, a label (left justified in an eight character field), a
+number (in the "%12G" format) or any "printf()" style formatted text to the
+output.
+
+PARAMETERS:
+	const char *s
+		A string (label).
+
+	Real_T x
+		A number.
+
+	const char *Format, ...
+		Format and arguments, as for "printf()".
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void MPS_Output::Text( const char *s )
+{
+	assert( s != NULL );
+
+	for( ; *s; s++ )
+	{
+		if( Len == BUF_LEN ) Flush();
+		Buf[ Len++ ] = *s;
+	}
+}
+
+
+void MPS_Output::Field( const char *s )
+{
+	assert( s != NULL );
+
+	MakeRoom( MAX_ITEM_LEN );
+
+	char *p = Buf + Len, *end = p + MAX_ITEM_LEN;
+
+	for( ; *s && p < end; s++ )
+		*p++ = *s;
+	if( *s )
+	{
+		Len = p - Buf;
+		Text( s );
+		return;
+	}
+	for( end = Buf + Len + 8; p < end; )
+		*p++ = ' ';
+
+	Len = p - Buf;
+}
+
+
+void MPS_Output::Number( Real_T x )
+{
+	MakeRoom( MAX_ITEM_LEN );
+
+	char Num[ MAX_ITEM_LEN ];
+	int len = FormatG( Num, x );
+
+	for( ; len < 12; len++ )
+		Buf[ Len++ ] = ' ';
+
+	const char *s = Num;
+	while( *s ) Buf[ Len++ ] = *s++;
+}
+
+
+void MPS_Output::Printf( const char *Format, ... )
+{
+	va_list params;
+
+	Flush();
+	va_start( params, Format );
+	if( vfprintf( fp, Format, params ) < 0 )
+		IO_OK = False;
+	va_end( params );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T MPS_Output::Flush( void )
+
+PURPOSE:
+	Writes out the buffer contents.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	False if this or any earlier output operation failed.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T MPS_Output::Flush( void )
+{
+	if( Len > 0 && fwrite( Buf, 1, Len, fp ) != Len )
+		IO_OK = False;
+	Len = 0;
+
+	return IO_OK;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static int MPS_Output::FormatG( char *Dst, Real_T x )
+
+PURPOSE:
+	Converts a number to text exactly as "sprintf( Dst, "%G", x )" would.
+Numbers which in the "%G" format are written without an exponent (i.e. those
+whose magnitude is between 1E-4 and 999999.5) are converted directly: the
+number is scaled to a six digit integer, rounded and the decimal point is put
+in place. Zero, the remaining numbers and the (rare) cases where the rounding
+cannot be decided with certainty in double precision arithmetic are passed to
+"sprintf()".
+
+PARAMETERS:
+	char *Dst
+		Output buffer (at least 32 characters).
+
+	Real_T x
+		The number.
+
+RETURN VALUE:
+	Length of the resulting string.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+int MPS_Output::FormatG( char *Dst, Real_T x )
+{
+	double a = ( x < 0.0 ) ? -x : x;
+
+	if( !( a >= 1e-4 && a < 999999.5 ) )
+		return sprintf( Dst, "%G", (double) x );
+
+	//--------------------------------------------------------------------------
+	//	Find the decimal exponent "X" of the number and scale it so that it
+	//	has six digits before the decimal point.
+	//
+	int X;
+
+	if( a >= 1.0 )
+		for( X = 0; X < 5 && a >= Pow10[X+1]; X++ )
+			;
+	else
+		for( X = -1; a < 1.0 / Pow10[-X]; X-- )
+			;
+
+	const int Dec = 5 - X;				// Digits behind the decimal point.
+	const double Scaled	= a * Pow10[ Dec ];
+	const double Floor	= floor( Scaled );
+	const double Frac	= Scaled - Floor;
+
+	if( fabs( Frac - 0.5 ) < 1e-6 )
+		return sprintf( Dst, "%G", (double) x );
+
+	const double Rounded = ( Frac > 0.5 ) ? Floor + 1.0 : Floor;
+
+	if( Rounded < 1e5 || Rounded >= 1e6 )
+		return sprintf( Dst, "%G", (double) x );
+
+	//--------------------------------------------------------------------------
+	//	Six significant digits (most significant first).
+	//
+	long Digits = (long) Rounded;
+	char d[6];
+
+	for( int i = 5; i >= 0; i-- )
+	{
+		d[i] = char( '0' + Digits % 10 );
+		Digits /= 10;
+	}
+
+	//--------------------------------------------------------------------------
+	//	Sign, integer part, decimal point and the fraction without trailing
+	//	zeros.
+	//
+	char *p = Dst;
+	int Last = 5;
+
+	if( x < 0.0 ) *p++ = '-';
+
+	while( Last >= 6 - Dec && d[Last] == '0' )
+		Last--;
+
+	if( X < 0 )
+	{
+		*p++ = '0';
+		*p++ = '.';
+		for( int z = -1; z > X; z-- )
+			*p++ = '0';
+		for( int i = 0; i <= Last; i++ )
+			*p++ = d[i];
+	}
+	else
+	{
+		int i;
+
+		for( i = 0; i <= X; i++ )
+			*p++ = d[i];
+		if( Last > X )
+		{
+			*p++ = '.';
+			for( ; i <= Last; i++ )
+				*p++ = d[i];
+		}
+	}
+
+	*p = '\0';
+	return int( p - Dst );
+}
@@ -0,0 +1,165 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		File input / output routines.
+PROJECT CODE:		----------------
+PROJECT FULL NAME:	----------------
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+HEADER FILE NAME:	mps_out.h
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.18
+
+DEPENDENCIES:		stdtype.h,
+					<stdio.h>
+
+--------------------------------------------------------------------------------
+
+HEADER CONTENTS:
+	Declaration of class "MPS_Output" - a buffered writer of MPS (and other
+text) files. Writing a large LP with one "fprintf" call per entry is very slow:
+the format string is interpreted anew for every line and a general purpose
+floating point conversion is used for every number. The class collects the
+output in a large buffer of its own. The labels are copied and padded directly
+and the numbers are converted by a fast routine, which gives exactly the same
+text as "%12G".
+	Output errors are not reported by the individual calls. The object
+remembers the first error and "Flush()" (which has to be called at the end)
+reports it.
+
+------------------------------------------------------------------------------*/
+
+#ifndef __MPS_OUT_H__
+#define __MPS_OUT_H__
+
+#include <stdio.h>
+
+#ifndef __STDTYPE_H__
+#	include "stdtype.h"
+#endif
+
+//==============================================================================
+//
+//	Declaration of class "MPS_Output".
+//
+//==============================================================================
+
+class MPS_Output
+{
+private:
+	FILE *fp;
+
+	char *Buf;				// Output buffer.
+	size_t Len;				// Number of characters held in the buffer.
+	Bool_T IO_OK;			// False after the first output error.
+
+	enum { BUF_LEN = 64 * 1024, MAX_ITEM_LEN = 256 };
+
+	void MakeRoom( size_t len );
+
+	MPS_Output( const MPS_Output & );				// Not allowed: the buffer
+	MPS_Output &operator=( const MPS_Output & );	// is owned by the object.
+
+public:
+	MPS_Output( FILE *_fp );
+	~MPS_Output( void );
+
+	//--------------------------------------------------------------------------
+	//	Output of the elements of a line.
+	//
+	void Text( const char *s );						// "%s"
+	void Field( const char *s );					// "%-8s"
+	void Number( Real_T x );						// "%12G"
+	void NewLine( void );							// "\n"
+	void Printf( const char *Format, ... );			// Anything else.
+
+	//--------------------------------------------------------------------------
+	//	Complete data lines of the MPS format. "Code" is the four character
+	//	beginning of the line (e.g. "    " or " UP ").
+	//
+	void Entry( const char *Code, const char *Name1, const char *Name2 );
+	void Entry( const char *Code, const char *Name1, const char *Name2,
+		Real_T Value );
+	void Entry( const char *Code, const char *Name1, const char *Name2,
+		Real_T Value, const char *Name3, Real_T Value3 );
+
+	Bool_T Flush( void );
+
+	static int FormatG( char *Dst, Real_T x );
+};
+
+//==============================================================================
+//
+//	End of declaration of class "MPS_Output".
+//
+//==============================================================================
+
+
+//==============================================================================
+//
+//	Inline functions.
+//
+//==============================================================================
+
+inline
+void MPS_Output::MakeRoom( size_t len )
+{
+	if( Len + len > BUF_LEN ) Flush();
+}
+
+
+inline
+void MPS_Output::NewLine( void )
+{
+	MakeRoom( 1 );
+	Buf[ Len++ ] = '\n';
+}
+
+
+inline
+void MPS_Output::Entry( const char *Code, const char *Name1, // )
+	const char *Name2 )
+{
+	Text( Code );
+	Field( Name1 );
+	Text( "  " );
+	Field( Name2 );
+	NewLine();
+}
+
+
+inline
+void MPS_Output::Entry( const char *Code, const char *Name1, // )
+	const char *Name2, Real_T Value )
+{
+	Text( Code );
+	Field( Name1 );
+	Text( "  " );
+	Field( Name2 );
+	Text( "  " );
+	Number( Value );
+	NewLine();
+}
+
+
+inline
+void MPS_Output::Entry( const char *Code, const char *Name1, // )
+	const char *Name2, Real_T Value, const char *Name3, Real_T Value3 )
+{
+	Text( Code );
+	Field( Name1 );
+	Text( "  " );
+	Field( Name2 );
+	Text( "  " );
+	Number( Value );
+	Text( "   " );
+	Field( Name3 );
+	Text( "  " );
+	Number( Value3 );
+	NewLine();
+}
+
+#endif
@@ -0,0 +1,869 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		File input / output routines.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE NAME:	mrp_ckpt.cpp
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.19
+
+DEPENDENCIES:		mrp_ckpt.h, obm_stat.h, probcach.h, print.h, stdtype.h
+					<stdio.h>, <string.h>, <math.h>, <assert.h>, <sys/stat.h>
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE CONTENTS:
+	Implementation of class "MRP_Checkpoint" (the results of the multiple
+replication procedure and the checkpoint files).
+	The checkpoint file consists of:
+	-	a header (a magic string, the file version and the sizes of the basic
+		types),
+	-	the design of the procedure, the number of the replications, the run
+		time and the control variate mean,
+	-	the sampling method, the gap estimation procedure and the identity of
+		the three input files (as in the problem cache: the name, the size and
+		the modification time of each file),
+	-	the three generator states,
+	-	the results of the replications (with the bias-corrected gap
+		estimates, if the jackknife was used) and the starting point,
+	-	the magic string again (to detect truncated files).
+	All numbers are stored in the binary form of the machine (as in the problem
+cache). The running statistics are not stored; they are recomputed from the
+replications when the file is read.
+
+--------------------------------------------------------------------------------
+
+PUBLIC INTERFACE:
+	MRP_Checkpoint::MRP_Checkpoint( void )
+	MRP_Checkpoint::~MRP_Checkpoint( void )
+
+	void MRP_Checkpoint::Start( ... )
+	void MRP_Checkpoint::Reserve( Int_T MaxReps )
+	Bool_T MRP_Checkpoint::Write( const char *FileName ) const
+	Bool_T MRP_Checkpoint::Read( const char *FileName )
+	Bool_T MRP_Checkpoint::SetInputs( const char *Core, const char *Time,
+		const char *Stoch )
+	void MRP_Checkpoint::SetMethod( ... )
+	Bool_T MRP_Checkpoint::SameDesign( const MRP_Checkpoint &c ) const
+	Bool_T MRP_Checkpoint::Append( const MRP_Checkpoint &c )
+	void MRP_Checkpoint::Record( ... )
+	void MRP_Checkpoint::GetReplication( ... ) const
+	Real_T MRP_Checkpoint::CoverageHalfWidth( void ) const
+	void MRP_Checkpoint::PrintProgress( void ) const
+	void MRP_Checkpoint::PrintSummary( void ) const
+	void MRP_Checkpoint::MarkOrigin( void )
+	void MRP_Checkpoint::SetWarmStart( const Real_T *x, Int_T n )
+	Bool_T MRP_Checkpoint::GetWarmStart( Real_T *x, Int_T n ) const
+
+STATIC DATA:
+	static const char CheckpointMagic[]
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <sys/stat.h>
+
+#ifndef __MRP_CKPT_H__
+#	include "mrp_ckpt.h"
+#endif
+#ifndef __PROBCACH_H__
+#	include "probcach.h"
+#endif
+#ifndef __PRINT_H__
+#	include "print.h"
+#endif
+
+
+//------------------------------------------------------------------------------
+//	The checkpoint file signature and version. The version has to be changed
+//	whenever the layout of the file changes.
+//
+#define CKPT_VERSION	(3)
+#define CKPT_MAGIC_LEN	(9)
+
+static const char CheckpointMagic[ CKPT_MAGIC_LEN ] = "RD_MRPCK";
+//
+//------------------------------------------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+
+	MRP_Checkpoint::MRP_Checkpoint( void )
+	MRP_Checkpoint::~MRP_Checkpoint( void )
+	void MRP_Checkpoint::Free( void )
+
+PURPOSE:
+	Constructor, destructor and the deallocation of the arrays (which also
+clears the running statistics). The object is
+empty (no design, no replications) until "Start()" or "Read()" is called.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+MRP_Checkpoint::MRP_Checkpoint( void )
+	: BatchSize( 0 ), Gamma( 0 ), NumBatches( 0 ), DegreesFreedom( 0.0 ),
+	CiDenom( 1.0 ), Za( 0.0 ), OptGap( 0.0 ), JackGroups( 0 ), Reps( 0 ),
+	MaxReps( 0 ), GBar( NULL ), Var( NULL ), CI( NULL ), ZnBar( NULL ),
+	Zn( NULL ), GJack( NULL ), Covered( 0 ), JackCovered( 0 ),
+	Elapsed( 0.0 ), Runs( 0 ), RunOrigin( NULL ), WarmLen( 0 ),
+	WarmStart( NULL ), HasCtrlMean( False ), CtrlMean( 0.0 )
+{
+	memset( Origin, 0, sizeof( Origin ) );
+	memset( State, 0, sizeof( State ) );
+	memset( BatchState, 0, sizeof( BatchState ) );
+	for( Int_T i = 0; i < INPUTS; i++ )
+		InputName[i] = NULL;
+	ClearInputs();
+}
+
+
+MRP_Checkpoint::~MRP_Checkpoint( void )
+{
+	Free();
+	ClearInputs();
+}
+
+
+void MRP_Checkpoint::Free( void )
+{
+	delete [] GBar;		GBar = NULL;
+	delete [] Var;		Var = NULL;
+	delete [] CI;		CI = NULL;
+	delete [] ZnBar;	ZnBar = NULL;
+	delete [] Zn;		Zn = NULL;
+	delete [] GJack;	GJack = NULL;
+	delete [] WarmStart;	WarmStart = NULL;
+	delete [] RunOrigin;	RunOrigin = NULL;
+
+	Reps = MaxReps = WarmLen = Covered = JackCovered = Runs = 0;
+	GapStat.Clear();
+	VarStat.Clear();
+	WidthStat.Clear();
+	SizeStat.Clear();
+	JackStat.Clear();
+	JackSizeStat.Clear();
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void MRP_Checkpoint::Start( Int_T BatchSize, Int_T Gamma,
+		Int_T NumBatches, Real_T DegreesFreedom, Real_T CiDenom, Real_T Za,
+		Real_T OptGap, Int_T JackGroups )
+	void MRP_Checkpoint::Reserve( Int_T MaxReps )
+
+PURPOSE:
+	The first function discards all data (also the identity of the run, see
+"SetInputs()") and sets the design of the procedure. The second one makes room
+for "MaxReps" replications (the recorded ones are kept).
+
+PARAMETERS:
+	Int_T BatchSize, Int_T Gamma, Int_T NumBatches
+		Batch size, the shift of the overlapping batches, number of batches.
+
+	Real_T DegreesFreedom, Real_T CiDenom, Real_T Za
+		The divisor of the variance estimator, the divisor of the standard
+		deviation and the normal quantile of the confidence interval.
+
+	Real_T OptGap
+		The true optimality gap of the candidate solution (for the coverage).
+
+	Int_T JackGroups
+		Number of the jackknife groups (0 - no bias-corrected estimates).
+
+	Int_T MaxReps
+		Number of the replications.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void MRP_Checkpoint::Start( Int_T bs, Int_T g, Int_T nb, Real_T dof, // )
+	Real_T den, Real_T za, Real_T opt, Int_T jg )
+{
+	assert( bs > 0 && g > 0 && nb > 0 && jg >= 0 );
+
+	Free();
+
+	BatchSize		= bs;
+	Gamma			= g;
+	NumBatches		= nb;
+	DegreesFreedom	= dof;
+	CiDenom			= den;
+	Za				= za;
+	OptGap			= opt;
+	JackGroups		= jg;
+	Elapsed			= 0.0;
+	HasCtrlMean		= False;
+
+	ClearInputs();
+}
+
+
+void MRP_Checkpoint::Reserve( Int_T max )
+{
+	assert( NumBatches > 0 );
+
+	if( max <= MaxReps ) return;
+
+	Real_T *g = new Real_T[ max ], *v = new Real_T[ max ],
+		*c = new Real_T[ max ], *z = new Real_T[ max ],
+		*zn = new Real_T[ max * NumBatches ], *j = new Real_T[ max ];
+
+	if( Reps > 0 )
+	{
+		memcpy( g, GBar, Reps * sizeof( Real_T ) );
+		memcpy( v, Var, Reps * sizeof( Real_T ) );
+		memcpy( c, CI, Reps * sizeof( Real_T ) );
+		memcpy( z, ZnBar, Reps * sizeof( Real_T ) );
+		memcpy( zn, Zn, Reps * NumBatches * sizeof( Real_T ) );
+		memcpy( j, GJack, Reps * sizeof( Real_T ) );
+	}
+
+	delete [] GBar;		GBar = g;
+	delete [] Var;		Var = v;
+	delete [] CI;		CI = c;
+	delete [] ZnBar;	ZnBar = z;
+	delete [] Zn;		Zn = zn;
+	delete [] GJack;	GJack = j;
+
+	MaxReps = max;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T MRP_Checkpoint::Write( const char *FileName ) const
+	Bool_T MRP_Checkpoint::Read( const char *FileName )
+
+PURPOSE:
+	Write and read the checkpoint file. The file is first written to a
+temporary file, which is then renamed (so that a run interrupted while writing
+leaves the previous checkpoint intact). Reading fails if the file was written
+by a different version of the program (or on a different machine).
+
+PARAMETERS:
+	const char *FileName
+		Checkpoint file name.
+
+RETURN VALUE:
+	Success status. When reading fails, the object is left empty.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T MRP_Checkpoint::Write( const char *FileName )
+const
+{
+	assert( FileName != NULL && *FileName );
+
+	char TmpName[ FILENAME_MAX + 5 ];
+
+	if( strlen( FileName ) > FILENAME_MAX ) return False;
+	sprintf( TmpName, "%s.tmp", FileName );
+
+	FILE *fp = fopen( TmpName, "wb" );
+	if( fp == NULL ) return False;
+
+	Int_T NameLen[ INPUTS ];
+	for( Int_T i = 0; i < INPUTS; i++ )
+		NameLen[i] = InputName[i] ? (Int_T) strlen( InputName[i] ) : 0;
+
+	Int_T Head[4] = { CKPT_VERSION, sizeof( Int_T ), sizeof( Real_T ),
+		sizeof( MTRand::uint32 ) };
+	Int_T Sizes[7] = { BatchSize, Gamma, NumBatches, Reps, WarmLen,
+		HasCtrlMean, JackGroups };
+	Real_T Params[6] = { DegreesFreedom, CiDenom, Za, OptGap, Elapsed,
+		CtrlMean };
+
+	Bool_T Success = Bool_T(
+		WriteBinArray( fp, CheckpointMagic, CKPT_MAGIC_LEN ) &&
+		WriteBinArray( fp, Head, 4 ) && WriteBinArray( fp, Sizes, 7 ) &&
+		WriteBinArray( fp, Params, 6 ) && WriteBinArray( fp, Method, 4 ) &&
+		WriteBinArray( fp, NameLen, INPUTS ) &&
+		WriteBinArray( fp, InputName[0], NameLen[0] ) &&
+		WriteBinArray( fp, InputName[1], NameLen[1] ) &&
+		WriteBinArray( fp, InputName[2], NameLen[2] ) &&
+		WriteBinArray( fp, InputStamp, INPUTS ) &&
+		WriteBinArray( fp, Origin, MTRand::SAVE ) &&
+		WriteBinArray( fp, State, MTRand::SAVE ) &&
+		WriteBinArray( fp, BatchState, MTRand::SAVE ) &&
+		WriteBinArray( fp, GBar, Reps ) && WriteBinArray( fp, Var, Reps ) &&
+		WriteBinArray( fp, CI, Reps ) && WriteBinArray( fp, ZnBar, Reps ) &&
+		WriteBinArray( fp, Zn, Reps * NumBatches ) &&
+		WriteBinArray( fp, GJack, JackGroups ? Reps : 0 ) &&
+		WriteBinArray( fp, WarmStart, WarmLen ) &&
+		WriteBinArray( fp, CheckpointMagic, CKPT_MAGIC_LEN ) );
+
+	if( fclose( fp ) != 0 )
+		Success = False;
+
+	if( Success )
+	{
+		remove( FileName );
+		Success = Bool_T( rename( TmpName, FileName ) == 0 );
+	}
+
+	if( !Success )
+		remove( TmpName );
+
+	return Success;
+}
+
+
+Bool_T MRP_Checkpoint::Read( const char *FileName )
+{
+	assert( FileName != NULL && *FileName );
+
+	Free();
+
+	FILE *fp = fopen( FileName, "rb" );
+	if( fp == NULL ) return False;
+
+	char Magic[ CKPT_MAGIC_LEN ];
+	Int_T Head[4], Sizes[7], Meth[4], NameLen[ INPUTS ];
+	Real_T Params[6];
+
+	Bool_T Success = Bool_T(
+		ReadBinArray( fp, Magic, CKPT_MAGIC_LEN ) &&
+		memcmp( Magic, CheckpointMagic, CKPT_MAGIC_LEN ) == 0 &&
+		ReadBinArray( fp, Head, 4 ) &&
+		Head[0] == CKPT_VERSION && Head[1] == (Int_T) sizeof( Int_T ) &&
+		Head[2] == (Int_T) sizeof( Real_T ) &&
+		Head[3] == (Int_T) sizeof( MTRand::uint32 ) &&
+		ReadBinArray( fp, Sizes, 7 ) && ReadBinArray( fp, Params, 6 ) &&
+		Sizes[0] > 0 && Sizes[1] > 0 && Sizes[2] > 0 && Sizes[3] >= 0 &&
+		Sizes[4] >= 0 && Sizes[6] >= 0 &&
+		ReadBinArray( fp, Meth, 4 ) && ReadBinArray( fp, NameLen, INPUTS ) );
+
+	for( Int_T i = 0; Success && i < INPUTS; i++ )
+		if( NameLen[i] < 0 || NameLen[i] > FILENAME_MAX )
+			Success = False;
+
+	if( Success )
+	{
+		Start( Sizes[0], Sizes[1], Sizes[2], Params[0], Params[1], Params[2],
+			Params[3], Sizes[6] );
+		Elapsed		= Params[4];
+		HasCtrlMean	= (Bool_T) ( Sizes[5] != 0 );
+		CtrlMean	= Params[5];
+		memcpy( Method, Meth, sizeof( Method ) );
+
+		for( Int_T i = 0; Success && i < INPUTS; i++ )
+		{
+			InputName[i] = new char[ NameLen[i] + 1 ];
+			InputName[i][ NameLen[i] ] = '\0';
+			Success = ReadBinArray( fp, InputName[i], NameLen[i] );
+		}
+		Success = Bool_T( Success &&
+			ReadBinArray( fp, InputStamp, INPUTS ) );
+
+		Reserve( Sizes[3] );
+		Reps = Sizes[3];
+		if( ( WarmLen = Sizes[4] ) > 0 )
+			WarmStart = new Real_T[ WarmLen ];
+
+		Success = Bool_T( Success &&
+			ReadBinArray( fp, Origin, MTRand::SAVE ) &&
+			ReadBinArray( fp, State, MTRand::SAVE ) &&
+			ReadBinArray( fp, BatchState, MTRand::SAVE ) &&
+			ReadBinArray( fp, GBar, Reps ) && ReadBinArray( fp, Var, Reps ) &&
+			ReadBinArray( fp, CI, Reps ) && ReadBinArray( fp, ZnBar, Reps ) &&
+			ReadBinArray( fp, Zn, Reps * NumBatches ) &&
+			ReadBinArray( fp, GJack, JackGroups ? Reps : 0 ) &&
+			ReadBinArray( fp, WarmStart, WarmLen ) &&
+			ReadBinArray( fp, Magic, CKPT_MAGIC_LEN ) &&
+			memcmp( Magic, CheckpointMagic, CKPT_MAGIC_LEN ) == 0 );
+
+		for( Int_T r = 0; Success && r < Reps; r++ )
+			Accumulate( r );
+	}
+
+	fclose( fp );
+
+	if( !Success )
+	{
+		Free();
+		ClearInputs();
+		BatchSize = Gamma = NumBatches = 0;
+	}
+
+	return Success;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T MRP_Checkpoint::SetInputs( const char *Core, const char *Time,
+		const char *Stoch )
+	void MRP_Checkpoint::SetMethod( Int_T Sampling, Bool_T Antithetic,
+		Bool_T ControlVariate, Int_T Procedure )
+	void MRP_Checkpoint::ClearInputs( void )
+	void MRP_Checkpoint::CopyInputs( const MRP_Checkpoint &c )
+
+PURPOSE:
+	The identity of the run, which "SameDesign()" compares along with the
+design. The first function stores the names of the three input files with
+their sizes and modification times (as the problem cache does). The second one
+stores the sampling method, the use of the antithetic pairs and of the control
+variate and the gap estimation procedure. The last two clear the identity and
+copy it from another object.
+
+PARAMETERS:
+	const char *Core, const char *Time, const char *Stoch
+		Input file names.
+
+	Int_T Sampling, Bool_T Antithetic, Bool_T ControlVariate,
+	Int_T Procedure
+		The options of the same names (see "DecompOptions").
+
+	const MRP_Checkpoint &c
+		Another object.
+
+RETURN VALUE:
+	Success status (the first function fails if a file cannot be found).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T MRP_Checkpoint::SetInputs( const char *Core, const char *Time, // )
+	const char *Stoch )
+{
+	const char *Name[ INPUTS ] = { Core, Time, Stoch };
+
+	for( Int_T i = 0; i < INPUTS; i++ )
+	{
+		assert( Name[i] != NULL );
+
+		struct stat st;
+
+		if( stat( Name[i], &st ) != 0 )
+			return False;
+
+		delete [] InputName[i];
+		InputName[i] = new char[ strlen( Name[i] ) + 1 ];
+		strcpy( InputName[i], Name[i] );
+		InputStamp[i][0] = (long) st.st_size;
+		InputStamp[i][1] = (long) st.st_mtime;
+	}
+
+	return True;
+}
+
+
+void MRP_Checkpoint::SetMethod( Int_T Sampling, Bool_T Antithetic, // )
+	Bool_T ControlVariate, Int_T Procedure )
+{
+	Method[0] = Sampling;
+	Method[1] = Antithetic;
+	Method[2] = ControlVariate;
+	Method[3] = Procedure;
+}
+
+
+void MRP_Checkpoint::ClearInputs( void )
+{
+	for( Int_T i = 0; i < INPUTS; i++ )
+	{
+		delete [] InputName[i];
+		InputName[i] = NULL;
+	}
+	memset( InputStamp, 0, sizeof( InputStamp ) );
+	memset( Method, 0, sizeof( Method ) );
+}
+
+
+void MRP_Checkpoint::CopyInputs( const MRP_Checkpoint &c )
+{
+	ClearInputs();
+	for( Int_T i = 0; i < INPUTS; i++ )
+		if( c.InputName[i] != NULL )
+		{
+			InputName[i] = new char[ strlen( c.InputName[i] ) + 1 ];
+			strcpy( InputName[i], c.InputName[i] );
+		}
+	memcpy( InputStamp, c.InputStamp, sizeof( InputStamp ) );
+	memcpy( Method, c.Method, sizeof( Method ) );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T MRP_Checkpoint::SameDesign( const MRP_Checkpoint &c ) const
+	Bool_T MRP_Checkpoint::Append( const MRP_Checkpoint &c )
+
+PURPOSE:
+	The first function checks whether both objects describe runs of the same
+design (batch size, shift, number of batches, the confidence interval, the
+optimality gap and the jackknife groups) on the same input files, with the
+scenarios sampled and the gap estimated in the same way (see "SetInputs()" and
+"SetMethod()"). The second one appends the
+replications of "c" to those of this object (adding up the run times). It fails
+if the designs differ or if "c" started from the same generator state as any
+run appended before (its replications would then be copies of theirs: the
+origins of all the appended runs are kept). An empty object takes the design
+of "c".
+
+PARAMETERS:
+	const MRP_Checkpoint &c
+		Another object.
+
+RETURN VALUE:
+	Success status.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T MRP_Checkpoint::SameDesign( const MRP_Checkpoint &c )
+const
+{
+	if( BatchSize != c.BatchSize || Gamma != c.Gamma ||
+		NumBatches != c.NumBatches || DegreesFreedom != c.DegreesFreedom ||
+		CiDenom != c.CiDenom || Za != c.Za || OptGap != c.OptGap ||
+		JackGroups != c.JackGroups ||
+		memcmp( Method, c.Method, sizeof( Method ) ) != 0 ||
+		memcmp( InputStamp, c.InputStamp, sizeof( InputStamp ) ) != 0 )
+		return False;
+
+	for( Int_T i = 0; i < INPUTS; i++ )
+		if( InputName[i] == NULL || c.InputName[i] == NULL ||
+			strcmp( InputName[i], c.InputName[i] ) != 0 )
+			return False;
+
+	return True;
+}
+
+
+Bool_T MRP_Checkpoint::Append( const MRP_Checkpoint &c )
+{
+	assert( c.NumBatches > 0 );
+
+	if( NumBatches == 0 )
+	{
+		Start( c.BatchSize, c.Gamma, c.NumBatches, c.DegreesFreedom,
+			c.CiDenom, c.Za, c.OptGap, c.JackGroups );
+		CopyInputs( c );
+		memcpy( Origin, c.Origin, sizeof( Origin ) );
+	}
+	else if( !SameDesign( c ) )
+		return False;
+
+	Int_T k;
+
+	for( k = 0; k < Runs; k++ )
+		if( memcmp( RunOrigin + k * MTRand::SAVE, c.Origin,
+			sizeof( Origin ) ) == 0 )
+			return False;
+
+	MTRand::uint32 *o = new MTRand::uint32[ ( Runs + 1 ) * MTRand::SAVE ];
+
+	if( Runs > 0 )
+		memcpy( o, RunOrigin, Runs * sizeof( Origin ) );
+	memcpy( o + Runs * MTRand::SAVE, c.Origin, sizeof( Origin ) );
+	delete [] RunOrigin;
+	RunOrigin = o;
+	Runs++;
+
+	Reserve( Reps + c.Reps );
+	for( Int_T r = 0; r < c.Reps; r++ )
+		Record( Reps, c.GBar[r], c.Var[r], c.CI[r], c.ZnBar[r],
+			c.Zn + r * NumBatches, c.GJack[r] );
+	Elapsed += c.Elapsed;
+
+	return True;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void MRP_Checkpoint::Record( Int_T Rep, Real_T GBar, Real_T Var,
+		Real_T CI, Real_T ZnBar, const Real_T *Zn, Real_T GJack )
+	void MRP_Checkpoint::GetReplication( Int_T Rep, Real_T &GBar,
+		Real_T &Var, Real_T &CI, Real_T &ZnBar, Real_T *Zn,
+		Real_T &GJack ) const
+	void MRP_Checkpoint::Accumulate( Int_T Rep )
+
+PURPOSE:
+	Store and read the results of replication "Rep". The replications have to
+be recorded in order (and there has to be room for them, see "Reserve()").
+"Accumulate()" adds replication "Rep" to the running statistics (in O(1)
+time).
+
+PARAMETERS:
+	Int_T Rep
+		Replication number.
+
+	Real_T GBar, Real_T Var, Real_T CI, Real_T ZnBar
+		Gap estimate, its variance, the upper confidence bound and the average
+		batch optimal value.
+
+	Real_T *Zn
+		Optimal values of the "NumBatches" batches.
+
+	Real_T GJack
+		The jackknife bias-corrected gap estimate (ignored, and returned as
+		"GBar", without the jackknife).
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void MRP_Checkpoint::Record( Int_T Rep, Real_T g, Real_T v, Real_T c, // )
+	Real_T z, const Real_T *zn, Real_T j )
+{
+	assert( Rep == Reps && Rep < MaxReps );
+	assert( zn != NULL );
+
+	GBar[ Rep ]		= g;
+	Var[ Rep ]		= v;
+	CI[ Rep ]		= c;
+	ZnBar[ Rep ]	= z;
+	GJack[ Rep ]	= JackGroups ? j : g;
+	memcpy( Zn + Rep * NumBatches, zn, NumBatches * sizeof( Real_T ) );
+	Accumulate( Rep );
+
+	Reps++;
+}
+
+
+void MRP_Checkpoint::GetReplication( Int_T Rep, Real_T &g, Real_T &v, // )
+	Real_T &c, Real_T &z, Real_T *zn, Real_T &j )
+const
+{
+	assert( Rep >= 0 && Rep < Reps );
+	assert( zn != NULL );
+
+	g	= GBar[ Rep ];
+	v	= Var[ Rep ];
+	c	= CI[ Rep ];
+	z	= ZnBar[ Rep ];
+	j	= GJack[ Rep ];
+	memcpy( zn, Zn + Rep * NumBatches, NumBatches * sizeof( Real_T ) );
+}
+
+
+void MRP_Checkpoint::Accumulate( Int_T Rep )
+{
+	GapStat.Add( GBar[ Rep ] );
+	VarStat.Add( Var[ Rep ] );
+	WidthStat.Add( Za * sqrt( Var[ Rep ] ) / sqrt( CiDenom ) );
+	SizeStat.Add( CI[ Rep ] );
+	if( CI[ Rep ] >= OptGap ) Covered++;
+
+	if( JackGroups > 0 )
+	{
+		Real_T ub = GJack[ Rep ] + Za * sqrt( Var[ Rep ] ) / sqrt( CiDenom );
+
+		JackStat.Add( GJack[ Rep ] );
+		JackSizeStat.Add( ub );
+		if( ub >= OptGap ) JackCovered++;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Real_T MRP_Checkpoint::CoverageHalfWidth( void ) const
+	void MRP_Checkpoint::PrintProgress( void ) const
+
+PURPOSE:
+	The first function computes the half-width of the confidence interval on
+the coverage. The interval of the stochastic knapsack driver,
+
+		coverage +- za * sqrt( coverage * ( 1 - coverage ) / replications ),
+
+has zero width while all (or none) of the intervals cover the true gap, which
+would stop an adaptive run after its first few replications. Hence the
+Agresti-Coull form is used: "za^2 / 2" covering and "za^2 / 2" not covering
+replications are added to the counts, i.e.
+
+		p = ( covered + za^2 / 2 ) / ( replications + za^2 ),
+		half-width = za * sqrt( p * ( 1 - p ) / ( replications + za^2 ) ).
+
+It is never zero and approaches the former one as the replications grow. The
+second function prints one line with the running statistics of the
+replications recorded so far.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	The half-width (the first function).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Real_T MRP_Checkpoint::CoverageHalfWidth( void )
+const
+{
+	Real_T z2 = Za * Za,
+		n = Reps + z2,
+		p = ( Covered + z2 / 2.0 ) / n;
+
+	return Za * sqrt( p * ( 1.0 - p ) / n );
+}
+
+
+void MRP_Checkpoint::PrintProgress( void )
+const
+{
+	Print( "MRP %d: gap %lf, variance %lf, CI width %lf, coverage %lf +- %lf\n",
+		(int) Reps, GapStat.GetMean(), VarStat.GetMean(), WidthStat.GetMean(),
+		GetCoverage(), CoverageHalfWidth() );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void MRP_Checkpoint::PrintSummary( void ) const
+
+PURPOSE:
+	Prints the coverage statistics of the recorded replications: the average
+confidence interval width, the coverage (of the true optimality gap), the
+average variance and the variance of the variance estimates, the average upper
+confidence bound and their variances (all from the running statistics). With
+the jackknife also the average bias-corrected gap estimate, the average bias
+correction and the coverage and the average upper bound of the intervals of
+the same width around the corrected estimates, with a warning that these may
+overcorrect.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void MRP_Checkpoint::PrintSummary( void )
+const
+{
+	// Statistics on variance calculations
+	double avgVar = VarStat.GetMean(),
+		varVariance = VarStat.GetVariance();
+	// Statistics on confidence interval width
+	double ciWidth = WidthStat.GetMean(),
+		varCIWidth = WidthStat.GetVariance();
+	// Statistics on total CI size
+	double ciSize = SizeStat.GetMean(),
+		varCISize = SizeStat.GetVariance();
+
+	double cov = GetCoverage();
+
+	Print("BEGIN MRP\n");
+	Print("Batch Size = %d\n", BatchSize);
+	Print("gamma = %d\n", Gamma);
+	Print("CI Width = %lf\n", ciWidth);
+	Print("Coverage, MRP: = %lf\n", cov);
+	Print("Average Variance = %lf\n", avgVar );
+	Print("Variance of Variance = %le\n", varVariance );
+	Print("Number Batches = %d\n", NumBatches);
+	Print("Degrees Freedom = %lf\n", DegreesFreedom);
+	Print("CI Denom = %lf\n", CiDenom);
+	Print("Var CI Width = %lf\n", varCIWidth);
+	Print("CI Sze = %lf\n", ciSize);
+	Print("Var CI Size = %lf\n", varCISize);
+	if( JackGroups > 0 )
+	{
+		Print("Jackknife Groups = %d\n", JackGroups);
+		Print("Jackknife Gap = %lf\n", JackStat.GetMean());
+		Print("Jackknife Bias = %lf\n",
+			GapStat.GetMean() - JackStat.GetMean());
+		Print("Coverage, Jackknife: = %lf\n",
+			( Reps > 0 ) ? (double) JackCovered / Reps : 0.0);
+		Print("Jackknife CI Size = %lf\n", JackSizeStat.GetMean());
+		Print("(The jackknife gap may overcorrect and its coverage fall below "
+			"the nominal\n one; it does not replace the MRP gap.)\n");
+	}
+	Print("Time = %0.0lf\n", Elapsed );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void MRP_Checkpoint::MarkOrigin( void )
+	void MRP_Checkpoint::SetWarmStart( const Real_T *x, Int_T n )
+	Bool_T MRP_Checkpoint::GetWarmStart( Real_T *x, Int_T n ) const
+
+PURPOSE:
+	The first function stores the batch generator state as the origin of the
+run (see "Append()"). The other two store and read the starting point of the
+first batch of a replication. Reading fails if no point of dimension "n" was
+stored.
+
+PARAMETERS:
+	Real_T *x, Int_T n
+		The point and its dimension.
+
+RETURN VALUE:
+	Success status (the last function).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void MRP_Checkpoint::MarkOrigin( void )
+{ memcpy( Origin, BatchState, sizeof( Origin ) ); }
+
+
+void MRP_Checkpoint::SetWarmStart( const Real_T *x, Int_T n )
+{
+	assert( x != NULL && n > 0 );
+
+	if( n != WarmLen )
+	{
+		delete [] WarmStart;
+		WarmStart = new Real_T[ WarmLen = n ];
+	}
+	memcpy( WarmStart, x, n * sizeof( Real_T ) );
+}
+
+
+Bool_T MRP_Checkpoint::GetWarmStart( Real_T *x, Int_T n )
+const
+{
+	assert( x != NULL );
+
+	if( n != WarmLen || WarmLen == 0 ) return False;
+
+	memcpy( x, WarmStart, n * sizeof( Real_T ) );
+	return True;
+}
@@ -0,0 +1,238 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		File input / output routines.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+HEADER FILE NAME:	mrp_ckpt.h
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.19
+
+DEPENDENCIES:		stdtype.h, mersenne_twister.h, obm_stat.h
+
+--------------------------------------------------------------------------------
+
+HEADER CONTENTS:
+	Declaration of class "MRP_Checkpoint". The object collects the results of
+the replications of the multiple replication procedure (the gap estimate, its
+variance and the upper confidence bound of every replication, the optimal
+values of all batches, and the jackknife bias-corrected gap estimate if there is
+one) and prints the coverage statistics computed from them.
+The statistics are updated as the replications are recorded, so that the run
+may report its progress and stop as soon as the coverage is known precisely
+enough (option "-cov_hw").
+	It may be written to a checkpoint file (option "-checkpoint") every few
+replications. Apart from the results the file holds the design of the
+procedure, the identity of the input files (their names, sizes and
+modification times), the way the scenarios are sampled and the gap estimated,
+the states of the random number generator (that of "Random01" and the one the
+next batch of scenarios starts from), the starting point of the first batch of
+a replication, the control variate mean and the run time. A run started with
+option "-resume" reads the file and goes on with the next replication. The
+generator states are restored, so the results are those of an uninterrupted
+run.
+	Checkpoints of independently seeded runs of the same design may be merged
+(see "Append()" and program "mrp_merge"), so that the replications may be
+shared among several computers.
+
+------------------------------------------------------------------------------*/
+
+#ifndef __MRP_CKPT_H__
+#define __MRP_CKPT_H__
+
+#ifndef __STDTYPE_H__
+#	include "stdtype.h"
+#endif
+
+#include "mersenne_twister.h"
+
+#ifndef __OBM_STAT_H__
+#	include "obm_stat.h"
+#endif
+
+//==============================================================================
+//
+//	Class "MRP_Checkpoint" declaration.
+//
+//==============================================================================
+
+class MRP_Checkpoint
+{
+private:
+	Int_T BatchSize, Gamma, NumBatches;	// The design of the procedure ...
+	Real_T DegreesFreedom, CiDenom, Za,	// ... and of the confidence
+		OptGap;							// intervals.
+	Int_T JackGroups;			// Jackknife groups (0 - no jackknife).
+
+	enum { INPUTS = 3 };
+	char *InputName[ INPUTS ];	// The core, time and stoch files: names,
+	long InputStamp[ INPUTS ][2];	// sizes and modification times.
+	Int_T Method[4];			// Sampling method, antithetic pairs, control
+								// variate and the gap estimation procedure.
+
+	Int_T Reps, MaxReps;		// Replications recorded and allocated.
+	Real_T *GBar, *Var, *CI,	// [MaxReps] Results of the replications.
+		*ZnBar;
+	Real_T *Zn;					// [MaxReps*NumBatches] Batch optimal values.
+	Real_T *GJack;				// [MaxReps] Bias-corrected gap estimates.
+
+	RunningStat GapStat, VarStat,	// Running statistics of the gap
+		WidthStat, SizeStat;		// estimates, their variances, the widths
+									// and the upper bounds of the confidence
+									// intervals.
+	Int_T Covered;				// Intervals covering the true gap.
+	RunningStat JackStat,		// The same for the bias-corrected gap
+		JackSizeStat;			// estimates and the upper bounds of their
+	Int_T JackCovered;			// intervals (of the same width).
+
+	Real_T Elapsed;				// Run time (in seconds).
+
+	MTRand::uint32 Origin[ MTRand::SAVE ],	// Generator states: at the first
+		State[ MTRand::SAVE ],				// replication, current and
+		BatchState[ MTRand::SAVE ];			// that of the next batch.
+	Int_T Runs;					// [Runs*MTRand::SAVE] Origins of the runs
+	MTRand::uint32 *RunOrigin;	// appended (see "Append()").
+
+	Int_T WarmLen;				// Starting point of the first batch.
+	Real_T *WarmStart;
+
+	Bool_T HasCtrlMean;			// Control variate mean (if estimated).
+	Real_T CtrlMean;
+
+private:
+	MRP_Checkpoint( const MRP_Checkpoint & );
+	MRP_Checkpoint &operator=( const MRP_Checkpoint & );
+
+	void Free( void );
+	void Accumulate( Int_T Rep );
+	void ClearInputs( void );
+	void CopyInputs( const MRP_Checkpoint &c );
+
+public:
+	MRP_Checkpoint( void );
+	~MRP_Checkpoint( void );
+
+	void Start( Int_T BatchSize, Int_T Gamma, Int_T NumBatches,
+		Real_T DegreesFreedom, Real_T CiDenom, Real_T Za, Real_T OptGap,
+		Int_T JackGroups );
+	void Reserve( Int_T MaxReps );
+
+	//--------------------------------------------------------------------------
+	//	The identity of the run: the input files and the way the scenarios
+	//	are sampled and the gap is estimated (compared by "SameDesign()").
+	//
+	Bool_T SetInputs( const char *Core, const char *Time, const char *Stoch );
+	void SetMethod( Int_T Sampling, Bool_T Antithetic, Bool_T ControlVariate,
+		Int_T Procedure );
+
+	Bool_T Write( const char *FileName ) const;
+	Bool_T Read( const char *FileName );
+
+	Bool_T SameDesign( const MRP_Checkpoint &c ) const;
+	Bool_T Append( const MRP_Checkpoint &c );
+
+	//--------------------------------------------------------------------------
+	//	Results of the replications.
+	//
+	void Record( Int_T Rep, Real_T GBar, Real_T Var, Real_T CI, Real_T ZnBar,
+		const Real_T *Zn, Real_T GJack );
+	void GetReplication( Int_T Rep, Real_T &GBar, Real_T &Var, Real_T &CI,
+		Real_T &ZnBar, Real_T *Zn, Real_T &GJack ) const;
+	Int_T GetReplications( void ) const;
+
+	//--------------------------------------------------------------------------
+	//	The coverage of the true gap and the half-width of its (binomial)
+	//	confidence interval.
+	//
+	Real_T GetCoverage( void ) const;
+	Real_T CoverageHalfWidth( void ) const;
+
+	void PrintProgress( void ) const;
+	void PrintSummary( void ) const;
+
+	//--------------------------------------------------------------------------
+	//	The data needed to resume the run. "MarkOrigin()" stores the batch
+	//	generator state of the first replication (it identifies the stream of
+	//	random numbers of the run).
+	//
+	MTRand::uint32 *GetState( void );
+	MTRand::uint32 *GetBatchState( void );
+	void MarkOrigin( void );
+
+	void SetWarmStart( const Real_T *x, Int_T n );
+	Bool_T GetWarmStart( Real_T *x, Int_T n ) const;
+
+	void SetControlMean( Real_T m );
+	Bool_T GetControlMean( Real_T &m ) const;
+
+	void SetTime( Real_T t );
+	Real_T GetTime( void ) const;
+};
+
+//==============================================================================
+//
+//	End of class "MRP_Checkpoint" declaration.
+//
+//==============================================================================
+
+
+//==============================================================================
+//
+//	Inline functions.
+//
+//==============================================================================
+
+inline
+Int_T MRP_Checkpoint::GetReplications( void )
+const
+{ return Reps; }
+
+
+inline
+Real_T MRP_Checkpoint::GetCoverage( void )
+const
+{ return ( Reps > 0 ) ? (Real_T) Covered / Reps : 0.0; }
+
+
+inline
+MTRand::uint32 *MRP_Checkpoint::GetState( void )
+{ return State; }
+
+
+inline
+MTRand::uint32 *MRP_Checkpoint::GetBatchState( void )
+{ return BatchState; }
+
+
+inline
+void MRP_Checkpoint::SetControlMean( Real_T m )
+{ HasCtrlMean = True; CtrlMean = m; }
+
+
+inline
+Bool_T MRP_Checkpoint::GetControlMean( Real_T &m )
+const
+{
+	if( HasCtrlMean ) m = CtrlMean;
+	return HasCtrlMean;
+}
+
+
+inline
+void MRP_Checkpoint::SetTime( Real_T t )
+{ Elapsed = t; }
+
+
+inline
+Real_T MRP_Checkpoint::GetTime( void )
+const
+{ return Elapsed; }
+
+
+#endif
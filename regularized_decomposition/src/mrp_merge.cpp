@@ -0,0 +1,82 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		The main module.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE NAME:	mrp_merge.cpp
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.19
+
+DEPENDENCIES:		mrp_ckpt.h, print.h, error.h, stdtype.h
+					<stdio.h>
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE CONTENTS:
+	Program "mrp_merge". It reads the checkpoint files of several
+independently seeded runs of the multiple replication procedure (see option
+"-checkpoint" of "decomp"), combines their replications and prints the
+coverage statistics of all of them (in the same form as "decomp" does). Thus
+the replications of a long experiment may be shared among several computers.
+	The runs have to have the same design (batch size, shift, number of
+batches and the confidence interval), the same sampling options and the same
+input files (of the same names, sizes and modification times: the copies of
+the files have to keep their times). Files of runs started from the same
+generator state are rejected (their replications would be the same). The run
+time printed is the sum of the run times of all files.
+
+	Usage:
+		mrp_merge <ckpt_file> <ckpt_file> ...
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#ifndef __MRP_CKPT_H__
+#	include "mrp_ckpt.h"
+#endif
+#ifndef __PRINT_H__
+#	include "print.h"
+#endif
+#ifndef __ERROR_H__
+#	include "error.h"
+#endif
+
+
+int main( int argc, char *argv[] )
+{
+	if( argc <= 1 )
+	{
+		Print( "Usage: %s <ckpt_file> <ckpt_file> ...\n", argv[0] );
+		return -1;
+	}
+
+	MRP_Checkpoint All;
+
+	for( int i = 1; i < argc; i++ )
+	{
+		MRP_Checkpoint c;
+
+		if( !c.Read( argv[i] ) )
+			FatalError( "Cannot read the checkpoint file %s.", argv[i] );
+		if( !All.Append( c ) )
+			FatalError( "The checkpoint file %s does not belong to an "
+				"independent run of the same design.", argv[i] );
+
+		Print( "%s: %d replications.\n", argv[i],
+			(int) c.GetReplications() );
+	}
+
+	Print( "MERGED %d FILES, %d REPLICATIONS.\n", argc - 1,
+		(int) All.GetReplications() );
+	All.PrintSummary();
+
+	return 0;
+}
@@ -0,0 +1,266 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		General purpose mathematical module.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE NAME:	obm_stat.cpp
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.18
+
+DEPENDENCIES:		obm_stat.h
+					<assert.h>
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE CONTENTS:
+	Implementation of class "OverlappingBatchMeans" (the overlapping batch
+means estimators of the multiple replication procedure).
+
+--------------------------------------------------------------------------------
+
+PUBLIC INTERFACE:
+	OverlappingBatchMeans::OverlappingBatchMeans( int BatchSize, int Gamma,
+		int NumBatches )
+	OverlappingBatchMeans::~OverlappingBatchMeans( void )
+
+	void OverlappingBatchMeans::Clear( void )
+	void OverlappingBatchMeans::AddBatch( int b, double Mean )
+	int OverlappingBatchMeans::HeadPoints( int b ) const
+	int OverlappingBatchMeans::TailStart( int b ) const
+	void OverlappingBatchMeans::AddPoint( int b, int j, double Value )
+
+	static double OverlappingBatchMeans::Variance( const double *BatchMeans,
+		int NumBatches, double Mean, double DegreesOfFreedom )
+
+------------------------------------------------------------------------------*/
+
+#include <assert.h>
+
+#ifndef __OBM_STAT_H__
+#	include "obm_stat.h"
+#endif
+
+
+/*------------------------------------------------------------------------------
+
+	OverlappingBatchMeans::OverlappingBatchMeans( int BatchSize, int Gamma,
+		int NumBatches )
+	OverlappingBatchMeans::~OverlappingBatchMeans( void )
+
+PURPOSE:
+	Constructor and destructor. The constructor counts the batches containing
+each point (the batch "b" adds one on the range "b * gamma", ...,
+"b * gamma + m - 1" of a difference array, the prefix sums give the counts) and
+finds the range of the interior points.
+
+PARAMETERS:
+	int BatchSize, int Gamma, int NumBatches
+		Batch size "m", shift "gamma" and number of batches "k" (all positive).
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+OverlappingBatchMeans::OverlappingBatchMeans( int BatchSize, int Gamma, // )
+	int NumBatches )
+	: m( BatchSize ), gamma( Gamma ), k( NumBatches ),
+	n( BatchSize + ( NumBatches - 1 ) * Gamma ), Count( 0 ), Base( 0.0 ),
+	First( 0 ), Last( 0 ), Means( 0 ), Sum( 0.0 )
+{
+	assert( m > 0 && gamma > 0 && k > 0 );
+
+	Count = new int[ n + 1 ];
+	Means = new double[ k ];
+
+	int i, b;
+
+	for( i = 0; i <= n; i++ )
+		Count[i] = 0;
+	for( b = 0; b < k; b++ )
+	{
+		Count[ b * gamma ]++;
+		Count[ b * gamma + m ]--;
+	}
+	for( i = 1; i < n; i++ )
+		Count[i] += Count[i-1];
+
+	//--------------------------------------------------------------------------
+	//	When "gamma" divides "m", the counts grow to their maximum, stay there
+	//	and then fall; the points of the plateau share the weight "Base".
+	//	Otherwise the counts alternate and every point is weighted on its own.
+	//
+	First = Last = n;
+	if( m % gamma == 0 )
+	{
+		int Max = 0;
+
+		for( i = 0; i < n; i++ )
+			if( Count[i] > Max ) Max = Count[i];
+		for( First = 0; Count[ First ] < Max; First++ )
+			;
+		for( Last = n; Count[ Last - 1 ] < Max; Last-- )
+			;
+		Base = 1.0 / Max;
+
+#ifndef NDEBUG
+		for( i = First; i < Last; i++ )
+			assert( Count[i] == Max );
+#endif
+	}
+
+	Clear();
+}
+
+
+OverlappingBatchMeans::~OverlappingBatchMeans( void )
+{
+	delete [] Count;
+	delete [] Means;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void OverlappingBatchMeans::Clear( void )
+
+PURPOSE:
+	Prepares the object for the next replication.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void OverlappingBatchMeans::Clear( void )
+{
+	Sum = 0.0;
+	for( int b = 0; b < k; b++ )
+		Means[b] = 0.0;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void OverlappingBatchMeans::AddBatch( int b, double Mean )
+	int OverlappingBatchMeans::HeadPoints( int b ) const
+	int OverlappingBatchMeans::TailStart( int b ) const
+	void OverlappingBatchMeans::AddPoint( int b, int j, double Value )
+
+PURPOSE:
+	Collection of the data of batch "b". The mean of the batch accounts for
+the interior points at the weight "Base". "AddPoint()" adds the difference
+between the own weight of a point and "Base"; it is only needed for the points
+"j < HeadPoints( b )" and "j >= TailStart( b )" of the batch (for all points if
+"Base" is zero).
+
+PARAMETERS:
+	int b
+		Batch number (0 <= b < k).
+
+	double Mean
+		The batch mean (the average of the values of all its points).
+
+	int j, double Value
+		Point number within the batch (0 <= j < m) and its value.
+
+RETURN VALUE:
+	See above.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void OverlappingBatchMeans::AddBatch( int b, double Mean )
+{
+	assert( b >= 0 && b < k );
+
+	Means[b] = Mean;
+	Sum += Base * m * Mean;
+}
+
+
+int OverlappingBatchMeans::HeadPoints( int b )
+const
+{
+	int h = First - b * gamma;
+
+	return ( h < 0 ) ? 0 : ( h > m ) ? m : h;
+}
+
+
+int OverlappingBatchMeans::TailStart( int b )
+const
+{
+	int h = HeadPoints( b ),
+		t = Last - b * gamma;
+
+	return ( t < h ) ? h : ( t > m ) ? m : t;
+}
+
+
+void OverlappingBatchMeans::AddPoint( int b, int j, double Value )
+{
+	assert( b >= 0 && b < k );
+	assert( j >= 0 && j < m );
+
+	Sum += Value * ( 1.0 / Count[ b * gamma + j ] - Base );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static double OverlappingBatchMeans::Variance( const double *BatchMeans,
+		int NumBatches, double Mean, double DegreesOfFreedom )
+
+PURPOSE:
+	Variance estimator of the overlapping batch means: the sum of the squared
+deviations of the batch means from "Mean", divided by "DegreesOfFreedom".
+
+PARAMETERS:
+	const double *BatchMeans, int NumBatches
+		The batch means.
+
+	double Mean
+		The overall mean ("gbar").
+
+	double DegreesOfFreedom
+		The divisor.
+
+RETURN VALUE:
+	The variance estimate.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+double OverlappingBatchMeans::Variance( const double *BatchMeans, // )
+	int NumBatches, double Mean, double DegreesOfFreedom )
+{
+	assert( BatchMeans != 0 && DegreesOfFreedom > 0.0 );
+
+	double s = 0.0;
+
+	for( int b = 0; b < NumBatches; b++ )
+		s += ( BatchMeans[b] - Mean ) * ( BatchMeans[b] - Mean );
+
+	return s / DegreesOfFreedom;
+}
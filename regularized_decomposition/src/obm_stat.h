@@ -0,0 +1,212 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		General purpose mathematical module.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+HEADER FILE NAME:	obm_stat.h
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.19
+
+DEPENDENCIES:		none
+
+--------------------------------------------------------------------------------
+
+HEADER CONTENTS:
+	Declaration of class "OverlappingBatchMeans". The class computes the
+overlapping batch means estimators of the multiple replication procedure. A
+sample of
+
+		n = m + ( k - 1 ) * gamma
+
+points is divided into "k" batches of "m" points; batch "b" consists of the
+points "b * gamma", ..., "b * gamma + m - 1". Every batch yields a mean (the
+gap estimate of the batch) and a value for each of its points. The estimator
+
+		gbar = 1/n * sum_i ( average of the values of point "i" over the
+							batches that contain it )
+
+and the variance of the batch means (about "gbar", divided by the given number
+of degrees of freedom) are computed.
+	The number of the batches containing each point is computed once, from a
+difference array (in O( n )). When "gamma" divides "m", all the points away
+from both ends of the sample are contained in the same number of batches;
+their contribution to "gbar" follows from the batch means alone. Only the
+values of the remaining points (the first and the last "m" points of the
+sample) have to be supplied, by every batch containing them: about
+"m / gamma" batches at each end, with up to "m" points each. A replication
+then takes O( k + m * m / gamma ) instead of O( k * m ) (besides solving the
+batches). Otherwise all the values are needed.
+	Class "RunningStat" accumulates the mean and the variance of a sequence of
+values in one pass (Welford's updates), so that the statistics of the
+replications may be reported while they are being done.
+	The module does not depend on the rest of the project, so that the other
+multiple replication drivers (the newsvendor and the stochastic knapsack
+problems) may use it as well.
+
+------------------------------------------------------------------------------*/
+
+#ifndef __OBM_STAT_H__
+#define __OBM_STAT_H__
+
+//==============================================================================
+//
+//	Class "OverlappingBatchMeans" declaration.
+//
+//==============================================================================
+
+class OverlappingBatchMeans
+{
+private:
+	int m, gamma, k, n;			// Batch size, shift, number of batches and
+								// sample size.
+	int *Count;					// [n] Number of the batches containing the
+								// point.
+	double Base;				// Weight shared by the interior points (0 if
+								// "gamma" does not divide "m").
+	int First, Last;			// The points "First", ..., "Last-1" have the
+								// weight "Base".
+	double *Means;				// [k] Batch means.
+	double Sum;					// Weighted sum of the values.
+
+private:
+	OverlappingBatchMeans( const OverlappingBatchMeans & );
+	OverlappingBatchMeans &operator=( const OverlappingBatchMeans & );
+
+public:
+	OverlappingBatchMeans( int BatchSize, int Gamma, int NumBatches );
+	~OverlappingBatchMeans( void );
+
+	void Clear( void );
+
+	//--------------------------------------------------------------------------
+	//	Data of batch "b": its mean and the values of its points "j" for
+	//	"0 <= j < HeadPoints( b )" and "TailStart( b ) <= j < m" (any other
+	//	points are accepted, but not needed).
+	//
+	void AddBatch( int b, double Mean );
+	int HeadPoints( int b ) const;
+	int TailStart( int b ) const;
+	void AddPoint( int b, int j, double Value );
+
+	int GetSampleSize( void ) const;
+	double GetMean( void ) const;
+	double GetVariance( double DegreesOfFreedom ) const;
+
+	static double Variance( const double *BatchMeans, int NumBatches,
+		double Mean, double DegreesOfFreedom );
+};
+
+//==============================================================================
+//
+//	End of class "OverlappingBatchMeans" declaration.
+//
+//==============================================================================
+
+
+
+//==============================================================================
+//
+//	Class "RunningStat" declaration.
+//
+//==============================================================================
+
+class RunningStat
+{
+private:
+	int Count;					// Number of the values,
+	double Mean, M2;			// their mean and the sum of the squared
+								// deviations from the mean.
+
+public:
+	RunningStat( void );
+
+	void Clear( void );
+	void Add( double x );
+
+	int GetCount( void ) const;
+	double GetMean( void ) const;
+	double GetVariance( void ) const;
+};
+
+//==============================================================================
+//
+//	End of class "RunningStat" declaration.
+//
+//==============================================================================
+
+
+//==============================================================================
+//
+//	Inline functions.
+//
+//==============================================================================
+
+inline
+int OverlappingBatchMeans::GetSampleSize( void )
+const
+{ return n; }
+
+
+inline
+double OverlappingBatchMeans::GetMean( void )
+const
+{ return Sum / n; }
+
+
+inline
+double OverlappingBatchMeans::GetVariance( double DegreesOfFreedom )
+const
+{ return Variance( Means, k, GetMean(), DegreesOfFreedom ); }
+
+
+inline
+RunningStat::RunningStat( void )
+	: Count( 0 ), Mean( 0.0 ), M2( 0.0 )
+{}
+
+
+inline
+void RunningStat::Clear( void )
+{ Count = 0; Mean = M2 = 0.0; }
+
+
+inline
+void RunningStat::Add( double x )
+{
+	double d = x - Mean;
+
+	Count++;
+	Mean	+= d / Count;
+	M2		+= d * ( x - Mean );
+}
+
+
+inline
+int RunningStat::GetCount( void )
+const
+{ return Count; }
+
+
+inline
+double RunningStat::GetMean( void )
+const
+{ return Mean; }
+
+
+//------------------------------------------------------------------------------
+//	The sample variance (with the divisor "Count - 1").
+//
+inline
+double RunningStat::GetVariance( void )
+const
+{ return M2 / ( Count - 1 ); }
+
+
+#endif
@@ -156,7 +156,8 @@ STATIC DATA:
 	static FF FileType
 	static int RowType, BoundType
 	static MPS_LP *lp
-	static Bool_T (*GetLabel)( int lbl, int StartCol, int EndCol );
+	static Lexer *Lex
+	static Bool_T (Lexer::*GetLabel)( int lbl, int StartCol, int EndCol );
 
 --------------------------------------------------------------------------------
 
@@ -219,11 +220,16 @@ static MPS_LP *lp = NULL;
 typedef void (MPS_LP::*NewDataPtr)( const char *lab0, const char *lab1,
 	double val );
 
+//------------------------------------------------------------------------------
+//	The lexical analyser reading the input file.
+//
+static Lexer *Lex = NULL;
+
 //------------------------------------------------------------------------------
 //	Static pointers to functions that are different in FIXED and FREE MPS
 //	formats (now there's only one such function - GetLabel).
 //
-static Bool_T (*GetLabel)( int lbl, int StartCol, int EndCol ) = NULL;
+static Bool_T (Lexer::*GetLabel)( int lbl, int StartCol, int EndCol ) = NULL;
 
 
 //==============================================================================
@@ -263,18 +269,22 @@ static Bool_T GetBoundType( void );
 
 /*------------------------------------------------------------------------------
 
-	void SetLP_TargetObject( MPS_LP *_lp )
+	void SetLP_TargetObject( MPS_LP *_lp, Lexer *_lex )
 
 PURPOSE:
 	Since the parser stores retrieved information in an MPS_LP object, a
 pointer to such object is passed. Parser will (when necessary) call public
 member functions of MPS_LP class to pass retrieved information. The functions
-it calls are refered to as "semantic actions".
+it calls are refered to as "semantic actions". The input is read by the lexical
+analyser passed here.
 
 PARAMETERS:
 	MPS_LP *_lp
 		Pointer to target object.
 
+	Lexer *_lex
+		Lexical analyser (attached to the input stream).
+
 RETURN VALUE:
 	None.
 
@@ -283,11 +293,13 @@ SIDE EFFECTS:
 
 ------------------------------------------------------------------------------*/
 
-void SetLP_TargetObject( MPS_LP *_lp )
+void SetLP_TargetObject( MPS_LP *_lp, Lexer *_lex )
 {
 	assert( _lp != NULL );
+	assert( _lex != NULL );
 
-	lp = _lp;
+	lp	= _lp;
+	Lex	= _lex;
 }
 
 
@@ -330,25 +342,25 @@ FF GetNameLine( void )
 	int MsgCode = -1;
 
 	//--------------------------------------------------------------------------
-	if( !Lexer::GetKeyword( "NAME" ) )		{ MsgCode = 0; goto error; }
+	if( !Lex->GetKeyword( "NAME" ) )		{ MsgCode = 0; goto error; }
 
-	if( !Lexer::GetNewline() )
+	if( !Lex->GetNewline() )
 	{
-		if( !Lexer::GetSpace() )				{ MsgCode = 1; goto error; }
-		if( !Lexer::GetLabelFree( 0, 0, 0 ) )	{ MsgCode = 2; goto error; }
+		if( !Lex->GetSpace() )				{ MsgCode = 1; goto error; }
+		if( !Lex->GetLabelFree( 0, 0, 0 ) )	{ MsgCode = 2; goto error; }
 
 		// We have to store the name before a new line is fetched.
 		//
-		lp->SetLP_Name( Lexer::LabelPtr[0] );
+		lp->SetLP_Name( Lex->LabelPtr[0] );
 
-		Lexer::GetSpace();
-		if( Lexer::GetKeyword( "FREE" ) )
+		Lex->GetSpace();
+		if( Lex->GetKeyword( "FREE" ) )
 			FileType = FF_FREE_MPS;
 		else
 			FileType = FF_FIXED_MPS;
-		if( !Lexer::GetNewline( True ) )	{ MsgCode = 3; goto error; }
+		if( !Lex->GetNewline( True ) )	{ MsgCode = 3; goto error; }
 	}
-	else if( ! Lexer::IO_OK )				{ MsgCode = 3; goto error; }
+	else if( ! Lex->IO_OK )				{ MsgCode = 3; goto error; }
 	else
 	{
 		lp->SetLP_Name( "" );				// Empty problem name string.
@@ -357,9 +369,9 @@ FF GetNameLine( void )
 	}
 
 	if( FileType == FF_FREE_MPS )
-		GetLabel = Lexer::GetLabelFree;
+		GetLabel = &Lexer::GetLabelFree;
 	else if( FileType == FF_FIXED_MPS )
-		GetLabel = Lexer::GetLabelFixed;
+		GetLabel = &Lexer::GetLabelFixed;
 	else
 		GetLabel = NULL;
 		
@@ -373,8 +385,8 @@ FF GetNameLine( void )
 	//
 error:
 	if( MsgCode >= 0 )
-		Error( "%s: %s in line %d", Lexer::FileName, Messages[ MsgCode ],
-			Lexer::LineNumber );
+		Error( "%s: %s in line %d", Lex->FileName, Messages[ MsgCode ],
+			Lex->LineNumber );
 	lp->SetLP_Name( "" );
 	GetLabel = NULL;
 	return FF_UNKNOWN;
@@ -427,33 +439,33 @@ Bool_T GetMPS_Body( void )
 	//--------------------------------------------------------------------------
 	//	ROWS section.
 	//
-	if( !Lexer::GetKeyword( "ROWS" ) )		{ MsgCode = 0; goto error; }
-	if( !Lexer::GetNewline( True ) )		{ MsgCode = 4; goto error; }
+	if( !Lex->GetKeyword( "ROWS" ) )		{ MsgCode = 0; goto error; }
+	if( !Lex->GetNewline( True ) )		{ MsgCode = 4; goto error; }
 	lp->BeginRows();
 	GetRowsSection();
 
 	//--------------------------------------------------------------------------
 	//	COLUMNS section.
 	//
-	if( !Lexer::GetKeyword( "COLUMNS" ) )	{ MsgCode = 1; goto error; }
-	if( !Lexer::GetNewline( True ) )		{ MsgCode = 4; goto error; }
+	if( !Lex->GetKeyword( "COLUMNS" ) )	{ MsgCode = 1; goto error; }
+	if( !Lex->GetNewline( True ) )		{ MsgCode = 4; goto error; }
 	lp->BeginColumns();
 	GetColumnsSection();
 
 	//--------------------------------------------------------------------------
 	//	RHS section.
 	//
-	if( !Lexer::GetKeyword( "RHS" ) )		{ MsgCode = 2; goto error; }
-	if( !Lexer::GetNewline( True ) )		{ MsgCode = 4; goto error; }
+	if( !Lex->GetKeyword( "RHS" ) )		{ MsgCode = 2; goto error; }
+	if( !Lex->GetNewline( True ) )		{ MsgCode = 4; goto error; }
 	lp->BeginRHS();
 	GetRHS_Section();
 
 	//--------------------------------------------------------------------------
 	//	RANGES section.
 	//
-	if( Lexer::GetKeyword( "RANGES" ) )
+	if( Lex->GetKeyword( "RANGES" ) )
 	{
-		if( !Lexer::GetNewline( True ) )	{ MsgCode = 4; goto error; }
+		if( !Lex->GetNewline( True ) )	{ MsgCode = 4; goto error; }
 		lp->BeginRanges();
 		GetRangesSection();
 	}
@@ -461,9 +473,9 @@ Bool_T GetMPS_Body( void )
 	//--------------------------------------------------------------------------
 	//	BOUNDS section.
 	//
-	if( Lexer::GetKeyword( "BOUNDS" ) )
+	if( Lex->GetKeyword( "BOUNDS" ) )
 	{
-		if( !Lexer::GetNewline( True ) )	{ MsgCode = 4; goto error; }
+		if( !Lex->GetNewline( True ) )	{ MsgCode = 4; goto error; }
 		lp->BeginBounds();
 		GetBoundsSection();
 	}
@@ -471,7 +483,7 @@ Bool_T GetMPS_Body( void )
 	//--------------------------------------------------------------------------
 	//	ENDATA.
 	//
-	if( !Lexer::GetKeyword( "ENDATA" ) )	{ MsgCode = 3; goto error; }
+	if( !Lex->GetKeyword( "ENDATA" ) )	{ MsgCode = 3; goto error; }
 	lp->Endata();
 
 	//--------------------------------------------------------------------------
@@ -480,8 +492,8 @@ Bool_T GetMPS_Body( void )
 
 error:
 	if( MsgCode >= 0 )
-		Error( "%s: %s in line %d", Lexer::FileName, Messages[ MsgCode ],
-			Lexer::LineNumber );
+		Error( "%s: %s in line %d", Lex->FileName, Messages[ MsgCode ],
+			Lex->LineNumber );
 	return False;
 }
 
@@ -526,22 +538,22 @@ static void GetRowsSection( void )
 	static int MsgCode = -1;
 
 	//--------------------------------------------------------------------------
-	while( Lexer::GetSpace() )
+	while( Lex->GetSpace() )
 	{
 		if( !GetRowType() )						{ MsgCode = 0; goto error; }
-		if( !Lexer::GetSpace() )				{ MsgCode = 1; goto error; }
-		if( !GetLabel( 0, 4, 11 ) )				{ MsgCode = 2; goto error; }
+		if( !Lex->GetSpace() )				{ MsgCode = 1; goto error; }
+		if( !(Lex->*GetLabel)( 0, 4, 11 ) )				{ MsgCode = 2; goto error; }
 
-		lp->NewRow( (Short_T)RowType, Lexer::LabelPtr[0] );
+		lp->NewRow( (Short_T)RowType, Lex->LabelPtr[0] );
 
 	error:
 		if( MsgCode >= 0 )
 		{
-			Error( "%s: %s in line %d", Lexer::FileName, Messages[ MsgCode ],
-				Lexer::LineNumber );
+			Error( "%s: %s in line %d", Lex->FileName, Messages[ MsgCode ],
+				Lex->LineNumber );
 			MsgCode = -1;
 		}
-		if( !Lexer::GetNewline( True ) )
+		if( !Lex->GetNewline( True ) )
 		//	Any possible 'SOSROW" markers after row name are ignored.
 			return;
 	}
@@ -597,39 +609,39 @@ static Bool_T GetColumnTypeLine( const char *msg0, const char *msg1, // )
 	//--------------------------------------------------------------------------
 	if( !AllowEmptyLabel )
 	{
-		if( !GetLabel( 0, 4, 11 ) )				{ MsgCode = 0; goto error; }
+		if( !(Lex->*GetLabel)( 0, 4, 11 ) )				{ MsgCode = 0; goto error; }
 	}
 	else
-		GetLabel( 0, 4, 11 );
-	Lexer::GetSpace();
-	if( !GetLabel( 1, 14, 21 ) )				{ MsgCode = 2; goto error; }
+		(Lex->*GetLabel)( 0, 4, 11 );
+	Lex->GetSpace();
+	if( !(Lex->*GetLabel)( 1, 14, 21 ) )				{ MsgCode = 2; goto error; }
 
 	//
 	//	Ignore marker lines (those that containt a word 'MARKER' in the second
 	//	field.
 	//
-	if( strcmp( Lexer::LabelPtr[1], "'MARKER'" ) == 0 )
+	if( strcmp( Lex->LabelPtr[1], "'MARKER'" ) == 0 )
 	{
-		if( !Lexer::GetNewline( True ) )		goto IO_error;
+		if( !Lex->GetNewline( True ) )		goto IO_error;
 	}
 	else
 	{
-		Lexer::GetSpace();
-		if( !Lexer::GetNumeric() )				{ MsgCode = 4; goto error; }
+		Lex->GetSpace();
+		if( !Lex->GetNumeric() )				{ MsgCode = 4; goto error; }
 
-		(lp->*NewData)( Lexer::LabelPtr[0], Lexer::LabelPtr[1], Lexer::Number );
+		(lp->*NewData)( Lex->LabelPtr[0], Lex->LabelPtr[1], Lex->Number );
 
-		if( !Lexer::GetNewline() )
+		if( !Lex->GetNewline() )
 		{
-			if( !Lexer::IO_OK )					goto IO_error;
-			if( !Lexer::GetSpace() )			{ MsgCode = 4; goto error; }
-			if( !GetLabel( 1, 39, 46 ) )		{ MsgCode = 2; goto error; }
-			Lexer::GetSpace();
-			if( !Lexer::GetNumeric() )			{ MsgCode = 3; goto error; }
+			if( !Lex->IO_OK )					goto IO_error;
+			if( !Lex->GetSpace() )			{ MsgCode = 4; goto error; }
+			if( !(Lex->*GetLabel)( 1, 39, 46 ) )		{ MsgCode = 2; goto error; }
+			Lex->GetSpace();
+			if( !Lex->GetNumeric() )			{ MsgCode = 3; goto error; }
 
-			(lp->*NewData)( NULL, Lexer::LabelPtr[1], Lexer::Number );
+			(lp->*NewData)( NULL, Lex->LabelPtr[1], Lex->Number );
 
-			if( !Lexer::GetNewline( True ) )	goto IO_error;
+			if( !Lex->GetNewline( True ) )	goto IO_error;
 		}
 	}
 	//--------------------------------------------------------------------------
@@ -641,27 +653,27 @@ error:
 	switch( MsgCode )
 	{
 	case 0:
-		Error( "%s: %s label expected in line %d", Lexer::FileName, msg0,
-			Lexer::LineNumber );
+		Error( "%s: %s label expected in line %d", Lex->FileName, msg0,
+			Lex->LineNumber );
 		break;
 	case 1:
-		Error( "%s: %s %s label in line %d", Lexer::FileName, Messages[0], msg0,
-			Lexer::LineNumber );
+		Error( "%s: %s %s label in line %d", Lex->FileName, Messages[0], msg0,
+			Lex->LineNumber );
 		break;
 	case 2:
-		Error( "%s: %s label expected in line %d", Lexer::FileName, msg1,
-			Lexer::LineNumber );
+		Error( "%s: %s label expected in line %d", Lex->FileName, msg1,
+			Lex->LineNumber );
 		break;
 	case 3:
-		Error( "%s: %s in line %d", Lexer::FileName, Messages[1],
-			Lexer::LineNumber );
+		Error( "%s: %s in line %d", Lex->FileName, Messages[1],
+			Lex->LineNumber );
 		break;
 	case 4:
-		Error( "%s: %s in line %d", Lexer::FileName, Messages[2],
-			Lexer::LineNumber );
+		Error( "%s: %s in line %d", Lex->FileName, Messages[2],
+			Lex->LineNumber );
 		break;
 	}
-	if( !Lexer::GetNewline( True ) )	return False;
+	if( !Lex->GetNewline( True ) )	return False;
 	return True;
 
 IO_error:
@@ -694,14 +706,14 @@ SIDE EFFECTS:
 
 static void GetColumnsSection( void )
 {
-	while( Lexer::GetSpace() )
+	while( Lex->GetSpace() )
 		GetColumnTypeLine( "COLUMN", "Row", &MPS_LP::NewNonZero );
 }
 
 
 static void GetRangesSection( void )
 {
-	while( Lexer::GetSpace() )
+	while( Lex->GetSpace() )
 		GetColumnTypeLine( "RANGE vector", "Row", &MPS_LP::NewRange,
 			( FileType == FF_FIXED_MPS ) ? True : False );
 }
@@ -709,7 +721,7 @@ static void GetRangesSection( void )
 
 static void GetRHS_Section( void )
 {
-	while( Lexer::GetSpace() )
+	while( Lex->GetSpace() )
 		GetColumnTypeLine( "RHS vector", "Row", &MPS_LP::NewRHS,
 			( FileType == FF_FIXED_MPS ) ? True : False );
 }
@@ -750,48 +762,48 @@ static void GetBoundsSection( void )
 
 	const Bool_T LabelRequired = ( FileType == FF_FREE_MPS ) ? True : False;
 
-	while( Lexer::GetSpace() )
+	while( Lex->GetSpace() )
 	{
 		if( !GetBoundType() )					{ MsgCode = 0; goto error; }
 		if( FileType == FF_FREE_MPS &&
-			!Lexer::GetSpace() )				{ MsgCode = 1; goto error; }
+			!Lex->GetSpace() )				{ MsgCode = 1; goto error; }
 		if( LabelRequired )
 		{
-			if( !GetLabel( 0, 4, 11 ) )			{ MsgCode = 2; goto error; }
+			if( !(Lex->*GetLabel)( 0, 4, 11 ) )			{ MsgCode = 2; goto error; }
 		}
 		else
-			GetLabel( 0, 4, 11 );
-		Lexer::GetSpace();
-		if( !GetLabel( 1, 14, 21 ) )			{ MsgCode = 4; goto error; }
+			(Lex->*GetLabel)( 0, 4, 11 );
+		Lex->GetSpace();
+		if( !(Lex->*GetLabel)( 1, 14, 21 ) )			{ MsgCode = 4; goto error; }
 		if( BoundType == VTM_MI || BoundType == VTM_PL || BoundType == VTM_FR )
 		{
-			lp->NewBound( (Short_T)BoundType, Lexer::LabelPtr[0],
-				Lexer::LabelPtr[1], 0.0e0 );
+			lp->NewBound( (Short_T)BoundType, Lex->LabelPtr[0],
+				Lex->LabelPtr[1], 0.0e0 );
 		}
 		else if( BoundType == VTM_BV )
 		{
 			BoundType = VTM_UP;
-			lp->NewBound( (Short_T)BoundType, Lexer::LabelPtr[0],
-				Lexer::LabelPtr[1], 1.0e0 );
+			lp->NewBound( (Short_T)BoundType, Lex->LabelPtr[0],
+				Lex->LabelPtr[1], 1.0e0 );
 		}
 		else
 		{
-			Lexer::GetSpace();
-			if( !Lexer::GetNumeric() )			{ MsgCode = 3; goto error; }
+			Lex->GetSpace();
+			if( !Lex->GetNumeric() )			{ MsgCode = 3; goto error; }
 
-			lp->NewBound( (Short_T)BoundType, Lexer::LabelPtr[0],
-				Lexer::LabelPtr[1], Lexer::Number );
+			lp->NewBound( (Short_T)BoundType, Lex->LabelPtr[0],
+				Lex->LabelPtr[1], Lex->Number );
 		}
 
 	error:
 		if( MsgCode >= 0 )
 		{
-			Error( "%s: %s in line %d", Lexer::FileName, Messages[ MsgCode ],
-				Lexer::LineNumber );
+			Error( "%s: %s in line %d", Lex->FileName, Messages[ MsgCode ],
+				Lex->LineNumber );
 			MsgCode = -1;
 		}
 
-		if( !Lexer::GetNewline( True ) )	return;
+		if( !Lex->GetNewline( True ) )	return;
 	}
 }
 
@@ -819,7 +831,7 @@ indicator.
 
 static Bool_T GetBoundType( void )
 {
-	register char *BufPtr = Lexer::BufPtr;
+	register char *BufPtr = Lex->BufPtr;
 
 #ifndef COMP_PARSE_UPPERCASE
 	switch( *BufPtr++ )
@@ -914,12 +926,12 @@ static Bool_T GetBoundType( void )
 	}
 #endif
 
-	Lexer::BufPtr = ++BufPtr;
+	Lex->BufPtr = ++BufPtr;
 	return True;
 
 error:
-	Error( "%s: Unknown bound type in line %d", Lexer::FileName,
-		Lexer::LineNumber );
+	Error( "%s: Unknown bound type in line %d", Lex->FileName,
+		Lex->LineNumber );
 	return False;
 }
 
@@ -945,7 +957,7 @@ indicator.
 
 static Bool_T GetRowType( void )
 {
-	char c = *Lexer::BufPtr;
+	char c = *Lex->BufPtr;
 
 #ifdef COMP_PARSE_UPPERCASE
 	if( islower( c ) ) c += 'A'-'a';
@@ -960,11 +972,11 @@ static Bool_T GetRowType( void )
 	default:			RowType = RT_UNDEFINED;		goto error;
 	}
 
-	Lexer::BufPtr++;
+	Lex->BufPtr++;
 	return True;
 
 error:
-	Error( "%s: Unknown row type indicator in line %d", Lexer::FileName,
-		Lexer::LineNumber );
+	Error( "%s: Unknown row type indicator in line %d", Lex->FileName,
+		Lex->LineNumber );
 	return False;
 }
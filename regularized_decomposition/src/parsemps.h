@@ -21,11 +21,12 @@ DEPENDENCIES:		stdtype.h,
 HEADER CONTENTS:
 	This header file contains prototypes of functions which constitute an
 interface to a parser for fixed and free MPS file. These functions read an
-input file from a stream declared with "SetInputStream" call. The type of file
+input file through a lexical analyser ("Lexer" object) attached to a stream
+with its "SetInputStream" call. The type of file
 (one of: free MPS, fixed MPS and our proprietary binary format) is recognized
 automatically.
 	Then a pointer to an MPS_LP object in which data read from the file is to
-be stored must be passed. Finally the file type has to be recognized (by a call
+be stored must be passed (together with the lexical analyser). Finally the file type has to be recognized (by a call
 to "GetNameLine"). Text file may be read by "GetMPS_Body".
 	Binary file has to be processed elsewhere.
 
@@ -49,8 +50,9 @@ to "GetNameLine"). Text file may be read by "GetMPS_Body".
 //
 //==============================================================================
 
-void SetInputStream( const char *name, FILE *fp );
-void SetLP_TargetObject( MPS_LP *_lp );
+class Lexer;
+
+void SetLP_TargetObject( MPS_LP *_lp, Lexer *_lex );
 FF GetNameLine( void );
 Bool_T GetMPS_Body( void );
 
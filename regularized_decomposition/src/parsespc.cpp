@@ -174,7 +174,8 @@ Spc::Spc( void )
 	REFACT_FREQ			( REFACT_FREQ_DEF ),
 	RESID_CHECK_FREQ	( RESID_CHECK_FREQ_DEF ),
 
-	Pricing 			( PRS_ASE )
+	Pricing 			( PRS_ASE ),
+	KeepWeights			( True )
 {}
 
 
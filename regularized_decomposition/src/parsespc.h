@@ -86,6 +86,8 @@ public:
 	//	Some configuration data.
 	//
 	PricingScheme Pricing;
+	Bool_T KeepWeights;		//	Keep the steepest edge weights when the
+							//	solver is restarted.
 
 public:
 	Spc( void );			//	Sets reasonable defaults for all data members.
@@ -26,7 +26,7 @@ functions which set up semantic actions.
 --------------------------------------------------------------------------------
 
 PUBLIC INTERFACE:
-	Bool_T GetStochFile( const char *FileName, FILE *fp )
+	Bool_T GetStochFile( Lexer &lex, Scenarios *sc )
 	void SetPassRowColLabelsProcedure( void_fptr_const_char_ptr_const_char_ptr )
 	void SetPassNumericValueProcedure( void_fptr_double )
 	void SetPassPeriodLabelProcedure( void_fptr_const_char_ptr )
@@ -38,16 +38,20 @@ STATIC FUNCTIONS:
 	static Bool_T GetIndepSection( void );
 	static Bool_T GetBlockSection( void );
 	static Bool_T GetScenarioSection( void );
-	static Bool_T GetIgnoredSection( void );
 	static Bool_T GetIndepDistcreteSection( void );
 	static Bool_T GetIndepUniformSection( void );
 	static Bool_T GetIndepNormalSection( void );
+	static Bool_T GetIndepLognormSection( void );
+	static Bool_T GetIndepParametricSection( const char *Keyword,
+		ParametricLaw::LawType Type );
 	static Bool_T GetIndepSubroutineSection( void );
 	static Bool_T GetBlocksDiscreteEntries( void );
-	static Bool_T GetIndepDiscreteEntries( void );
+	static Bool_T GetIndepEntries( ParametricLaw::LawType Type );
+	static Bool_T GetScenariosDiscreteEntries( void );
 
 STATIC DATA:
 	static Scenarios *Scen;
+	static Lexer *Lex;
 
 ------------------------------------------------------------------------------*/
 
@@ -78,13 +82,16 @@ static Bool_T GetSections( void );
 static Bool_T GetIndepSection( void );
 static Bool_T GetBlockSection( void );
 static Bool_T GetScenarioSection( void );
-static Bool_T GetIgnoredSection( void );
 static Bool_T GetIndepDistcreteSection( void );
 static Bool_T GetIndepUniformSection( void );
 static Bool_T GetIndepNormalSection( void );
+static Bool_T GetIndepLognormSection( void );
+static Bool_T GetIndepParametricSection( const char *Keyword,
+	ParametricLaw::LawType Type );
 static Bool_T GetIndepSubroutineSection( void );
 static Bool_T GetBlocksDiscreteEntries( void );
-static Bool_T GetIndepDiscreteEntries( void );
+static Bool_T GetIndepEntries( ParametricLaw::LawType Type );
+static Bool_T GetScenariosDiscreteEntries( void );
 
 //==============================================================================
 //
@@ -101,17 +108,25 @@ static Scenarios *Scen;
 //------------------------------------------------------------------------------
 
 
+//------------------------------------------------------------------------------
+//	Static pointer to the lexical analyser reading the file.
+//
+static Lexer *Lex;
+// 
+//------------------------------------------------------------------------------
+
+
 /*------------------------------------------------------------------------------
 
-	Bool_T GetStochFile( const char *FileName, FILE *fp, Scenarios *Scen )
+	Bool_T GetStochFile( Lexer &lex, Scenarios *Scen )
 
 PURPOSE:
 	Parses a scenario file, which contains 
 
 PARAMETERS:
-	const char *FileName, FILE *fp
-		Scenario file name and pointer to the corresponding stream (assumed to
-		be opened for reading).
+	Lexer &lex
+		Lexical analyser attached (by "Lexer::SetInputStream") to the scenario
+		file stream.
 	
 	Scenarios *Scen
 		Pointer to an object of scenario repository class.
@@ -124,28 +139,27 @@ SIDE EFFECTS:
 
 ------------------------------------------------------------------------------*/
 
-Bool_T GetStochFile( const char *FileName, FILE *fp, Scenarios *sc )
+Bool_T GetStochFile( Lexer &lex, Scenarios *sc )
 {
 	assert( sc != NULL );
-	Scen = sc;
+	Scen	= sc;
+	Lex		= &lex;
 
-	Lexer::SetInputStream( FileName, fp );
-
-	if( !Lexer::GetKeyword( "STOCH" ) )
+	if( !Lex->GetKeyword( "STOCH" ) )
 	{
-		Error( "File %s: Invalid first line.", Lexer::FileName );
+		Error( "File %s: Invalid first line.", Lex->FileName );
 		goto Error;
 	}
 
-	Lexer::GetNewline( True );
+	Lex->GetNewline( True );
 
 	while( GetSections() )
 		;
 
-	if( !Lexer::GetKeyword( "ENDATA" ) )
+	if( !Lex->GetKeyword( "ENDATA" ) )
 	{
 		Error( "File %s, line %d: ENDATA expected.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex->FileName, Lex->LineNumber );
 		goto Error;
 	}
 	Scen->EndData();
@@ -207,23 +221,24 @@ SIDE EFFECTS:
 
 static Bool_T GetIndepSection( void )
 {
-	if( !Lexer::GetKeyword( "INDEP" ) )
+	if( !Lex->GetKeyword( "INDEP" ) )
 		return False;
 
-	if( !Lexer::GetSpace() )
+	if( !Lex->GetSpace() )
 	{
 		Error( "File %s, line %d: Separator missing after INDEP.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex->FileName, Lex->LineNumber );
 		return False;
 	}
 
 	if( GetIndepUniformSection() || GetIndepNormalSection() ||
-		GetIndepSubroutineSection() || GetIndepDistcreteSection() )
+		GetIndepLognormSection() || GetIndepSubroutineSection() ||
+		GetIndepDistcreteSection() )
 		return True;
 	else
 	{
 		Error( "File %s, line %d: Unknown type of INDEP section encoutered.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex->FileName, Lex->LineNumber );
 		return False;
 	}
 }
@@ -251,22 +266,22 @@ SIDE EFFECTS:
 
 static Bool_T GetBlockSection( void )
 {
-	if( !Lexer::GetKeyword( "BLOCKS" ) )
+	if( !Lex->GetKeyword( "BLOCKS" ) )
 		goto Error;
 
-	if( !Lexer::GetSpace() || !Lexer::GetKeyword( "DISCRETE" ) )
+	if( !Lex->GetSpace() || !Lex->GetKeyword( "DISCRETE" ) )
 	{
 		Error( "File %s, line %d: Only BLOCKS DISCRETE section recognized.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex->FileName, Lex->LineNumber );
 		goto Error;
 	}
 
-	if( !Lexer::GetNewline() )
+	if( !Lex->GetNewline() )
 	{
 		Warning( "File %s, line %d: Extra characters after BLOCKS "
 			"DISCRETE ignored.",
-			Lexer::FileName, Lexer::LineNumber );
-		Lexer::GetNewline( True );
+			Lex->FileName, Lex->LineNumber );
+		Lex->GetNewline( True );
 	}
 
 	if( !GetBlocksDiscreteEntries() )
@@ -284,118 +299,116 @@ Error:
 	static Bool_T GetScenarioSection( void )
 
 PURPOSE:
-	x
+	Reads a section of explicitly listed scenarios. It starts with the
+"SCENARIOS" keyword in the first column of the input line. Only the DISCRETE
+type of the section is recognized.
 
 PARAMETERS:
-	int x
-	xxx
+	None.
 
 RETURN VALUE:
-	x
+	Success status.
 
 SIDE EFFECTS:
-	x
+	None.
 
 ------------------------------------------------------------------------------*/
 
 static Bool_T GetScenarioSection( void )
 {
-	if( Lexer::GetKeyword( "SCENARIOS" ) )
-	{
-		Error( "File %s, line %d: SCENARIOS sec. recognition not implemented.",
-			Lexer::FileName, Lexer::LineNumber );
+	if( !Lex->GetKeyword( "SCENARIOS" ) )
+		goto Error;
 
-		while( GetIgnoredSection() )
-			;
+	if( !Lex->GetSpace() || !Lex->GetKeyword( "DISCRETE" ) )
+	{
+		Error( "File %s, line %d: Only SCENARIOS DISCRETE section recognized.",
+			Lex->FileName, Lex->LineNumber );
+		goto Error;
 	}
 
-	return False;
-}
-
-
-/*------------------------------------------------------------------------------
-
-	static Bool_T GetIgnoredSection( void )
-
-PURPOSE:
-	x
-
-PARAMETERS:
-	int x
-	xxx
-
-RETURN VALUE:
-	x
-
-SIDE EFFECTS:
-	x
-
-------------------------------------------------------------------------------*/
+	if( !Lex->GetNewline() )
+	{
+		Warning( "File %s, line %d: Extra characters after SCENARIOS "
+			"DISCRETE ignored.",
+			Lex->FileName, Lex->LineNumber );
+		Lex->GetNewline( True );
+	}
 
-static Bool_T GetIgnoredSection( void )
-{
-	while( Lexer::GetSpace() && Lexer::GetNewline( True ) )
-		;
+	if( !GetScenariosDiscreteEntries() )
+		goto Error;
 
 	return True;
+
+Error:
+	return False;
 }
 
 
 /*------------------------------------------------------------------------------
 
 	static Bool_T GetIndepUniformSection( void )
+	static Bool_T GetIndepNormalSection( void )
+	static Bool_T GetIndepLognormSection( void )
+	static Bool_T GetIndepParametricSection( const char *Keyword,
+		ParametricLaw::LawType Type )
 
 PURPOSE:
-	x
+	Read the sections of independent random variables with continuous
+distributions: "INDEP UNIFORM", "INDEP NORMAL" and "INDEP LOGNORM". The entries
+have the same layout as in the "INDEP DISCRETE" section, but the value and the
+probability fields hold the two parameters of the distribution (see
+"ParametricLaw").
 
 PARAMETERS:
-	int x
-	xxx
+	const char *Keyword
+		The keyword following "INDEP".
+
+	ParametricLaw::LawType Type
+		The corresponding type of distribution.
 
 RETURN VALUE:
-	x
+	Success status.
 
 SIDE EFFECTS:
-	x
+	None.
 
 ------------------------------------------------------------------------------*/
 
 static Bool_T GetIndepUniformSection( void )
 {
-	if( Lexer::GetKeyword( "UNIFORM" ) )
-		Error( "File %s, line %d: INDEP UNIFORM sections not recognized yet.",
-			Lexer::FileName, Lexer::LineNumber );
-
-	return False;
+	return GetIndepParametricSection( "UNIFORM", ParametricLaw::UNIFORM );
 }
 
 
-/*------------------------------------------------------------------------------
-
-	static Bool_T GetIndepNormalSection( void )
+static Bool_T GetIndepNormalSection( void )
+{
+	return GetIndepParametricSection( "NORMAL", ParametricLaw::NORMAL );
+}
 
-PURPOSE:
-	x
 
-PARAMETERS:
-	int x
-	xxx
+static Bool_T GetIndepLognormSection( void )
+{
+	return GetIndepParametricSection( "LOGNORM", ParametricLaw::LOGNORMAL );
+}
 
-RETURN VALUE:
-	x
 
-SIDE EFFECTS:
-	x
+static Bool_T GetIndepParametricSection( const char *Keyword, // )
+	ParametricLaw::LawType Type )
+{
+	if( !Lex->GetKeyword( Keyword ) )
+		return False;
 
-------------------------------------------------------------------------------*/
+	if( !Lex->GetNewline() )
+	{
+		Warning( "File %s, line %d: Extra input ignored after INDEP %s.",
+			Lex->FileName, Lex->LineNumber, Keyword );
+		Lex->GetNewline( True );
+	}
 
-static Bool_T GetIndepNormalSection( void )
-{
-	if( Lexer::GetKeyword( "NORMAL" ) )
-		Error( "File %s, line %d: INDEP NORMAL sections not recognized yet.",
-			Lexer::FileName, Lexer::LineNumber );
+	while( GetIndepEntries( Type ) )
+		;
 
-	return False;
+	return True;
 }
 
 
@@ -420,9 +433,9 @@ SIDE EFFECTS:
 
 static Bool_T GetIndepSubroutineSection( void )
 {
-	if( Lexer::GetKeyword( "SUB" ) )
+	if( Lex->GetKeyword( "SUB" ) )
 		Error( "File %s, line %d: INDEP SUB sections not recognized yet.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex->FileName, Lex->LineNumber );
 
 	return False;
 }
@@ -449,17 +462,17 @@ SIDE EFFECTS:
 
 static Bool_T GetIndepDistcreteSection( void )
 {
-	if( !Lexer::GetKeyword( "DISCRETE" ) )
+	if( !Lex->GetKeyword( "DISCRETE" ) )
 		goto Error;
 
-	if( !Lexer::GetNewline() )
+	if( !Lex->GetNewline() )
 	{
 		Warning( "File %s, line %d: Extra input ignored after INDEP DISCRETE.",
-			Lexer::FileName, Lexer::LineNumber );
-		Lexer::GetNewline( True );
+			Lex->FileName, Lex->LineNumber );
+		Lex->GetNewline( True );
 	}
 
-	while( GetIndepDiscreteEntries() )
+	while( GetIndepEntries( ParametricLaw::DISCRETE ) )
 		;
 
 	return True;
@@ -471,24 +484,26 @@ Error:
 
 /*------------------------------------------------------------------------------
 
-	static Bool_T GetIndepDiscreteEntries( void )
+	static Bool_T GetIndepEntries( ParametricLaw::LawType Type )
 
 PURPOSE:
-	x
+	Reads one entry of an INDEP section:
+		column row value [period] probability
+For a continuous distribution the last two numbers are its parameters.
 
 PARAMETERS:
-	int x
-	xxx
+	ParametricLaw::LawType Type
+		Type of the distributions in the section.
 
 RETURN VALUE:
-	x
+	Success status ("False" at the end of the section).
 
 SIDE EFFECTS:
-	x
+	None.
 
 ------------------------------------------------------------------------------*/
 
-static Bool_T GetIndepDiscreteEntries( void )
+static Bool_T GetIndepEntries( ParametricLaw::LawType Type )
 {
 	const char *PeriodLabel		= NULL,
 		*ColLabel				= NULL,
@@ -496,68 +511,72 @@ static Bool_T GetIndepDiscreteEntries( void )
 	Real_T Probability		 	= 0.0;
 	Real_T Value				= 0.0;
 
-	if( !Lexer::GetSpace() )
+	if( !Lex->GetSpace() )
 		goto Error;
 
-	if( !Lexer::GetLabelFree( 0 ) || !Lexer::GetSpace() ||
-		!Lexer::GetLabelFree( 1 ) )
+	if( !Lex->GetLabelFree( 0 ) || !Lex->GetSpace() ||
+		!Lex->GetLabelFree( 1 ) )
 	{
-		Error( "File %s, line %d: Invalid line in INDEP DISCRETE section.",
-			Lexer::FileName, Lexer::LineNumber );
+		Error( "File %s, line %d: Invalid line in INDEP section.",
+			Lex->FileName, Lex->LineNumber );
 		goto Error;
 	}
 
-	ColLabel = Lexer::LabelPtr[0];
-	RowLabel = Lexer::LabelPtr[1];
+	ColLabel = Lex->LabelPtr[0];
+	RowLabel = Lex->LabelPtr[1];
 
-	if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex->GetSpace() || !Lex->GetNumeric() )
 	{
 		Error( "File %s, line %d: Distribution value missing.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex->FileName, Lex->LineNumber );
 		goto Error;
 	}
 
-	Value = Lexer::Number;
+	Value = Lex->Number;
 
-	if( !Lexer::GetSpace() )
+	if( !Lex->GetSpace() )
 	{
 		Error( "File %s, line %d: Missing delimiter",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex->FileName, Lex->LineNumber );
 		goto Error;
 	}
 
 	PeriodLabel = "";
 
-	if( !Lexer::GetNumeric() )
+	if( !Lex->GetNumeric() )
 	{
-		if( !Lexer::GetLabelFree( 0 ) )
+		if( !Lex->GetLabelFree( 0 ) )
 		{
 			Error( "File %s, line %d: Period label expected",
-				Lexer::FileName, Lexer::LineNumber );
+				Lex->FileName, Lex->LineNumber );
 			goto Error;
 		}
 
-		PeriodLabel =  Lexer::LabelPtr[0];
+		PeriodLabel =  Lex->LabelPtr[0];
 
-		if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+		if( !Lex->GetSpace() || !Lex->GetNumeric() )
 		{
 			Error( "File %s, line %d: Probability missing.",
-				Lexer::FileName, Lexer::LineNumber );
+				Lex->FileName, Lex->LineNumber );
 			goto Error;
 		}
 	}
 
-	Probability = Lexer::Number;
+	Probability = Lex->Number;
 
 	/* Semantic action */
-	Scen->NewIndepDiscreteEntry( RowLabel, ColLabel, PeriodLabel, Value,
-		Probability );
+	if( Type == ParametricLaw::DISCRETE )
+		Scen->NewIndepDiscreteEntry( RowLabel, ColLabel, PeriodLabel, Value,
+			Probability );
+	else
+		Scen->NewIndepParametricEntry( RowLabel, ColLabel, PeriodLabel, Type,
+			Value, Probability );
 
-	if( !Lexer::GetNewline() )
+	if( !Lex->GetNewline() )
 	{
 		Warning( "File %s, line %d: Extra characters after line.",
-			Lexer::FileName, Lexer::LineNumber );
-		Lexer::GetNewline( True );
+			Lex->FileName, Lex->LineNumber );
+		Lex->GetNewline( True );
 	}
 
 	return True;
@@ -594,36 +613,36 @@ static Bool_T GetBlocksDiscreteEntries( void )
 	//	following form:
 	//		<spc> BL <spc> <block name> <spc> <period name> <spc> <probability>
 	//
-	if( !Lexer::GetSpace() || !Lexer::GetKeyword( "BL" ) ) goto Error;
+	if( !Lex->GetSpace() || !Lex->GetKeyword( "BL" ) ) goto Error;
 
 	while( BL_Found )
 	{
 		BL_Found = False;
 
-		if( !Lexer::GetSpace() || !Lexer::GetLabelFree( 0 ) ||
-			!Lexer::GetSpace() || !Lexer::GetLabelFree( 1 ) )
+		if( !Lex->GetSpace() || !Lex->GetLabelFree( 0 ) ||
+			!Lex->GetSpace() || !Lex->GetLabelFree( 1 ) )
 		{
 			Error( "File %s, line %d: Block label and period label expected.",
-				Lexer::FileName, Lexer::LineNumber );
+				Lex->FileName, Lex->LineNumber );
 			goto Error;
 		}
 
-		if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+		if( !Lex->GetSpace() || !Lex->GetNumeric() )
 		{
 			Error( "File %s, line %d: Block's probability expected.",
-				Lexer::FileName, Lexer::LineNumber );
+				Lex->FileName, Lex->LineNumber );
 			goto Error;
 		}
 
 		/* Semantic action */
-		Scen->NewBlocksDiscrete( Lexer::LabelPtr[0], Lexer::LabelPtr[1],
-			Lexer::Number );
+		Scen->NewBlocksDiscrete( Lex->LabelPtr[0], Lex->LabelPtr[1],
+			Lex->Number );
 
-		if( !Lexer::GetNewline() )
+		if( !Lex->GetNewline() )
 		{
 			Warning( "File %s, line %d: Extra characters after block "
-				"identifier line ignored", Lexer::FileName, Lexer::LineNumber );
-			Lexer::GetNewline( True );
+				"identifier line ignored", Lex->FileName, Lex->LineNumber );
+			Lex->GetNewline( True );
 		}
 
 		//----------------------------------------------------------------------
@@ -633,31 +652,144 @@ static Bool_T GetBlocksDiscreteEntries( void )
 		//
 		for(;;)
 		{
-			if( !Lexer::GetSpace() ) break;
-			if( Lexer::GetKeyword( "BL" ) )
+			if( !Lex->GetSpace() ) break;
+			if( Lex->GetKeyword( "BL" ) )
 			{
 				BL_Found = True;
 				break;
 			}
 
-			if( !Lexer::GetLabelFree( 0 ) || !Lexer::GetSpace() ||
-				!Lexer::GetLabelFree( 1 ) || !Lexer::GetSpace() ||
-				!Lexer::GetNumeric() )
+			if( !Lex->GetLabelFree( 0 ) || !Lex->GetSpace() ||
+				!Lex->GetLabelFree( 1 ) || !Lex->GetSpace() ||
+				!Lex->GetNumeric() )
 			{
 				Error( "File %s, line %d: Random variable expected in block.",
-					Lexer::FileName, Lexer::LineNumber );
+					Lex->FileName, Lex->LineNumber );
+				goto Error;
+			}
+
+			/* Semantic action */
+			Scen->NewBlocksDiscreteEntry( Lex->LabelPtr[1],
+				Lex->LabelPtr[0], Lex->Number );
+	
+			if( !Lex->GetNewline() )
+			{
+				Warning( "File %s, line %d: Extra characters after a data item "
+					"in block ignored", Lex->FileName, Lex->LineNumber );
+				Lex->GetNewline( True );
+			}
+		}
+	}
+
+	return True;
+
+Error:
+	return False;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static Bool_T GetScenariosDiscreteEntries( void )
+
+PURPOSE:
+	Reads the scenarios of a SCENARIOS DISCRETE section. Each of them is passed
+to the scenario repository as soon as it is read, so the section may be of any
+length.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	Success status.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static Bool_T GetScenariosDiscreteEntries( void )
+{
+	Bool_T SC_Found = True;
+
+	//--------------------------------------------------------------------------
+	//	The first line of a scenario should have the following form:
+	//		<spc> SC <spc> <scenario> <spc> <parent> <spc> <probability>
+	//			[ <spc> <period name> ]
+	//	where <parent> is either "ROOT" or the name of an earlier scenario.
+	//
+	if( !Lex->GetSpace() || !Lex->GetKeyword( "SC" ) ) goto Error;
+
+	while( SC_Found )
+	{
+		SC_Found = False;
+
+		if( !Lex->GetSpace() || !Lex->GetLabelFree( 0 ) ||
+			!Lex->GetSpace() || !Lex->GetLabelFree( 1 ) )
+		{
+			Error( "File %s, line %d: Scenario label and parent label "
+				"expected.", Lex->FileName, Lex->LineNumber );
+			goto Error;
+		}
+
+		if( !Lex->GetSpace() || !Lex->GetNumeric() )
+		{
+			Error( "File %s, line %d: Scenario's probability expected.",
+				Lex->FileName, Lex->LineNumber );
+			goto Error;
+		}
+
+		const char *ScenLabel	= Lex->LabelPtr[0],
+			*ParentLabel		= Lex->LabelPtr[1],
+			*PeriodLabel		= "";
+		Real_T Probability		= Lex->Number;
+
+		if( Lex->GetSpace() && *Lex->BufPtr != '\n' && Lex->GetLabelFree( 0 ) )
+			PeriodLabel = Lex->LabelPtr[0];
+
+		/* Semantic action */
+		Scen->NewScenariosDiscrete( ScenLabel, ParentLabel, PeriodLabel,
+			Probability );
+
+		if( !Lex->GetNewline() )
+		{
+			Warning( "File %s, line %d: Extra characters after scenario "
+				"identifier line ignored", Lex->FileName, Lex->LineNumber );
+			Lex->GetNewline( True );
+		}
+
+		//----------------------------------------------------------------------
+		//	Now, in loop we will input the lines of one scenario's description.
+		//	They should look like this:
+		//		<spc> <column label> <spc> <row label> <spc> <value>
+		//
+		for(;;)
+		{
+			if( !Lex->GetSpace() ) break;
+			if( Lex->GetKeyword( "SC" ) )
+			{
+				SC_Found = True;
+				break;
+			}
+
+			if( !Lex->GetLabelFree( 0 ) || !Lex->GetSpace() ||
+				!Lex->GetLabelFree( 1 ) || !Lex->GetSpace() ||
+				!Lex->GetNumeric() )
+			{
+				Error( "File %s, line %d: Random variable expected in "
+					"scenario.", Lex->FileName, Lex->LineNumber );
 				goto Error;
 			}
 
 			/* Semantic action */
-			Scen->NewBlocksDiscreteEntry( Lexer::LabelPtr[1],
-				Lexer::LabelPtr[0], Lexer::Number );
+			Scen->NewScenariosDiscreteEntry( Lex->LabelPtr[1],
+				Lex->LabelPtr[0], Lex->Number );
 	
-			if( !Lexer::GetNewline() )
+			if( !Lex->GetNewline() )
 			{
 				Warning( "File %s, line %d: Extra characters after a data item "
-					"in block ignored", Lexer::FileName, Lexer::LineNumber );
-				Lexer::GetNewline( True );
+					"in scenario ignored", Lex->FileName, Lex->LineNumber );
+				Lex->GetNewline( True );
 			}
 		}
 	}
@@ -39,8 +39,9 @@ function and a set of functions which set up semantic actions.
 //==============================================================================
 
 class Scenarios;
+class Lexer;
 
-Bool_T GetStochFile( const char *FileName, FILE *fp, Scenarios *sc );
+Bool_T GetStochFile( Lexer &lex, Scenarios *sc );
 
 //==============================================================================
 //
@@ -103,25 +103,27 @@ Bool_T Periods::ReadPeriodFile( FILE *fp, MPS_LP &LP, VerbLevel Verbosity )
 	if( Verbosity >= V_HIGH )
 		Print( "\nReading the time file.\n" );
 
-	Lexer::SetInputStream( "Time file", fp );
+	Lexer Lex;
+
+	Lex.SetInputStream( "Time file", fp );
 
 	//--------------------------------------------------------------------------
 	//	Read in the first line.
 	//
-	if( !Lexer::GetKeyword( "TIME" ) || !Lexer::GetSpace() ||
-		!Lexer::GetLabelFree( 0 ) )
+	if( !Lex.GetKeyword( "TIME" ) || !Lex.GetSpace() ||
+		!Lex.GetLabelFree( 0 ) )
 	{
 		Error( "Error reading the first line of the time file." );
 		goto error;
 	}
 
-	strncpy( ProblemName, Lexer::LabelPtr[0], LAB_LEN );
+	strncpy( ProblemName, Lex.LabelPtr[0], LAB_LEN );
 	ProblemName[LAB_LEN] = '\0';
 
 	if( Verbosity >= V_HIGH )
 		Print( "\t%-20s%-20s\n", "Problem name:", ProblemName );
 
-	if( !Lexer::GetNewline() )
+	if( !Lex.GetNewline() )
 	{
 		Error( "Extra input in the first line." );
 		goto error;
@@ -130,51 +132,51 @@ Bool_T Periods::ReadPeriodFile( FILE *fp, MPS_LP &LP, VerbLevel Verbosity )
 	//--------------------------------------------------------------------------
 	//	Read in the 'PERIODS' keyword and the lines defining actual periods.
 	//
-	if( !Lexer::GetKeyword( "PERIODS" ) )
+	if( !Lex.GetKeyword( "PERIODS" ) )
 	{
 		Error( "'PERIODS' expected." );
 		goto error;
 	}
 
-	Lexer::GetSpace();
-	Lexer::GetKeyword( "LP" );
+	Lex.GetSpace();
+	Lex.GetKeyword( "LP" );
 
-	if( !Lexer::GetNewline( True ) )
+	if( !Lex.GetNewline( True ) )
 		Error( "Unexpected end of text." );
 
-	while( Lexer::GetSpace() )
+	while( Lex.GetSpace() )
 	{
-		if( !Lexer::GetLabelFree( 0 ) || !Lexer::GetSpace() ||
-			!Lexer::GetLabelFree( 1 ) )
+		if( !Lex.GetLabelFree( 0 ) || !Lex.GetSpace() ||
+			!Lex.GetLabelFree( 1 ) )
 		{
 			Error( "Column and row labels expected." );
 			goto error;
 		}
 
-		const char *col	= Lexer::LabelPtr[0],
-			*row		= Lexer::LabelPtr[1];
+		const char *col	= Lex.LabelPtr[0],
+			*row		= Lex.LabelPtr[1];
 
-		if( !Lexer::GetSpace() || !Lexer::GetLabelFree( 0 ) )
+		if( !Lex.GetSpace() || !Lex.GetLabelFree( 0 ) )
 		{
 			Error( "Period label expected." );
 			goto error;
 		}
 
-		if( !AddPeriod( LP, Lexer::LabelPtr[0], row, col ) )
+		if( !AddPeriod( LP, Lex.LabelPtr[0], row, col ) )
 		{
 			Error( "Labels for %d'th period \'%s' not found.", (int)len,
-				Lexer::GetLabelFree( 0 ) );
+				Lex.LabelPtr[0] );
 			err = True;
 		}
 			
-		if( !Lexer::GetNewline( True ) )
+		if( !Lex.GetNewline( True ) )
 			goto error;
 	}
 
 	//--------------------------------------------------------------------------
 	//	Read in the keyword 'ENDATA' and end reading file.
 	//
-	if( !Lexer::GetKeyword( "ENDATA" ) )
+	if( !Lex.GetKeyword( "ENDATA" ) )
 	{
 		Error( "'ENDATA' expected. (Only two period problems understood.)" );
 		goto error;
@@ -14,7 +14,7 @@ CREATED:			1994.05.08
 LAST MODIFIED:		1996.04.16
 
 DEPENDENCIES:		my_defs.h, smartptr.h, error.h, memblock.h, smartdcl.h,
-					sptr_deb.h, stdtype.h, simplex.h, myalloc.h
+					sptr_deb.h, stdtype.h, simplex.h, myalloc.h, lexer.h
 					<stdio.h>
 
 --------------------------------------------------------------------------------
@@ -45,6 +45,9 @@ HEADER CONTENTS:
 #ifndef __SIMPLEX_H__
 #	include "simplex.h"
 #endif
+#ifndef __LEXER_H__
+#	include "lexer.h"
+#endif
 
 
 #define POST_SOLV_MIN_LEN	100
@@ -72,6 +75,8 @@ private:
 
 	Real_T FTOL;				// Feasibility tolerance.
 
+	Lexer Lex;					// Lexical analyser for action file reading.
+
 public:
 	Postsolver( void );
 	Postsolver( Int_T nn );
@@ -409,7 +409,7 @@ Bool_T Presolver::SetU( Int_T j, Real_T val )
 
 	LP.SetU( j, val );
 
-	if( LP.GetVarType( j ) & VT_FX )
+	if( ( LP.GetVarType( j ) & VT_FX ) && !IsProtectedCol( j ) )
 		FixVariable( j, VT_FX );
 
 	return True;
@@ -458,7 +458,7 @@ Bool_T Presolver::SetL( Int_T j, Real_T val )
 
 	LP.SetL( j, val );
 
-	if( LP.GetVarType( j ) & VT_FX )
+	if( ( LP.GetVarType( j ) & VT_FX ) && !IsProtectedCol( j ) )
 		FixVariable( j, VT_FX );
 
 	return True;
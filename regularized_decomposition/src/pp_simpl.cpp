@@ -75,10 +75,16 @@ Int_T Presolver::EliminateEmptyRows( void )
 {
 	Int_T Elim = 0, i;
 
-	for( i = RowList.GetFirst( 0 ); i != -1; i = RowList.GetNext(), Elim++ )
+	for( i = RowList.GetFirst( 0 ); i != -1; i = RowList.GetNext() )
 	{
 		assert( i >= 0 && i < m && !ExcludeRows[i] );
 
+		//----------------------------------------------------------------------
+		//	Feasibility of a row with a random right hand side can not be
+		//	decided here.
+		//
+		if( IsProtectedRow( i ) ) continue;
+
 		//----------------------------------------------------------------------
 		//	See if the problem is feasible (i.e. if 0 \in < bl[i], bu[i] >.
 		//
@@ -94,6 +100,7 @@ Int_T Presolver::EliminateEmptyRows( void )
 
 
 		RemoveRow( i );
+		Elim++;
 	}
 
 	return Elim;
@@ -123,10 +130,17 @@ Int_T Presolver::EliminateEmptyColumns( void )
 {
 	Int_T Elim = 0, j;
 
-	for( j = ColList.GetFirst( 0 ); j != -1; j = ColList.GetNext(), Elim++ )
+	for( j = ColList.GetFirst( 0 ); j != -1; j = ColList.GetNext() )
 	{
 		assert( !ExcludeCols[j] && j >= 0 && j < n );
 
+		//----------------------------------------------------------------------
+		//	The optimal value of a variable with a random cost depends on the
+		//	scenario.
+		//
+		if( IsProtectedCol( j ) ) continue;
+		Elim++;
+
 		//----------------------------------------------------------------------
 		//	Attempt to fix a variable with an empty column (we may fix it on any
 		//	bound, or between the bounds - it all depends on the value of its
@@ -202,7 +216,8 @@ Int_T Presolver::EliminateFixedVariables( void )
 {
 	Int_T Elim = 0;
 	for( Int_T j = 0; j < n; j++ )
-		if( !ExcludeCols[j] && ( LP.GetVarType( j ) & VT_FX ) )
+		if( !ExcludeCols[j] && ( LP.GetVarType( j ) & VT_FX ) &&
+			!IsProtectedCol( j ) )
 		{
 			FixVariable( j, VT_FX );
 			Elim++;
@@ -237,8 +252,7 @@ Int_T Presolver::EliminateSingletonRows( void )
 	//	Loop on singleton rows.
 	//
 	Int_T Elim = 0;
-	for( Int_T i = RowList.GetFirst( 1 ); i != -1;
-		i = RowList.GetNext(), Elim++ )
+	for( Int_T i = RowList.GetFirst( 1 ); i != -1; i = RowList.GetNext() )
 	{
 		//----------------------------------------------------------------------
 		//	See if this really is a singleton and if it hasn't been removed
@@ -246,6 +260,12 @@ Int_T Presolver::EliminateSingletonRows( void )
 		//
 		assert( RowLen[i] == 1 && !ExcludeRows[i] && i >= 0 && i < m );
 
+		//----------------------------------------------------------------------
+		//	A row with a random right hand side does not give fixed bounds.
+		//
+		if( IsProtectedRow( i ) ) continue;
+		Elim++;
+
 		//----------------------------------------------------------------------
 		//	Find the non-zero column and value.
 		//
@@ -265,8 +285,16 @@ Int_T Presolver::EliminateSingletonRows( void )
 		//	Change singleton row data to bounds on the variable. Remember to
 		//	change direction of inequalities if a_ij is negative.
 		//
-		if( rt[i] & VT_FX )
+		//	A variable with a random cost is never removed: it is only fixed
+		//	by means of its bounds.
+		//
+		if( ( rt[i] & VT_FX ) && !IsProtectedCol( *col ) )
 			FixVariable( *col, bl[i] / *a );
+		else if( rt[i] & VT_FX )
+		{
+			SetL( *col, bl[i] / *a );
+			SetU( *col, bl[i] / *a );
+		}
 		else
 		{
 			if( rt[i] & VT_LO )
@@ -57,7 +57,13 @@ enum LP_REDUCTIONS {
 	LPR_DUAL			= LPR_MIN | LPR_DOM_COLS | LPR_EMPTY_COLS,
 
 	LPR_ALL				= LPR_PRIMAL | LPR_DUAL | LPR_NUM_ELIM
-						/* | LPR_EXPLICIT_SLACKS */
+						/* | LPR_EXPLICIT_SLACKS */,
+
+	//
+	//	Reductions which (with protected rows and columns) remain valid for
+	//	every realisation of the random right hand side and cost.
+	//
+	LPR_SCENARIO_SAFE	= LPR_PRIMAL
 	};
 
 
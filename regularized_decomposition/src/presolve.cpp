@@ -95,7 +95,8 @@ Presolver::Presolver( SolvableLP &lp, Postsolver *postsolve )
 	//	Initialize presolver data.
 	//
 	ExcludeRows( 0 ), ExcludeCols( 0 ), ExplSlackRemoved( 0 ),
-	bl( 0 ), bu( 0 ), rt( 0 ), f( 0.0 ), ColList(), RowList(),
+	bl( 0 ), bu( 0 ), rt( 0 ), f( 0.0 ), ProtRows( NULL ), ProtCols( NULL ),
+	ColList(), RowList(),
 
 	//--------------------------------------------------------------------------
 	//	Initialize the statistic counters.
@@ -537,3 +538,49 @@ void Presolver::UpdateLP_AfterReductions( void )
 	LP.UpdateAfterReduction( &ExcludeRows, &ExcludeCols );
 	LP.UpdateRowStructure();
 }
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T Presolver::IsScenarioSafeRow( Int_T i ) const
+
+PURPOSE:
+	Checks whether a reduction that eliminates row 'i' while modifying the costs
+of the columns present in it (free singleton column or explicit slack removal,
+forcing row) may be performed when some of the data are random. The answer is
+positive if neither the row, nor any of the columns that are still present in
+it have been protected by "ProtectRowsAndColumns()".
+
+PARAMETERS:
+	Int_T i
+		Row number.
+
+RETURN VALUE:
+	'True' if the row may be reduced, 'False' otherwise.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T Presolver::IsScenarioSafeRow( Int_T i )
+const
+{
+	assert( i >= 0 && i < m && !ExcludeRows[i] );
+
+	if( IsProtectedRow( i ) )
+		return False;
+
+	if( ProtCols != NULL )
+	{
+		Ptr<Real_T> a;
+		Ptr<Int_T> col;
+		Int_T len;
+
+		for( LP.GetRow( i, a, col, len ); len; ++col, --len )
+			if( !ExcludeCols[ *col ] && (*ProtCols)[ *col ] )
+				return False;
+	}
+
+	return True;
+}
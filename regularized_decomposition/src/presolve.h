@@ -94,6 +94,14 @@ private:
 	Array<Short_T> rt;		// Row type coded as variable types are.
 
 	Real_T f;				// Fixed adjustment to the objective function.
+
+	//
+	//	Rows and columns holding random data (used when presolving a recourse
+	//	problem, whose right hand side and cost change from one scenario to
+	//	another). Reductions that depend on the right hand side of a protected
+	//	row or on the cost of a protected column are not performed.
+	//
+	const Array<Bool_T> *ProtRows, *ProtCols;
 		
 	//
 	// List of columns/rows ordered by their lengths.
@@ -142,7 +150,22 @@ public:
 	void SetFTOL( Real_T v );
 	Real_T GetFTOL( void ) const;
 
+	//--------------------------------------------------------------------------
+	//	Scenario-safe presolve: protection of random data and access to the
+	//	reduction performed (valid until "ReleaseWorkMemory()" is called).
+	//
+	void ProtectRowsAndColumns( const Array<Bool_T> *Rows,
+		const Array<Bool_T> *Cols );
+
+	Bool_T IsRowExcluded( Int_T i ) const;
+	Bool_T IsColExcluded( Int_T j ) const;
+	Real_T GetFixedAdjustment( void ) const;
+
 private:
+	Bool_T IsProtectedRow( Int_T i ) const;
+	Bool_T IsProtectedCol( Int_T j ) const;
+	Bool_T IsScenarioSafeRow( Int_T i ) const;
+
 	//--------------------------------------------------------------------------
 	//	Auxiliary functions for internal data management.
 	//
@@ -262,4 +285,49 @@ Real_T Presolver::GetFTOL( void )
 const
 { return ftol; }
 
+
+inline
+void Presolver::ProtectRowsAndColumns( const Array<Bool_T> *Rows, // )
+	const Array<Bool_T> *Cols )
+{
+	ProtRows = Rows;
+	ProtCols = Cols;
+}
+
+
+inline
+Bool_T Presolver::IsRowExcluded( Int_T i )
+const
+{
+	assert( i >= 0 && i < m );
+	return ExcludeRows[i];
+}
+
+
+inline
+Bool_T Presolver::IsColExcluded( Int_T j )
+const
+{
+	assert( j >= 0 && j < n );
+	return ExcludeCols[j];
+}
+
+
+inline
+Real_T Presolver::GetFixedAdjustment( void )
+const
+{ return f; }
+
+
+inline
+Bool_T Presolver::IsProtectedRow( Int_T i )
+const
+{ return ( ProtRows != NULL && (*ProtRows)[i] ) ? True : False; }
+
+
+inline
+Bool_T Presolver::IsProtectedCol( Int_T j )
+const
+{ return ( ProtCols != NULL && (*ProtCols)[j] ) ? True : False; }
+
 #endif
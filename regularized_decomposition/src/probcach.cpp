@@ -0,0 +1,1003 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		File input / output routines.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE NAME:	probcach.cpp
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.18
+
+DEPENDENCIES:		probcach.h, mps_lp.h, determlp.h, scenario.h, smartptr.h,
+					stdtype.h, std_tmpl.h, error.h
+					<stdio.h>, <string.h>, <assert.h>, <sys/stat.h>
+					<unistd.h>, <sys/types.h>, <sys/wait.h> (UNIX only)
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE CONTENTS:
+	The problem cache. Reading the core, time and stochastic data files of a
+large problem (parsing, label sorting and look-ups) takes much longer than
+reading the same data in binary form. So the data are written to a cache file
+once and on subsequent runs are read from it instead (as long as none of the
+three files changes).
+	The cache holds the data as they are right after the files are read: the
+deterministic LP (with labels), the stage division and the distributions. All
+that depends on the options of a run (the crash, scenario generation, scaling
+and division into stages) is done anew every time. The results of a run do not
+depend on whether the cache was used or not.
+	The cache file consists of:
+	-	a header (a magic string, the cache version and the sizes of the basic
+		types),
+	-	the names, sizes and modification times of the three input files,
+	-	the stage division,
+	-	the LP (see "MPS_LP::WriteBin()"),
+	-	the distributions (see "Scenarios::WriteDistributions()"),
+	-	the magic string again (to detect truncated files).
+	All numbers are stored in the binary form of the machine, so the file may
+not be moved between different machines (the header check rejects it then).
+	The same routines are used for the binary LP files (a header with a magic
+string of its own, the LP and the magic string again). Such a file is a much
+faster alternative to an MPS file, when a very large LP (e.g. a deterministic
+equivalent) is to be stored and read back. "MPS_LP::ReadLP()" recognizes it
+automatically.
+	Finally, the same binary form of the distributions is used to pass them from
+a background reader process (see "StartStochReader()"), so that the stochastic
+data file may be parsed while the main process is busy solving the crash LP.
+
+--------------------------------------------------------------------------------
+
+PUBLIC INTERFACE:
+	Bool_T WriteProblemCache( ... )
+	Bool_T ReadProblemCache( ... )
+	Bool_T StartStochReader( const char *StochFile, DeterministicLP &LP )
+	Bool_T FinishStochReader( Scenarios &Scen )
+
+	Bool_T MPS_LP::WriteBin( FILE *fp ) const
+	Bool_T MPS_LP::ReadBin( FILE *fp )
+	Bool_T MPS_LP::WriteLP_Bin( const char *FileName ) const
+	Bool_T MPS_LP::ReadLP_Bin( FILE *fp )
+	static Bool_T MPS_LP::IsBinaryLP( FILE *fp )
+	Bool_T Scenarios::WriteDistributions( FILE *fp ) const
+	Bool_T Scenarios::ReadDistributions( FILE *fp )
+	Bool_T Distribution::WriteBin( FILE *fp ) const
+	Bool_T Distribution::ReadBin( FILE *fp )
+	Bool_T ScenarioStore::ReadBin( FILE *fp, Int_T Scens, Int_T DeltaCount )
+
+STATIC FUNCTIONS:
+	static Bool_T WriteArray( FILE *fp, const Array<T> &a, Int_T len )
+	static Bool_T ReadArray( FILE *fp, Array<T> &a, Int_T len )
+	static Bool_T WriteHeader( FILE *fp, const char *Magic, Int_T Version )
+	static Bool_T CheckHeader( FILE *fp, const char *Magic, Int_T Version )
+	static Bool_T WriteStamp( FILE *fp, const char *FileName )
+	static Bool_T CheckStamp( FILE *fp, const char *FileName )
+
+STATIC DATA:
+	static const char CacheMagic[]
+	static const char LP_BinMagic[]
+	static FILE *ReaderPipe
+	static pid_t ReaderID
+
+--------------------------------------------------------------------------------
+
+USED MACROS AND THEIR MEANING:
+	SUPPORT_STOCH_READER	- defined (below) on systems with "fork()" and
+							"pipe()"; the background reader is not available
+							on other systems.
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <sys/stat.h>
+
+#if defined( unix ) || defined( __unix ) || defined( __unix__ )
+#	define SUPPORT_STOCH_READER
+#	include <unistd.h>
+#	include <sys/types.h>
+#	include <sys/wait.h>
+#endif
+
+#ifndef __PROBCACH_H__
+#	include "probcach.h"
+#endif
+#ifndef __STDTYPE_H__
+#	include "stdtype.h"
+#endif
+#ifndef __STD_TMPL_H__
+#	include "std_tmpl.h"
+#endif
+#ifndef __SMARTPTR_H__
+#	include "smartptr.h"
+#endif
+#ifndef __MPS_LP_H__
+#	include "mps_lp.h"
+#endif
+#ifndef __DETERMLP_H__
+#	include "determlp.h"
+#endif
+#ifndef __SCENARIO_H__
+#	include "scenario.h"
+#endif
+#ifndef __ERROR_H__
+#	include "error.h"
+#endif
+
+
+//------------------------------------------------------------------------------
+//	The cache and binary LP file signatures and versions. A version has to be
+//	changed whenever the layout of the file changes. Both signatures have the
+//	same length ("MAGIC_LEN" characters including the terminating zero).
+//
+#define CACHE_VERSION	(1)
+#define LP_BIN_VERSION	(1)
+#define MAGIC_LEN		(9)
+
+static const char CacheMagic[ MAGIC_LEN ] = "RD_CACHE";
+static const char LP_BinMagic[ MAGIC_LEN ] = "RD_LPBIN";
+//
+//------------------------------------------------------------------------------
+
+
+#if defined( SUPPORT_STOCH_READER )
+//------------------------------------------------------------------------------
+//	The background stochastic file reader: the read end of the pipe and the
+//	process identifier.
+//
+static FILE *ReaderPipe = NULL;
+static pid_t ReaderID = -1;
+//
+//------------------------------------------------------------------------------
+#endif
+
+
+//------------------------------------------------------------------------------
+//	Binary input / output of a (leading part of an) array.
+//
+template < class T >
+static inline
+Bool_T WriteArray( FILE *fp, const Array<T> &a, Int_T len )
+{ return Bool_T( len <= 0 || WriteBinArray( fp, &a[0], (size_t) len ) ); }
+
+
+template < class T >
+static inline
+Bool_T ReadArray( FILE *fp, Array<T> &a, Int_T len )
+{ return Bool_T( len <= 0 || ReadBinArray( fp, &a[0], (size_t) len ) ); }
+//
+//------------------------------------------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+
+	static Bool_T WriteHeader( FILE *fp, const char *Magic, Int_T Version )
+	static Bool_T CheckHeader( FILE *fp, const char *Magic, Int_T Version )
+	static Bool_T WriteStamp( FILE *fp, const char *FileName )
+	static Bool_T CheckStamp( FILE *fp, const char *FileName )
+
+PURPOSE:
+	The first two functions write and check the cache (or binary LP) file
+header (magic string, version and type sizes). The last two write and check
+the description of an input file (its name, size and modification time). The
+check fails if the file no longer is what it was when the cache was written.
+
+PARAMETERS:
+	FILE *fp
+		An open cache file.
+
+	const char *Magic, Int_T Version
+		File signature ("MAGIC_LEN" characters) and version.
+
+	const char *FileName
+		Input file name.
+
+RETURN VALUE:
+	Success status.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static Bool_T WriteHeader( FILE *fp, const char *Magic, Int_T Version )
+{
+	Int_T Head[6] = { Version, sizeof( Int_T ), sizeof( Real_T ),
+		sizeof( Short_T ), sizeof( Delta ), LAB_LEN };
+
+	return Bool_T( WriteBinArray( fp, Magic, MAGIC_LEN ) &&
+		WriteBinArray( fp, Head, 6 ) );
+}
+
+
+static Bool_T CheckHeader( FILE *fp, const char *Magic, Int_T Version )
+{
+	char FileMagic[ MAGIC_LEN ];
+	Int_T Head[6];
+
+	if( !ReadBinArray( fp, FileMagic, MAGIC_LEN ) ||
+		memcmp( FileMagic, Magic, MAGIC_LEN ) != 0 ||
+		!ReadBinArray( fp, Head, 6 ) )
+		return False;
+
+	return Bool_T( Head[0] == Version &&
+		Head[1] == (Int_T) sizeof( Int_T ) &&
+		Head[2] == (Int_T) sizeof( Real_T ) &&
+		Head[3] == (Int_T) sizeof( Short_T ) &&
+		Head[4] == (Int_T) sizeof( Delta ) &&
+		Head[5] == LAB_LEN );
+}
+
+
+static Bool_T WriteStamp( FILE *fp, const char *FileName )
+{
+	struct stat st;
+
+	if( stat( FileName, &st ) != 0 )
+		return False;
+
+	long Stamp[2] = { (long) st.st_size, (long) st.st_mtime };
+	Int_T NameLen = (Int_T) strlen( FileName );
+
+	return Bool_T( WriteBinArray( fp, &NameLen, 1 ) &&
+		WriteBinArray( fp, FileName, NameLen ) &&
+		WriteBinArray( fp, Stamp, 2 ) );
+}
+
+
+static Bool_T CheckStamp( FILE *fp, const char *FileName )
+{
+	struct stat st;
+	Int_T NameLen;
+	long Stamp[2];
+
+	if( stat( FileName, &st ) != 0 || !ReadBinArray( fp, &NameLen, 1 ) ||
+		NameLen != (Int_T) strlen( FileName ) )
+		return False;
+
+	for( Int_T i = 0; i < NameLen; i++ )
+		if( getc( fp ) != (unsigned char) FileName[i] )
+			return False;
+
+	if( !ReadBinArray( fp, Stamp, 2 ) )
+		return False;
+
+	return Bool_T( Stamp[0] == (long) st.st_size &&
+		Stamp[1] == (long) st.st_mtime );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T WriteProblemCache( const char *CacheFile, const char *CoreFile,
+		const char *TimeFile, const char *StochFile, const DeterministicLP &LP,
+		Int_T Stage1Row, Int_T Stage1Col, Int_T Stage2Row, Int_T Stage2Col,
+		const Scenarios &Scen )
+
+	Bool_T ReadProblemCache( const char *CacheFile, const char *CoreFile,
+		const char *TimeFile, const char *StochFile, DeterministicLP &LP,
+		Int_T &Stage1Row, Int_T &Stage1Col, Int_T &Stage2Row,
+		Int_T &Stage2Col, Scenarios &Scen )
+
+PURPOSE:
+	The first function writes the cache. It has to be called after the three
+input files were read, but before anything else is done with the data. The
+cache is first written to a temporary file, which is then renamed (so that
+concurrent runs never see an incomplete cache).
+	The second function reads the cache. It fails if the cache does not exist,
+was written by a different version of the program or for different (or
+modified) input files.
+
+PARAMETERS:
+	const char *CacheFile
+		Cache file name.
+
+	const char *CoreFile, const char *TimeFile, const char *StochFile
+		The names of the input files.
+
+	DeterministicLP &LP
+		The LP read from the core file (must be empty, when the cache is read).
+
+	Int_T Stage1Row, Int_T Stage1Col, Int_T Stage2Row, Int_T Stage2Col
+		The division into stages (as read from the time file).
+
+	Scenarios &Scen
+		The distributions read from the stochastic file (must be empty, when
+		the cache is read).
+
+RETURN VALUE:
+	Success status. When reading fails, "LP" and "Scen" may be partially
+filled and should be disposed of.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T WriteProblemCache( const char *CacheFile, const char *CoreFile, // )
+	const char *TimeFile, const char *StochFile, const DeterministicLP &LP,
+	Int_T Stage1Row, Int_T Stage1Col, Int_T Stage2Row, Int_T Stage2Col,
+	const Scenarios &Scen )
+{
+	assert( CacheFile != NULL && *CacheFile );
+
+	char TmpName[ FILENAME_MAX + 5 ];
+
+	if( strlen( CacheFile ) > FILENAME_MAX ) return False;
+	sprintf( TmpName, "%s.tmp", CacheFile );
+
+	FILE *fp = fopen( TmpName, "wb" );
+	if( fp == NULL ) return False;
+
+	Int_T Stages[4] = { Stage1Row, Stage1Col, Stage2Row, Stage2Col };
+
+	Bool_T Success = Bool_T( WriteHeader( fp, CacheMagic, CACHE_VERSION ) &&
+		WriteStamp( fp, CoreFile ) && WriteStamp( fp, TimeFile ) &&
+		WriteStamp( fp, StochFile ) && WriteBinArray( fp, Stages, 4 ) &&
+		LP.WriteBin( fp ) && Scen.WriteDistributions( fp ) &&
+		WriteBinArray( fp, CacheMagic, MAGIC_LEN ) );
+
+	if( fclose( fp ) != 0 )
+		Success = False;
+
+	if( Success )
+	{
+		remove( CacheFile );
+		Success = Bool_T( rename( TmpName, CacheFile ) == 0 );
+	}
+
+	if( !Success )
+		remove( TmpName );
+
+	return Success;
+}
+
+
+Bool_T ReadProblemCache( const char *CacheFile, const char *CoreFile, // )
+	const char *TimeFile, const char *StochFile, DeterministicLP &LP,
+	Int_T &Stage1Row, Int_T &Stage1Col, Int_T &Stage2Row, Int_T &Stage2Col,
+	Scenarios &Scen )
+{
+	assert( CacheFile != NULL && *CacheFile );
+
+	FILE *fp = fopen( CacheFile, "rb" );
+	if( fp == NULL ) return False;
+
+	Int_T Stages[4];
+	char Magic[ MAGIC_LEN ];
+
+	Bool_T Success = Bool_T( CheckHeader( fp, CacheMagic, CACHE_VERSION ) &&
+		CheckStamp( fp, CoreFile ) && CheckStamp( fp, TimeFile ) &&
+		CheckStamp( fp, StochFile ) && ReadBinArray( fp, Stages, 4 ) &&
+		LP.ReadBin( fp ) && Scen.ReadDistributions( fp ) &&
+		ReadBinArray( fp, Magic, MAGIC_LEN ) &&
+		memcmp( Magic, CacheMagic, MAGIC_LEN ) == 0 );
+
+	fclose( fp );
+
+	if( Success )
+	{
+		Stage1Row	= Stages[0];
+		Stage1Col	= Stages[1];
+		Stage2Row	= Stages[2];
+		Stage2Col	= Stages[3];
+	}
+
+	return Success;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T StartStochReader( const char *StochFile, DeterministicLP &LP )
+	Bool_T FinishStochReader( Scenarios &Scen )
+
+PURPOSE:
+	Parsing a large stochastic data file takes long, but it only depends on the
+labels of the deterministic LP. The first function starts a separate process
+(a copy of this one), which reads the file and sends the distributions back
+through a pipe in the binary form of the problem cache. The main process may go
+on with other work (e.g. the crash) in the meantime. The second function
+receives the distributions and waits for the reader to terminate.
+	Processes (rather than threads) are used, because the parsers, the error
+counters and the memory block counters are all shared static data. Error
+messages of the reader are printed by the reader itself.
+
+PARAMETERS:
+	const char *StochFile
+		Stochastic data file name.
+
+	DeterministicLP &LP
+		The deterministic LP (it must not change until the reader is done).
+
+	Scenarios &Scen
+		An empty scenario repository object.
+
+RETURN VALUE:
+	Success status. When "StartStochReader" fails (or there is no background
+reader support), the file has to be read in the usual way. When
+"FinishStochReader" fails, the file could not be read (the reason has already
+been reported); "Scen" may be partially filled then and should be disposed of.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T StartStochReader( const char *StochFile, DeterministicLP &LP )
+{
+	assert( StochFile != NULL && *StochFile );
+
+#if defined( SUPPORT_STOCH_READER )
+	assert( ReaderPipe == NULL );
+
+	int fd[2];
+
+	if( pipe( fd ) != 0 ) return False;
+
+	//--------------------------------------------------------------------------
+	//	Flush the output buffers, so that they are not written twice.
+	//
+	fflush( stdout );
+	fflush( stderr );
+
+	pid_t pid = fork();
+
+	if( pid < 0 )
+	{
+		close( fd[0] );
+		close( fd[1] );
+		return False;
+	}
+	else if( pid == 0 )
+	{
+		//----------------------------------------------------------------------
+		//	The reader process. It terminates with "_exit()", which neither
+		//	calls the destructors, nor writes anything left over from the
+		//	parent process.
+		//
+		close( fd[0] );
+
+		Scenarios Scen;
+		FILE *out = fdopen( fd[1], "wb" ),
+			*fp = fopen( StochFile, "r" );
+
+		if( fp == NULL )
+			Error( "Unable to open stoch file %s.", StochFile );
+
+		Bool_T Success = Bool_T( out != NULL && fp != NULL &&
+			Scen.ReadScenarioFile( StochFile, fp, LP ) &&
+			Scen.WriteDistributions( out ) );
+
+		if( out != NULL && fclose( out ) != 0 )
+			Success = False;
+		fflush( stdout );
+		fflush( stderr );
+		_exit( Success ? 0 : 1 );
+	}
+
+	//--------------------------------------------------------------------------
+	//	The main process.
+	//
+	close( fd[1] );
+
+	ReaderPipe = fdopen( fd[0], "rb" );
+	ReaderID = pid;
+
+	if( ReaderPipe == NULL )
+	{
+		close( fd[0] );
+		waitpid( pid, NULL, 0 );
+		return False;
+	}
+
+	return True;
+#else
+	(void) LP;
+	return False;
+#endif
+}
+
+
+Bool_T FinishStochReader( Scenarios &Scen )
+{
+#if defined( SUPPORT_STOCH_READER )
+	assert( ReaderPipe != NULL );
+
+	Bool_T Success = Scen.ReadDistributions( ReaderPipe );
+	int Status;
+
+	fclose( ReaderPipe );
+	ReaderPipe = NULL;
+
+	if( waitpid( ReaderID, &Status, 0 ) != ReaderID ||
+		!WIFEXITED( Status ) || WEXITSTATUS( Status ) != 0 )
+		Success = False;
+	ReaderID = -1;
+
+	return Success;
+#else
+	(void) Scen;
+	assert( False );			// "StartStochReader()" never succeeds here.
+	return False;
+#endif
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T MPS_LP::WriteBin( FILE *fp ) const
+	Bool_T MPS_LP::ReadBin( FILE *fp )
+
+PURPOSE:
+	Write / read the complete LP in binary form (dimensions, statistics, names,
+all vectors, the matrix and the labels). The labels are sorted after they are
+read, just as after reading an MPS file.
+
+PARAMETERS:
+	FILE *fp
+		An open binary file.
+
+RETURN VALUE:
+	Success status. "ReadBin" leaves the object empty on failure.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T MPS_LP::WriteBin( FILE *fp )
+	const
+{
+	assert( OS == OS_FULL );
+
+	Int_T Dim[14] = { n, m, nz, ObjRow, mE, mG, mL, mR, mF, nPL, nFX, nFR,
+		nMI, nUP };
+
+	if( !WriteBinArray( fp, Dim, 14 ) ||
+		!WriteBinArray( fp, Name, LAB_LEN + 1 ) ||
+		!WriteBinArray( fp, RHS_Name, LAB_LEN + 1 ) ||
+		!WriteBinArray( fp, BoundsName, LAB_LEN + 1 ) ||
+		!WriteBinArray( fp, RangesName, LAB_LEN + 1 ) ||
+		!WriteArray( fp, RowType, m ) || !WriteArray( fp, b, m ) ||
+		!WriteArray( fp, r, m ) ||
+		!WriteArray( fp, ac, nz ) || !WriteArray( fp, Row, nz ) ||
+		!WriteArray( fp, ColStart, n + 1 ) ||
+		!WriteArray( fp, VarType, n ) || !WriteArray( fp, l, n ) ||
+		!WriteArray( fp, u, n ) )
+		return False;
+
+	Int_T i;
+
+	for( i = 0; i < m; i++ )
+		if( !WriteBinArray( fp, RowLabels.FindLabel( i ), LAB_LEN + 1 ) )
+			return False;
+	for( i = 0; i < n; i++ )
+		if( !WriteBinArray( fp, ColLabels.FindLabel( i ), LAB_LEN + 1 ) )
+			return False;
+
+	return True;
+}
+
+
+Bool_T MPS_LP::ReadBin( FILE *fp )
+{
+	assert( OS == OS_EMPTY );
+
+	Int_T Dim[14];
+
+	if( !ReadBinArray( fp, Dim, 14 ) || Dim[0] < 0 || Dim[1] < 0 || Dim[2] < 0 )
+		return False;
+
+	n		= Dim[0];	m		= Dim[1];	nz		= Dim[2];
+	ObjRow	= Dim[3];
+	mE		= Dim[4];	mG		= Dim[5];	mL		= Dim[6];
+	mR		= Dim[7];	mF		= Dim[8];
+	nPL		= Dim[9];	nFX		= Dim[10];	nFR		= Dim[11];
+	nMI		= Dim[12];	nUP		= Dim[13];
+
+	RowType.Resize( m );
+	b.Resize( m );
+	r.Resize( m );
+	ac.Resize( nz );
+	Row.Resize( nz );
+	ColStart.Resize( n + 1 );
+	VarType.Resize( n );
+	l.Resize( n );
+	u.Resize( n );
+
+	if( !ReadBinArray( fp, Name, LAB_LEN + 1 ) ||
+		!ReadBinArray( fp, RHS_Name, LAB_LEN + 1 ) ||
+		!ReadBinArray( fp, BoundsName, LAB_LEN + 1 ) ||
+		!ReadBinArray( fp, RangesName, LAB_LEN + 1 ) ||
+		!ReadArray( fp, RowType, m ) || !ReadArray( fp, b, m ) ||
+		!ReadArray( fp, r, m ) ||
+		!ReadArray( fp, ac, nz ) || !ReadArray( fp, Row, nz ) ||
+		!ReadArray( fp, ColStart, n + 1 ) ||
+		!ReadArray( fp, VarType, n ) || !ReadArray( fp, l, n ) ||
+		!ReadArray( fp, u, n ) )
+		goto error;
+
+	Name[LAB_LEN]		= '\0';
+	RHS_Name[LAB_LEN]	= '\0';
+	BoundsName[LAB_LEN]	= '\0';
+	RangesName[LAB_LEN]	= '\0';
+
+	OS = OS_NO_LABELS;
+
+	{
+		Lbl lab;
+		Int_T i;
+
+		for( i = 0; i < m; i++ )
+		{
+			if( !ReadBinArray( fp, lab, LAB_LEN + 1 ) ) goto error;
+			lab[LAB_LEN] = '\0';
+			RowLabels.AddLabel( lab );
+		}
+		for( i = 0; i < n; i++ )
+		{
+			if( !ReadBinArray( fp, lab, LAB_LEN + 1 ) ) goto error;
+			lab[LAB_LEN] = '\0';
+			ColLabels.AddLabel( lab );
+		}
+	}
+
+	if( m > 0 ) RowLabels.SortLabels();
+	if( n > 0 ) ColLabels.SortLabels();
+
+	OS = OS_FULL;
+	return True;
+
+error:
+	FreeStorage();
+	return False;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T MPS_LP::WriteLP_Bin( const char *FileName ) const
+	Bool_T MPS_LP::ReadLP_Bin( FILE *fp )
+	static Bool_T MPS_LP::IsBinaryLP( FILE *fp )
+
+PURPOSE:
+	The first function writes the LP to a binary LP file (header, the LP as
+written by "WriteBin()" and the signature again). The second one reads such a
+file from an open stream (the header included). The third one checks if the
+stream (at its current position) holds a binary LP file. The stream position
+is restored afterwards, so that an MPS file may be read from it, if it is not.
+
+PARAMETERS:
+	const char *FileName
+		Output file name.
+
+	FILE *fp
+		An open input stream.
+
+RETURN VALUE:
+	Success status (for "IsBinaryLP": True if the signature was found).
+"ReadLP_Bin" leaves the object empty on failure.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T MPS_LP::WriteLP_Bin( const char *FileName )
+	const
+{
+	assert( FileName != NULL && *FileName );
+
+	FILE *fp = fopen( FileName, "wb" );
+	if( fp == NULL ) return False;
+
+	Bool_T Success = Bool_T( WriteHeader( fp, LP_BinMagic, LP_BIN_VERSION ) &&
+		WriteBin( fp ) && WriteBinArray( fp, LP_BinMagic, MAGIC_LEN ) );
+
+	if( fclose( fp ) != 0 )
+		Success = False;
+	if( !Success )
+		remove( FileName );
+
+	return Success;
+}
+
+
+Bool_T MPS_LP::ReadLP_Bin( FILE *fp )
+{
+	char Magic[ MAGIC_LEN ];
+
+	if( !CheckHeader( fp, LP_BinMagic, LP_BIN_VERSION ) || !ReadBin( fp ) )
+		return False;
+
+	if( !ReadBinArray( fp, Magic, MAGIC_LEN ) ||
+		memcmp( Magic, LP_BinMagic, MAGIC_LEN ) != 0 )
+	{
+		FreeStorage();
+		return False;
+	}
+
+	return True;
+}
+
+
+Bool_T MPS_LP::IsBinaryLP( FILE *fp )
+{
+	assert( fp != NULL );
+
+	char Magic[ MAGIC_LEN ];
+	long Pos = ftell( fp );
+
+	if( Pos < 0 ) return False;
+
+	Bool_T Binary = Bool_T( fread( Magic, 1, MAGIC_LEN, fp ) == MAGIC_LEN &&
+		memcmp( Magic, LP_BinMagic, MAGIC_LEN ) == 0 );
+
+	clearerr( fp );
+	if( fseek( fp, Pos, SEEK_SET ) != 0 )
+		return False;
+
+	return Binary;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T Scenarios::WriteDistributions( FILE *fp ) const
+	Bool_T Scenarios::ReadDistributions( FILE *fp )
+
+PURPOSE:
+	Write / read all distributions (in the state they are in after the
+stochastic data file was read, i.e. before the scenarios are generated). After
+reading, the object is in the same state as after "ReadScenarioFile()".
+
+PARAMETERS:
+	FILE *fp
+		An open binary file.
+
+RETURN VALUE:
+	Success status. "ReadDistributions" leaves the object empty on failure.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T Scenarios::WriteDistributions( FILE *fp )
+	const
+{
+	assert( status == DISTRIBUTIONS_READY );
+
+	if( !WriteBinArray( fp, &len, 1 ) )
+		return False;
+
+	for( Int_T d = 0; d < len; d++ )
+		if( !dist[d]->WriteBin( fp ) )
+			return False;
+
+	return True;
+}
+
+
+Bool_T Scenarios::ReadDistributions( FILE *fp )
+{
+	assert( status == EMPTY && len == 0 );
+
+	Int_T DistNum;
+
+	if( !ReadBinArray( fp, &DistNum, 1 ) || DistNum < 0 )
+		return False;
+
+	for( Int_T d = 0; d < DistNum; d++ )
+	{
+		AppendNewDistribution();
+
+		if( !dist[len-1]->ReadBin( fp ) )
+		{
+			CleanupDistributions();
+			return False;
+		}
+	}
+
+	status = DISTRIBUTIONS_READY;
+	return True;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T Distribution::WriteBin( FILE *fp ) const
+	Bool_T Distribution::ReadBin( FILE *fp )
+	Bool_T ScenarioStore::ReadBin( FILE *fp, Int_T Scens, Int_T DeltaCount )
+
+PURPOSE:
+	Write / read one distribution. A continuous distribution is stored as its
+law and the random datum. A discrete one is stored as the probabilities of all
+blocks, their lengths and all their deltas. Whatever the blocks were, they are
+read into a scenario store (see "Distribution::Attach()"), which keeps them
+packed. This is done by the last function.
+
+PARAMETERS:
+	FILE *fp
+		An open binary file.
+
+	Int_T Scens, Int_T DeltaCount
+		The number of blocks and the total number of their deltas.
+
+RETURN VALUE:
+	Success status.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T Distribution::WriteBin( FILE *fp )
+	const
+{
+	assert( Store == NULL || len == Store->GetNumberOfScenarios() );
+
+	Int_T Head[2] = { ( Law != NULL ) ? 1 : 0, len };
+
+	if( !WriteBinArray( fp, Head, 2 ) )
+		return False;
+
+	//--------------------------------------------------------------------------
+	//	A continuous distribution.
+	//
+	if( Law != NULL )
+	{
+		ParametricLaw::LawType t;
+		Real_T p[2];
+
+		Law->GetParameters( t, p[0], p[1] );
+
+		Int_T Type = (Int_T) t;
+		const Delta &Template = (*block[0])[0];
+
+		return Bool_T( WriteBinArray( fp, &Type, 1 ) &&
+			WriteBinArray( fp, p, 2 ) && WriteBinArray( fp, &Template, 1 ) );
+	}
+
+	//--------------------------------------------------------------------------
+	//	A discrete distribution.
+	//
+	Int_T i, DeltaCount = 0;
+
+	for( i = 0; i < len; i++ )
+		DeltaCount += block[i]->Len();
+
+	if( !WriteBinArray( fp, &DeltaCount, 1 ) )
+		return False;
+
+	for( i = 0; i < len; i++ )
+	{
+		Real_T prob = block[i]->GetProbability();
+
+		if( !WriteBinArray( fp, &prob, 1 ) )
+			return False;
+	}
+
+	for( i = 0; i < len; i++ )
+	{
+		Int_T bl = block[i]->Len();
+
+		if( !WriteBinArray( fp, &bl, 1 ) )
+			return False;
+	}
+
+	for( i = 0; i < len; i++ )
+	{
+		const StochasticDataBlock &sdb = *block[i];
+
+		for( Int_T j = 0, bl = sdb.Len(); j < bl; j++ )
+			if( !WriteBinArray( fp, &sdb[j], 1 ) )
+				return False;
+	}
+
+	return True;
+}
+
+
+Bool_T Distribution::ReadBin( FILE *fp )
+{
+	assert( len == 0 && Store == NULL && Law == NULL );
+
+	Int_T Head[2];
+
+	if( !ReadBinArray( fp, Head, 2 ) || Head[1] < 0 )
+		return False;
+
+	//--------------------------------------------------------------------------
+	//	A continuous distribution.
+	//
+	if( Head[0] == 1 )
+	{
+		Int_T Type;
+		Real_T p[2];
+		Delta Template;
+
+		if( !ReadBinArray( fp, &Type, 1 ) || !ReadBinArray( fp, p, 2 ) ||
+			!ReadBinArray( fp, &Template, 1 ) )
+			return False;
+
+		ParametricLaw *law = new ParametricLaw( (ParametricLaw::LawType) Type,
+			p[0], p[1] );
+		if( law == NULL ) FatalError( "Out of memory." );
+
+		SetLaw( law, Template.type, Template.row, Template.col );
+		return True;
+	}
+
+	//--------------------------------------------------------------------------
+	//	A discrete distribution.
+	//
+	Int_T DeltaCount;
+
+	if( Head[0] != 0 || !ReadBinArray( fp, &DeltaCount, 1 ) ||
+		DeltaCount < 0 )
+		return False;
+
+	ScenarioStore *store = new ScenarioStore;
+	if( store == NULL ) FatalError( "Out of memory." );
+
+	if( !store->ReadBin( fp, Head[1], DeltaCount ) )
+	{
+		delete store;
+		return False;
+	}
+
+	Attach( store );
+	return True;
+}
+
+
+Bool_T ScenarioStore::ReadBin( FILE *fp, Int_T Scens, Int_T DeltaCount )
+{
+	assert( ScenNum == 0 && DeltaNum == 0 && Blocks == NULL );
+	assert( Scens >= 0 && DeltaCount >= 0 );
+
+	MaxScenNum	= Max( Scens, Int_T( 1 ) );
+	MaxDeltaNum	= Max( DeltaCount, Int_T( 1 ) );
+
+	Start.Resize( MaxScenNum + 1 );
+	Prob.Resize( MaxScenNum );
+	Deltas.Resize( MaxDeltaNum );
+
+	//--------------------------------------------------------------------------
+	//	Read the probabilities, then the block lengths (converted to the block
+	//	starts) and finally the deltas.
+	//
+	Start[0] = 0;
+
+	if( !ReadArray( fp, Prob, Scens ) ||
+		( Scens > 0 && !ReadBinArray( fp, &Start[1], (size_t) Scens ) ) )
+		return False;
+
+	for( Int_T s = 0; s < Scens; s++ )
+	{
+		if( Start[s+1] < 0 ) return False;
+		Start[s+1] += Start[s];
+	}
+
+	if( Start[Scens] != DeltaCount || !ReadArray( fp, Deltas, DeltaCount ) )
+		return False;
+
+	ScenNum		= Scens;
+	DeltaNum	= DeltaCount;
+
+	//
+	//	The names are only needed while reading the stochastic file.
+	//
+	delete Names;
+	Names = NULL;
+
+	return True;
+}
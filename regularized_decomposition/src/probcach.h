@@ -0,0 +1,87 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		File input / output routines.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+HEADER FILE NAME:	probcach.h
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.18
+
+DEPENDENCIES:		stdtype.h,
+					<stdio.h>
+
+--------------------------------------------------------------------------------
+
+HEADER CONTENTS:
+	Public interface of the problem cache. The cache is a binary file holding
+the deterministic LP, its division into stages (as read from the time file) and
+the distributions read from the stochastic data file. It is only valid for the
+very files it was created from (their names, sizes and modification times are
+stored in the cache) and for the program version which wrote it.
+	The stochastic data file may also be read by a background process, which
+passes the distributions back in the same binary form.
+	Two inline function templates for reading and writing arrays of simple
+objects are also defined here.
+
+------------------------------------------------------------------------------*/
+
+#ifndef __PROBCACH_H__
+#define __PROBCACH_H__
+
+#include <stdio.h>
+
+#ifndef __STDTYPE_H__
+#	include "stdtype.h"
+#endif
+
+
+//==============================================================================
+//
+//	Function prototypes.
+//
+//==============================================================================
+
+class DeterministicLP;
+class Scenarios;
+
+Bool_T WriteProblemCache( const char *CacheFile, const char *CoreFile,
+	const char *TimeFile, const char *StochFile, const DeterministicLP &LP,
+	Int_T Stage1Row, Int_T Stage1Col, Int_T Stage2Row, Int_T Stage2Col,
+	const Scenarios &Scen );
+Bool_T ReadProblemCache( const char *CacheFile, const char *CoreFile,
+	const char *TimeFile, const char *StochFile, DeterministicLP &LP,
+	Int_T &Stage1Row, Int_T &Stage1Col, Int_T &Stage2Row, Int_T &Stage2Col,
+	Scenarios &Scen );
+
+Bool_T StartStochReader( const char *StochFile, DeterministicLP &LP );
+Bool_T FinishStochReader( Scenarios &Scen );
+
+//==============================================================================
+//
+//	End of function prototypes.
+//
+//==============================================================================
+
+
+//------------------------------------------------------------------------------
+//	Binary input / output of "len" objects (no conversions are made).
+//
+template < class T >
+inline
+Bool_T WriteBinArray( FILE *fp, const T *t, size_t len )
+{ return Bool_T( len == 0 || fwrite( t, sizeof( T ), len, fp ) == len ); }
+
+
+template < class T >
+inline
+Bool_T ReadBinArray( FILE *fp, T *t, size_t len )
+{ return Bool_T( len == 0 || fread( t, sizeof( T ), len, fp ) == len ); }
+
+#endif
@@ -40,6 +40,9 @@
 #ifndef __STD_TMPL_H__
 #	include "std_tmpl.h"
 #endif
+#ifndef __RUN_STAT_H__
+#	include "run_stat.h"
+#endif
 
 
 
@@ -94,7 +97,8 @@ void q1cmte_( const Int_T n, Int_T l, Real_T *x, Real_T *y, Real_T *yb,
 	Int_T *istat, Real_T *pricnb, Real_T *pi, Real_T *q, Real_T *r, 
 	Real_T *z, Real_T *w, Real_T *col, Real_T *dpb, Int_T itmax, 
 	Int_T *istop, RD_SubproblemManager &SubMan, Int_T levprt, Real_T initpen, 
-	Real_T *ExpC, Real_T& ExpCost, Real_T *ExpC2, Real_T& ExpCost2)
+	Real_T *ExpC, Real_T& ExpCost, Real_T *ExpC2, Real_T& ExpCost2,
+	Int_T nkept, Real_T *gkept, Real_T *akept, Int_T *bkept )
 {
 	//Print("\nEntered Q1MTE - Upper Level Algorithm\n");
 	
@@ -274,16 +278,21 @@ void q1cmte_( const Int_T n, Int_T l, Real_T *x, Real_T *y, Real_T *yb,
 		for (i = InitScen+1; i < l; i++)
 			v[i] = 0.0;
 
-		for (i = InitScen+2; i<=l; i++)
+		for (i = InitScen+1; i<=l; i++)
 			dpb[i] = 0.0;
+
+		//the first stage objective block moves from InitScen+1 to l; so do
+		//all of its cuts in the committee (not only the basic one)
+		for (j = 1; j <= mg; j++)
+			if (iblock[j] == InitScen+1) iblock[j] = l;
 		
 
 		//---------------------------------------------------------------------------------
 		// Solve the new scenario(s) at the current point(=optimal point of the prev. solve)
 		// and get the new cut, add to the committee of cuts
 		//---------------------------------------------------------------------------------
-		SubMan.ChangePreviousBlockNumber(0);
-		SubMan.ReSizeSolverState(l-1, InitScen);
+		//(the subproblem manager already knows of the new scenarios, see
+		//MasterSolver::AddScenarios)
 
 		for (i = InitScen+1; i < l; i++)
 		{
@@ -320,8 +329,13 @@ void q1cmte_( const Int_T n, Int_T l, Real_T *x, Real_T *y, Real_T *yb,
 			}
 
 			mg++;
+			RunStat.Count( RunStatistics::CNT_CUTS_ADDED );
 		}  //end of SolveBlocks loop w/ i. 
 
+		//finish the sweep with the first stage objective (into the free slot
+		//mg+1), so that the next sweep recomputes T*y, as after SolveBlocks
+		SubMan.SolveSubproblem(l, n, y+1, value, g+((mg+1)*n +1));
+
 
 		//adjust ibasic
 		j = ibasic[InitScen+1];    //location of obj cut in G
@@ -393,8 +407,8 @@ void q1cmte_( const Int_T n, Int_T l, Real_T *x, Real_T *y, Real_T *yb,
 
 	//@BEGIN--------------------------------------------------
 	//This is to ensure that when only calculating xhat obj
-	//values, v does not change
-	if ( *istop != 10 ){
+	//values (of either point), v does not change
+	if ( *istop != 10 && *istop != 11 ){
 		dzero_( l, v+1 );
 	}
 	//@END----------------------------------------------------
@@ -459,12 +473,15 @@ void q1cmte_( const Int_T n, Int_T l, Real_T *x, Real_T *y, Real_T *yb,
 			if( levprt > 0 ) Print( "ITERATION LIMIT.\n" );
 			return;
 		}
+		RunStat.Count( RunStatistics::CNT_RD_ITER );
 
 //		Print("Entering SolveBlocks\n");
 
+		RunStat.Start( RunStatistics::PH_SUBPROBLEMS );
 		SolveBlocks( f1, f2, fx, mg, l, n, y, value, g, weight, ifeas2, iphase,
 			iblock, icheck, tolcut, a, ieq, inew, jnew, gmax, g_dim1, v, x,
 			SubMan, istop, ExpC, ExpCost, ExpC2, ExpCost2 );
+		RunStat.Stop( RunStatistics::PH_SUBPROBLEMS );
 
 		if( iphase == 1 )
 			funold = Max(funold,(Real_T) fx);
@@ -495,6 +512,15 @@ void q1cmte_( const Int_T n, Int_T l, Real_T *x, Real_T *y, Real_T *yb,
 		
 		
 	
+		//----------------------------------------------------------------------
+		//	ADD THE CUTS KEPT FROM THE PREVIOUS PROBLEM (ONCE, AFTER THE FIRST
+		//	POINT TURNED OUT TO BE FEASIBLE). THE NEW OBJECTIVE CUTS COME FIRST,
+		//	SO THEY BECOME BASIC AT THE COLD START.
+		//
+		if( iter == 1 && iphase == 2 && nkept > 0 )
+			AddKeptCuts( mg, n, nkept, gkept, akept, bkept, g, a, iblock,
+				icheck, ieq, drow, g_dim1 );
+
 	//	CountCriticalScenarios( l, m, nfix, iblock, inonba );
 
 		if( levprt >= 3 )
@@ -520,11 +546,14 @@ void q1cmte_( const Int_T n, Int_T l, Real_T *x, Real_T *y, Real_T *yb,
 
 //		Print("Entering SolveMaster\n");
 //		Print("\nPENALTY : %10g\n", penlty);
+		RunStat.Start( RunStatistics::PH_MASTER );
 		q2mstr_( n, &nfix, &m, &mg, &l, g+g_offset, a+1, xmin+1, xmax+1, x+1,
 			y+1, yb+1, v+1, weight+1, &penlty, &newpen, iblock+1, ibasic+1,
 			inonba+1, icheck+1, ieq+1, irn+1, istat+1, q+1, r+1, z+1, w+1,
 			pricnb+1, pricba+1, pi+1, col+1, dpb+1, &index, &gmax, &inew,
 			&jnew, &iterq, &initpen, tolcut );
+		RunStat.Stop( RunStatistics::PH_MASTER );
+		RunStat.Count( RunStatistics::CNT_MASTER_QP );
 
 		//if(flag){
 		//	Print("\nv's after exiting from Solve Master:\n"); 
@@ -609,11 +638,14 @@ void q1cmte_( const Int_T n, Int_T l, Real_T *x, Real_T *y, Real_T *yb,
 
 						//solve master
 //						Print("\nSolve Master\n");
+						RunStat.Start( RunStatistics::PH_MASTER );
 						q2mstr_( n, &nfix, &m, &mg, &l, g+g_offset, a+1, xmin+1, xmax+1, x+1,
 								y+1, yb+1, v+1, weight+1, &penlty, &newpen, iblock+1, ibasic+1,
 								inonba+1, icheck+1, ieq+1, irn+1, istat+1, q+1, r+1, z+1, w+1,
 								pricnb+1, pricba+1, pi+1, col+1, dpb+1, &index, &gmax, &inew,
 								&jnew, &iterq, &initpen, tolcut );
+						RunStat.Stop( RunStatistics::PH_MASTER );
+						RunStat.Count( RunStatistics::CNT_MASTER_QP );
 
 						//NOTE: Here, tolcut changes, if there are rounding inaccuracies. 
 						//So, it affect the checks after Checkbounds and constraints. 
@@ -997,6 +1029,12 @@ void SolveBlocks( Real_T &f1, Real_T &f2, Real_T &fx, Int_T &mg, Int_T l, // )
 	{
 		Real_T gi;
 
+		//	A block of zero weight (a scenario left out of a jackknife
+		//	subsample, see "main.cpp") adds nothing to f1, f2 and fx. Phase
+		//	1 needs a cut per block, but in phase 2 it is not solved again.
+		//
+		if( iphase == 2 && weight[i] == 0.0 ) continue;
+
 		if( !SubMan.SolveSubproblem( i, n, y+1, value, g+(mg*g_dim1+1) ) )
 		{
 			//	INDUCED CONSTRAINT.
@@ -1044,6 +1082,7 @@ void SolveBlocks( Real_T &f1, Real_T &f2, Real_T &fx, Int_T &mg, Int_T l, // )
 		ieq[mg]	= 0;
 		fx		+= weight[i] * ( a[mg] + ddot_( n, g+(mg*g_dim1+1), x+1 ) );
 		++mg;
+		RunStat.Count( RunStatistics::CNT_CUTS_ADDED );
 
 
 		//@BEGIN--------------------------------------------------------------
@@ -1299,6 +1338,34 @@ void MakeStep( Int_T n, Real_T *x, Real_T *y, Real_T *yb, Real_T *pi, // )
 }
 
 
+/*--------------------------------------------------------------------------*/
+/*			 AddKeptCuts													*/
+/*  Purpose: TO APPEND THE CUTS KEPT FROM THE PREVIOUS PROBLEM TO THE		*/
+/*			 COMMITTEE. THEY ARE CHECKED LIKE ANY OTHER INACTIVE MEMBER.	*/
+/*																			*/
+/*  Called by:	Q1CMTE														*/
+/*  Subroutines Called: DCOPY												*/
+/*--------------------------------------------------------------------------*/
+
+
+void AddKeptCuts( Int_T &mg, Int_T n, Int_T nkept, Real_T *gkept, // )
+	Real_T *akept, Int_T *bkept, Real_T *g, Real_T *a, Int_T *iblock,
+	Int_T *icheck, Int_T *ieq, Int_T *drow, Int_T g_dim1 )
+{
+	for( Int_T k = 0; k < nkept; k++ )
+	{
+		++mg;
+		dcopy_( n, gkept + k * n, g + (mg*g_dim1+1) );
+		a[mg]		= akept[k];
+		iblock[mg]	= bkept[k];
+		icheck[mg]	= 1;
+		ieq[mg]		= 0;
+		drow[mg]	= 0;
+	}
+	RunStat.Count( RunStatistics::CNT_CUTS_ADDED, nkept );
+}
+
+
 /*--------------------------------------------------------------------------*/
 /*			 CompressCommittee												*/
 /*  Purpose: TO COMPRESS THE COMMITTEE BY DELETING INACTIVE MEMBERS.		*/
@@ -1327,5 +1394,6 @@ void CompressCommittee( Int_T &mg, Int_T n, Int_T l, Int_T m, Int_T nfix, // )
 		if( istat[i] == 1 )
 			istat[i] = 2;
 	Print("Compress Committee...\n"); 
+	RunStat.Count( RunStatistics::CNT_CUTS_REMOVED, mg - ( m + l ) );
 	mg = m + l;
 }
@@ -91,6 +91,10 @@ void CountCriticalScenarios( Int_T l, Int_T m, Int_T nfix, Int_T *iblock, // )
 void MakeStep( Int_T n, Real_T *x, Real_T *y, Real_T *yb, Real_T *pi,
 	Real_T &funold, Real_T fun, Int_T &index );
 
+void AddKeptCuts( Int_T &mg, Int_T n, Int_T nkept, Real_T *gkept, // )
+	Real_T *akept, Int_T *bkept, Real_T *g, Real_T *a, Int_T *iblock,
+	Int_T *icheck, Int_T *ieq, Int_T *drow, Int_T g_dim1 );
+
 void CompressCommittee( Int_T &mg, Int_T n, Int_T l, Int_T m, Int_T nfix, // )
 	Int_T *istat, Int_T *inonba, Int_T *icheck, Int_T *ieq, Int_T *status,
 	Int_T *drow, Real_T *g, Real_T *a, Int_T *iblock, Int_T *ibasic,
@@ -47,7 +47,8 @@ void q1cmte_( const Int_T n, Int_T l, Real_T *x, Real_T *y, Real_T *yb,
 	Int_T *istat, Real_T *pricnb, Real_T *pi, Real_T *q, Real_T *r, 
 	Real_T *z, Real_T *w, Real_T *col, Real_T *dpb, Int_T itmax, 
 	Int_T *istop, RD_SubproblemManager &SubMan, Int_T levprt, Real_T initpen,
-	Real_T *ExpC, Real_T& ExpCost, Real_T *ExpC2, Real_T& ExpCost2);
+	Real_T *ExpC, Real_T& ExpCost, Real_T *ExpC2, Real_T& ExpCost2,
+	Int_T nkept, Real_T *gkept, Real_T *akept, Int_T *bkept );
 
 
 //@BEGIN-----------------------------------------------------------------------
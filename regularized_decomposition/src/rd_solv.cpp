@@ -123,7 +123,11 @@ void RD_SubproblemSolver::GetFeasibilityCut( Real_T &value, Real_T *grad, // )
 #endif
 		for( Int_T j = Int_T( LP.GetStructN() + LP.GetSlackN() ); j < N; j++ )
 			value += fabs( x[j] );
-		CalculateGradient( grad, n, y_t, Scen );
+
+		WorkVector<Real_T> pi( LP.GetStage2Rows() );
+
+		ExpandMultipliers( y_t, pi, 1.0 );
+		CalculateGradient( grad, n, pi, Scen );
 	}
 	else
 	{
@@ -131,13 +135,14 @@ void RD_SubproblemSolver::GetFeasibilityCut( Real_T &value, Real_T *grad, // )
 		//	Extract the appropriate row of the basis inverse into "pi" vector.
 		//	Use "mark" work vector as a work space for sparsity pattern.
 		//
-		WorkVector<Real_T> pi( M );
+		WorkVector<Real_T> rho( M ), pi( LP.GetStage2Rows() );
 		WorkVector<Int_T> mark( M );
 
-		pi.Fill( 0.0, M );	mark.Fill( 0, M );
-		pi[ infrow ] = 1.0;	mark[ infrow ] = 1;
-		B->SparseBTRAN( pi, mark );
+		rho.Fill( 0.0, M );	mark.Fill( 0, M );
+		rho[ infrow ] = 1.0;	mark[ infrow ] = 1;
+		B->SparseBTRAN( rho, mark );
 
+		ExpandMultipliers( rho, pi, 1.0 );
 		CalculateGradient( grad, n, pi, Scen );
 	}
 }
@@ -173,20 +178,18 @@ const
 	}
 
 	//--------------------------------------------------------------------------
-	//	Then calculate the scenario-dependent part.
+	//	Then calculate the scenario-dependent part (only the technology matrix
+	//	entries of the scenario are needed).
 	//
-	Int_T l = Scen.GetLength();
-	for( j = 0; j < l; j++ )
-		for( Int_T i = 0, bl = Scen[j].Len(); i < bl; i++ )
-		{
-			const Delta &d = Scen[j][i];
+	const Int_T *srow, *scol;
+	const Real_T *sval;
 
-			if( d.type == Delta::MATRIX )
-			{
-				assert( d.col >= 0 && d.col < n );
-				grad[ d.col ] -= pi[ d.row ] * d.value;
-			}
-		}
+	for( Scen.GetMatrix( srow, scol, sval, len ); len;
+		--len, ++srow, ++scol, ++sval )
+	{
+		assert( *scol >= 0 && *scol < n );
+		grad[ *scol ] -= pi[ *srow ] * *sval;
+	}
 }
 
 
@@ -203,11 +206,54 @@ void RD_SubproblemSolver::GetOptimalityCut( Real_T &value, Real_T *grad, // )
 	//		Transp( T_omega )	is technology matrix transpose and
 	//		pi_opt				is the vector of optimal dual variables.
 	//
-	CalculateGradient( grad, n, y, Scen );
+	//	The dual variables and the objective value are first brought back to
+	//	the original scale and (if the LP was presolved) to the original second
+	//	stage rows.
+	//
+	WorkVector<Real_T> pi( LP.GetStage2Rows() );
+
+	ExpandMultipliers( y, pi, LP.GetObjFactor() );
+	CalculateGradient( grad, n, pi, Scen );
 
 	//--------------------------------------------------------------------------
 	//	Compute the duality gap - verify the objective value in this manner.
 	//
 	assert( DualityGap() < 1e-6 );
-	value = Result;
+	value = Result * LP.GetObjFactor() + LP.GetFixedAdjustment();
+}
+
+
+//
+//	Convert a vector of (scaled) simplex multipliers of the (reduced)
+//	subproblem LP to the multipliers of the original unscaled subproblem:
+//		dst[i] = mult * RowFactor[r] * src[r],	r = RowMap[i] >= 0
+//		dst[i] = 0,								otherwise
+//	where
+//		mult				is the objective unscaling factor for dual variables
+//							and 1.0 for rows of basis inverse (the feasibility
+//							cuts are expressed in the scaled infeasibility),
+//		RowFactor			are the row scaling factors of the subproblem (1.0
+//							if it is not scaled),
+//		RowMap				maps the original rows to the rows left by presolve
+//							(rows removed by presolve have no non-zeros in the
+//							technology matrix).
+//	"dst" has the length of the original number of second stage rows.
+//
+void RD_SubproblemSolver::ExpandMultipliers( const Array<Real_T> &src, // )
+	Array<Real_T> &dst, Real_T mult )
+const
+{
+	Bool_T Scaled = LP.IsScaled();
+
+	for( Int_T i = 0, m2 = LP.GetStage2Rows(); i < m2; i++ )
+	{
+		Int_T r = LP.GetReducedRow( i );
+
+		if( r < 0 )
+			dst[i] = 0.0;
+		else if( Scaled )
+			dst[i] = mult * LP.GetRowFactor( r ) * src[r];
+		else
+			dst[i] = mult * src[r];
+	}
 }
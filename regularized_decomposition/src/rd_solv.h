@@ -64,6 +64,8 @@ public:
 private:
 	void CalculateGradient( Real_T *grad, Int_T n, Array<Real_T> &pi,
 		const Scenario &Scen ) const;
+	void ExpandMultipliers( const Array<Real_T> &src, Array<Real_T> &dst,
+		Real_T mult ) const;
 };
 
 
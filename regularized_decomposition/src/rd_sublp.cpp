@@ -14,8 +14,9 @@ SOURCE FILE NAME:	rd_sublp.cpp
 CREATED:			1995.07.27
 LAST MODIFIED:		1996.04.05
 
-DEPENDENCIES:		rd_sublp.h, smplx_lp.h, solv_lp.h, mps_lp.h, scenario.h
-					<assert.h>
+DEPENDENCIES:		rd_sublp.h, smplx_lp.h, solv_lp.h, mps_lp.h, scenario.h,
+					presolve.h, postsolv.h
+					<assert.h>, <math.h>
 
 --------------------------------------------------------------------------------
 
@@ -24,13 +25,140 @@ SOURCE FILE CONTENTS:
 
 ------------------------------------------------------------------------------*/
 
+#include <math.h>
+
 #ifndef __RD_SUBLP_H__
 #	include "rd_sublp.h"
 #endif
 #ifndef __PRINT_H__
 #	include "print.h"
 #endif
+#ifndef __PRESOLVE_H__
+#	include "presolve.h"
+#endif
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T RD_SubproblemLP::PresolveRD_Subproblem( const Scenarios &Scen,
+		VerbLevel Verbosity )
+
+PURPOSE:
+	Presolves the second stage LP once for all scenarios. Only the reductions
+which remain valid for every realization of the random data are performed:
+the rows with a random right hand side (i.e. the rows with random data or with
+non-zeros in the technology matrix) and the columns with a random cost are
+protected from all the reductions that depend on their data (see
+"Presolver::ProtectRowsAndColumns()"). Numerical eliminations and dominated
+column removal are never used.
+	Since the removed rows have no non-zeros in the technology matrix, their
+dual variables are not needed to compute the cuts. The presolve actions are
+kept in a postsolve object.
+	Has to be called after the scenario indice were renumbered and before the
+LP is scaled and converted to standard form.
+
+PARAMETERS:
+	const Scenarios &Scen
+		Scenario repository (the distributions are scanned for random data).
+
+	VerbLevel Verbosity
+		Presolver verbosity.
+
+RETURN VALUE:
+	"False" if the second stage problem was found infeasible or unbounded
+(regardless of the scenario), "True" otherwise.
+
+SIDE EFFECTS:
+	The LP is reduced.
+
+------------------------------------------------------------------------------*/
+
+Bool_T RD_SubproblemLP::PresolveRD_Subproblem( const Scenarios &Scen, // )
+	VerbLevel Verbosity )
+{
+	assert( State == UNINIT && !Presolved && !Scaled );
+
+	n1st	= T_base.GetN();
+	m2st	= T_base.GetM();
+	n2st	= n;
+
+	assert( m2st == m );
+
+	//--------------------------------------------------------------------------
+	//	Mark the rows and columns with random data. Rows with deterministic
+	//	technology matrix non-zeros are marked as well, since their right hand
+	//	side changes with the trial point.
+	//
+	Array<Bool_T> RandRows( m2st, False ), RandCols( n2st, False );
+
+	Scen.MarkRandomData( RandRows, m2st, RandCols, n2st );
+
+	Ptr<Real_T> a;
+	Ptr<Int_T> row;
+	Int_T i, j, len;
+
+	for( j = 0; j < n1st; j++ )
+		for( T_base.GetColumn( j, a, row, len ); len; --len, ++row )
+			RandRows[ *row ] = True;
+
+	//--------------------------------------------------------------------------
+	//	Presolve and store the row and column maps.
+	//
+	UpdateRowStructure();
+
+	PostSolve = new Postsolver;
+	if( PostSolve == NULL ) FatalError( "Out of memory." );
+
+	Presolver Pre( *this, PostSolve );
+
+	Pre.ProtectRowsAndColumns( &RandRows, &RandCols );
+	Pre.Presolve( LPR_SCENARIO_SAFE, Verbosity );
+
+	if( Pre.ProblemStatus() == LPS_INFEASIBLE ||
+		Pre.ProblemStatus() == LPS_UNBOUNDED )
+		return False;
+
+	RowMap.Resize( m2st );
+	ColMap.Resize( n2st );
+
+	Int_T k;
+	for( i = 0, k = 0; i < m2st; i++ )
+		RowMap[i] = Pre.IsRowExcluded( i ) ? -1 : k++;
+	assert( k == m );
+
+	for( j = 0, k = 0; j < n2st; j++ )
+		ColMap[j] = Pre.IsColExcluded( j ) ? -1 : k++;
+	assert( k == n );
+
+	FixedAdj	= Pre.GetFixedAdjustment();
+	Presolved	= True;
+
+	Pre.ReleaseWorkMemory();
+
+	return True;
+}
+
+
+/*------------------------------------------------------------------------------
 
+	void RD_SubproblemLP::InitializeRD_Subproblem( void )
+
+PURPOSE:
+	Stores the base right hand side and cost (in the original second stage
+indexing and scale), creates identity row and column maps if the LP was not
+presolved and computes the scaling factors if the LP was scaled. Has to be
+called after the conversion to standard form.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
 
 void RD_SubproblemLP::InitializeRD_Subproblem( void )
 {
@@ -39,14 +167,59 @@ void RD_SubproblemLP::InitializeRD_Subproblem( void )
 		n1st	= T_base.GetN();
 		m2st	= T_base.GetM();
 
-		assert( m2st == m );
+		Int_T i, j;
+
+		if( !Presolved )
+		{
+			assert( m2st == m );
+
+			n2st = n;
 
-		d_base.Resize( m2st );		d_base.Copy( b, m2st, m2st );
-		q_base.Resize( n );			q_base.Copy( c, n, n );
+			RowMap.Resize( m2st );
+			ColMap.Resize( n2st );
+			for( i = 0; i < m2st; i++ ) RowMap[i] = i;
+			for( j = 0; j < n2st; j++ ) ColMap[j] = j;
+		}
+
+		d_base.Resize( m2st );		d_base.Fill( 0.0, m2st );
+		q_base.Resize( n2st );		q_base.Fill( 0.0, n2st );
 		h.Resize( m2st );			h.Fill( 0.0, m2st );
-		q.Resize( n );				q.Fill( 0.0, n );
+		q.Resize( n2st );			q.Fill( 0.0, n2st );
+		h_red.Resize( m );			h_red.Fill( 0.0, m );
 		T_base_y.Resize( m2st );	T_base_y.Fill( 0.0, m2st );
 
+		//----------------------------------------------------------------------
+		//	If the LP was scaled, compute the scaling factors once. The base
+		//	right hand side and cost are kept unscaled, so that the scenario
+		//	data (which is unscaled) may be applied to them directly.
+		//
+		if( Scaled )
+		{
+			RowFactor.Resize( m );
+			ColFactor.Resize( n );
+
+			for( i = 0; i < m; i++ )
+				RowFactor[i] = ldexp( 1.0, -( ScaleRow[i] + RHS_Scale ) );
+
+			for( j = 0; j < n; j++ )
+				ColFactor[j] = ldexp( 1.0, -( ScaleCol[j] + CostScale ) );
+
+			ObjFactor = ldexp( 1.0, CostScale + RHS_Scale );
+		}
+
+		//----------------------------------------------------------------------
+		//	Store the base right hand side and cost in the original indexing.
+		//
+		for( i = 0; i < m2st; i++ )
+			if( RowMap[i] >= 0 )
+				d_base[i] = Scaled ? b[ RowMap[i] ] / RowFactor[ RowMap[i] ] :
+					b[ RowMap[i] ];
+
+		for( j = 0; j < n2st; j++ )
+			if( ColMap[j] >= 0 )
+				q_base[j] = Scaled ? c[ ColMap[j] ] / ColFactor[ ColMap[j] ] :
+					c[ ColMap[j] ];
+
 		State = INIT;
 	}
 }
@@ -99,46 +272,35 @@ void RD_SubproblemLP::ApplyScenario( const Scenario &Sc,  // )
 	//	3.	if( y changed )
 	//			T_base_y <- T_base * y
 	//	4.	h -= T_base_y
+	//	5.	h_red <- RowFactor * h; c <- ColFactor * q
+	//		(restricted to the rows and columns which were not removed by
+	//		presolve; factors equal 1 if the LP is not scaled)
 	//
-	//	Step 2 is performed as one because Delta_d, Delta_T and Delta_q are
-	//	stored together on the same list corresponding to one scenario.
+	//	Step 2 takes Delta_d, Delta_T and Delta_q from the flattened form of
+	//	the scenario, where each of them is stored separately.
 	//
 	h.Copy( d_base, m2st, m2st );
-	q.Copy( q_base, n, n );
+	q.Copy( q_base, n2st, n2st );
 
 	//
 	//	Now add the scenario-specific modifications.
 	//
-	for( Int_T l = Sc.GetLength(), j = 0; j < l; j++ )
-	{
-		for( Int_T i = 0, bl = Sc[j].Len(); i < bl; i++ )
-		{
-			const Delta &d = Sc[j][i];
+	const Int_T *ind, *col;
+	const Real_T *val;
+	Int_T len;
 
-			switch( d.type )
-			{
-			case Delta::RHS:
-				h[d.row] += d.value;
-				break;
+	for( Sc.GetRHS( ind, val, len ); len; --len, ++ind, ++val )
+		h[*ind] += *val;
 
-			case Delta::MATRIX:
-				assert( d.col >= 0 && d.col <= nn );
-				h[d.row] -= d.value * TrialPoint[d.col];
-				break;
-
-			case Delta::COST:
-				q[d.col] = d.value;
-				break;
-
-			default:
-#ifndef NDEBUG
-				abort();
-#endif
-				break;
-			}
-		}
+	for( Sc.GetMatrix( ind, col, val, len ); len; --len, ++ind, ++col, ++val )
+	{
+		assert( *col >= 0 && *col < nn );
+		h[*ind] -= *val * TrialPoint[*col];
 	}
 
+	for( Sc.GetCost( col, val, len ); len; --len, ++col, ++val )
+		q[*col] = *val;
+
 	//--------------------------------------------------------------------------
 	//	Check if 'TrialPoint' has changed. If so - recompute 'T_base_y'.
 	//
@@ -159,8 +321,25 @@ void RD_SubproblemLP::ApplyScenario( const Scenario &Sc,  // )
 		h[i] -= T_base_y[i];
 
 	//--------------------------------------------------------------------------
-	//	Replace the right hand side and cost of the LP with computed ones.
+	//	Replace the right hand side and cost of the (reduced) LP with computed
+	//	ones. If the LP is scaled, bring them to the scale of the constraint
+	//	matrix.
 	//
-	SetRHS( h );
-	c.Copy( q, n, n );
+	for( Int_T i = 0; i < m2st; i++ )
+	{
+		Int_T r = RowMap[i];
+
+		if( r >= 0 )
+			h_red[r] = Scaled ? h[i] * RowFactor[r] : h[i];
+	}
+
+	for( Int_T j = 0; j < n2st; j++ )
+	{
+		Int_T k = ColMap[j];
+
+		if( k >= 0 )
+			c[k] = Scaled ? q[j] * ColFactor[k] : q[j];
+	}
+
+	SetRHS( h_red );
 }
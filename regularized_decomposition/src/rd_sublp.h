@@ -13,7 +13,7 @@ HEADER FILE NAME:	rd_sublp.h
 CREATED:			1995.07.27
 LAST MODIFIED:		1996.02.13
 
-DEPENDENCIES:		smplx_lp.h, scenario.h
+DEPENDENCIES:		smplx_lp.h, scenario.h, postsolv.h
 
 --------------------------------------------------------------------------------
 
@@ -30,6 +30,9 @@ HEADER CONTENTS:
 #ifndef __SCENARIO_H__
 #	include "scenario.h"
 #endif
+#ifndef __POSTSOLV_H__
+#	include "postsolv.h"
+#endif
 
 //==============================================================================
 //
@@ -55,7 +58,22 @@ private:
 		q_base;					// side/cost vectors for all scenarios.
 
 	Int_T n1st,					// Number of first stage variables.
-		m2st;					// Number of second stage constraints.
+		m2st,					// Number of second stage constraints.
+		n2st;					// Number of second stage variables.
+
+	//--------------------------------------------------------------------------
+	//	Reduction of the LP by a (scenario-safe) presolve. The scenario data,
+	//	the technology matrix and the base right hand side and cost are all
+	//	indexed as in the original (not presolved) second stage LP. The maps
+	//	translate the original indice into the indice of the reduced LP (-1
+	//	denotes a removed row or column). Without presolve the maps are
+	//	identities.
+	//
+	Array<Int_T> RowMap,		// Row and column maps (original -> reduced).
+		ColMap;
+	Bool_T Presolved;			// "True" if the LP was reduced by presolve.
+	Real_T FixedAdj;			// Presolve fixed adjustment to the objective.
+	Postsolver *PostSolve;		// Record of the presolve actions.
 
 	//--------------------------------------------------------------------------
 	//	Work vectors needed to solve the subproblems.
@@ -63,17 +81,37 @@ private:
 	Array<Real_T> T_base_y,		// Work vector; calculated once per each scan
 								// of scenarios; equals T_base * y.
 
-		h, q;					// Work vectors; calculated anew each time
+		h, q,					// Work vectors; calculated anew each time
 								// subproblem solution is requested; holds the
 								// current right hand side and cost vector.
+		h_red;					// Right hand side of the reduced LP.
+
+	//--------------------------------------------------------------------------
+	//	Scaling factors (only used when the LP was scaled by "ScaleLP()" before
+	//	conversion to standard form). All factors are integer powers of two,
+	//	so that multiplication by them is exact.
+	//
+	Array<Real_T> RowFactor,	// Multipliers taking the unscaled right hand
+		ColFactor;				// side / cost into the scaled LP.
+	Real_T ObjFactor;			// Multiplier taking the scaled objective value
+								// back to the unscaled one.
 
 public:
 	RD_SubproblemLP( const MPS_LP &T );
 	virtual ~RD_SubproblemLP( void );
 
+	Bool_T PresolveRD_Subproblem( const Scenarios &Scen, VerbLevel Verbosity );
 	void InitializeRD_Subproblem( void );
 	void ApplyScenario( const Scenario &Sc, Bool_T NewTrialPoint, Int_T nn,
 		const Real_T *TrialPoint );
+
+	Bool_T IsScaled( void ) const;
+	Real_T GetRowFactor( Int_T i ) const;
+	Real_T GetObjFactor( void ) const;
+
+	Int_T GetStage2Rows( void ) const;
+	Int_T GetReducedRow( Int_T i ) const;
+	Real_T GetFixedAdjustment( void ) const;
 };
 
 
@@ -87,12 +125,57 @@ public:
 inline
 RD_SubproblemLP::RD_SubproblemLP( const MPS_LP &T )
 	: SimplexLP(), T_base( T ), State( UNINIT ), d_base( b ),
-	n1st( T.GetN() ), m2st( T.GetM() ),
-	T_base_y( T.GetM(), 0.0 ), h( T.GetM(), 0.0 )
+	n1st( T.GetN() ), m2st( T.GetM() ), n2st( 0 ),
+	Presolved( False ), FixedAdj( 0.0 ), PostSolve( NULL ),
+	T_base_y( T.GetM(), 0.0 ), h( T.GetM(), 0.0 ), ObjFactor( 1.0 )
 {}
 
 inline
 RD_SubproblemLP::~RD_SubproblemLP( void )
-{}
+{
+	if( PostSolve ) delete PostSolve;
+}
+
+
+inline
+Bool_T RD_SubproblemLP::IsScaled( void )
+const
+{ return Scaled; }
+
+
+inline
+Real_T RD_SubproblemLP::GetRowFactor( Int_T i )
+const
+{
+	assert( Scaled && i >= 0 && i < m );
+	return RowFactor[i];
+}
+
+
+inline
+Real_T RD_SubproblemLP::GetObjFactor( void )
+const
+{ return ObjFactor; }
+
+
+inline
+Int_T RD_SubproblemLP::GetStage2Rows( void )
+const
+{ return m2st; }
+
+
+inline
+Int_T RD_SubproblemLP::GetReducedRow( Int_T i )
+const
+{
+	assert( State == INIT && i >= 0 && i < m2st );
+	return RowMap[i];
+}
+
+
+inline
+Real_T RD_SubproblemLP::GetFixedAdjustment( void )
+const
+{ return FixedAdj; }
 
 #endif
@@ -93,7 +93,7 @@ Bool_T Postsolver::ReadActions( FILE *fp )
 	//
 	FreeMemory();
 
-	Lexer::SetInputStream( "action file", fp );
+	Lex.SetInputStream( "action file", fp );
 	ResetErrorCount();
 	MaxErrCount( 20 );
 
@@ -102,17 +102,17 @@ Bool_T Postsolver::ReadActions( FILE *fp )
 	//--------------------------------------------------------------------------
 	//	Read the first line.
 	//
-	if( !Lexer::GetKeyword( "PRESOLVER" ) || !Lexer::GetSpace() ||
-		!Lexer::GetKeyword( "REPORT" ) )
+	if( !Lex.GetKeyword( "PRESOLVER" ) || !Lex.GetSpace() ||
+		!Lex.GetKeyword( "REPORT" ) )
 	{
 		Error( "Title line incorrect or missing." );
 		goto error;
 	}
 
-	if( !Lexer::GetNewline() )
+	if( !Lex.GetNewline() )
 	{
 		Error( "Extra input after the title line ignored." );
-		Lexer::GetNewline( True );
+		Lex.GetNewline( True );
 	}
 
 	//--------------------------------------------------------------------------
@@ -138,7 +138,7 @@ Bool_T Postsolver::ReadActions( FILE *fp )
 		goto error;
 	}
 
-	if( !Lexer::GetKeyword( "ENDATA" ) )
+	if( !Lex.GetKeyword( "ENDATA" ) )
 	{
 		Error( "ENDATA expected." );
 		goto error;
@@ -187,24 +187,24 @@ Bool_T Postsolver::GetRowsSection( void )
 	//	Read the indicator line for the section and store the number of row
 	//	labels.
 	//
-	if( !Lexer::GetKeyword( "ROWS" ) )
+	if( !Lex.GetKeyword( "ROWS" ) )
 	{
 		Error( "ROWS section header missing." );
 		return False;
 	}
 
-	if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex.GetSpace() || !Lex.GetNumeric() )
 	{
 		Error( "Number of row labels missing." );
 		return False;
 	}
 
-	m = (Int_T) Lexer::Number;
+	m = (Int_T) Lex.Number;
 
-	if( !Lexer::GetNewline() )
+	if( !Lex.GetNewline() )
 	{
 		Error( "Extra input after the number of row labels ignored." );
-		Lexer::GetNewline( True );
+		Lex.GetNewline( True );
 	}
 
 	if( m <= 0 )
@@ -228,24 +228,24 @@ Bool_T Postsolver::GetColumnsSection( void )
 	//	Read the indicator line for the section and store the number of column
 	//	labels.
 	//
-	if( !Lexer::GetKeyword( "COLUMNS" ) )
+	if( !Lex.GetKeyword( "COLUMNS" ) )
 	{
 		Error( "COLUMNS section header missing." );
 		return False;
 	}
 
-	if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex.GetSpace() || !Lex.GetNumeric() )
 	{
 		Error( "Number of column labels missing." );
 		return False;
 	}
 
-	n = (Int_T) Lexer::Number;
+	n = (Int_T) Lex.Number;
 
-	if( !Lexer::GetNewline() )
+	if( !Lex.GetNewline() )
 	{
 		Error( "Extra input after the number of column labels ignored." );
-		Lexer::GetNewline( True );
+		Lex.GetNewline( True );
 	}
 
 	if( n <= 0 )
@@ -268,11 +268,11 @@ Bool_T Postsolver::GetColumnsSection( void )
 Bool_T Postsolver::GetExclusionSection( Array<Bool_T> &Exclude, Int_T k, // )
 	const char *Section )
 {
-	for( Int_T cnt = 0; Lexer::GetSpace(); cnt++ )
+	for( Int_T cnt = 0; Lex.GetSpace(); cnt++ )
 	{
-		Lexer::GetNumeric();
+		Lex.GetNumeric();
 
-		Int_T num = (Int_T)Lexer::Number;
+		Int_T num = (Int_T)Lex.Number;
 
 		if( num < 0 || num >= k )
 		{
@@ -287,7 +287,7 @@ Bool_T Postsolver::GetExclusionSection( Array<Bool_T> &Exclude, Int_T k, // )
 		}
 
 		Exclude[num] = True;
-		Lexer::GetNewline( True );
+		Lex.GetNewline( True );
 	}
 
 	return True;
@@ -314,19 +314,19 @@ SIDE EFFECTS:
 
 Bool_T Postsolver::GetAdjustment( void )
 {
-	if( !Lexer::GetKeyword( "ADJUST" ) ) return False;
-	Lexer::GetNewline( True );
+	if( !Lex.GetKeyword( "ADJUST" ) ) return False;
+	Lex.GetNewline( True );
 
-	if( !Lexer::GetSpace() || !Lexer::GetKeyword( "VALUE" ) ||
-		!Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex.GetSpace() || !Lex.GetKeyword( "VALUE" ) ||
+		!Lex.GetSpace() || !Lex.GetNumeric() )
 	{
 		Error( "Invalid fixed adjustment note." );
 		SkipToNextSection();
 		return False;
 	}
 
-	FixedAdjustment( Lexer::Number );
-	Lexer::GetNewline( True );
+	FixedAdjustment( Lex.Number );
+	Lex.GetNewline( True );
 
 	return True;
 }
@@ -356,19 +356,19 @@ Bool_T Postsolver::GetAction( Int_T &nn )
  	//--------------------------------------------------------------------------
  	//	See if this section actually defines an action.
  	//
-	if( !Lexer::GetKeyword( "ACTION" ) ) return False;
+	if( !Lex.GetKeyword( "ACTION" ) ) return False;
 
  	//--------------------------------------------------------------------------
  	//	Read in the variable label and see if it corresponds to a known label.
  	//
-	if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex.GetSpace() || !Lex.GetNumeric() )
 	{
 		Error( "Variable index missing in the action description line." );
 		SkipToNextSection();
 		return False;
 	}
 
-	Int_T var = (Int_T)Lexer::Number;
+	Int_T var = (Int_T)Lex.Number;
 
 	if( var >= n || var < 0 )
 	{
@@ -383,7 +383,7 @@ Bool_T Postsolver::GetAction( Int_T &nn )
 		return False;
 	}
 
-	Lexer::GetSpace();
+	Lex.GetSpace();
 
  	//--------------------------------------------------------------------------
  	//	Read in the section body.
@@ -421,21 +421,21 @@ SIDE EFFECTS:
 
 Bool_T Postsolver::GetFixAction( Int_T &nn, Int_T var )
 {
-	if( !Lexer::GetKeyword( "FIX" ) ) return False;
-	Lexer::GetNewline( True );
+	if( !Lex.GetKeyword( "FIX" ) ) return False;
+	Lex.GetNewline( True );
 
 	nn--;
 
-	if( !Lexer::GetSpace() || !Lexer::GetKeyword( "VALUE" ) ||
-		!Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex.GetSpace() || !Lex.GetKeyword( "VALUE" ) ||
+		!Lex.GetSpace() || !Lex.GetNumeric() )
 	{
 		Error( "Invalid line after ACTION FIX section header." );
 		return False;
 	}
 
-	Lexer::GetNewline( True );
+	Lex.GetNewline( True );
 
-	VariableFixing( var, Lexer::Number );
+	VariableFixing( var, Lex.Number );
 	return True;
 }
 
@@ -471,22 +471,22 @@ Bool_T Postsolver::GetRowData( Real_T &val, Int_T &len, // )
 	//--------------------------------------------------------------------------
 	//	Read the removed variable's coefficient in the row in question.
 	//
-	if( !Lexer::GetSpace() )
+	if( !Lex.GetSpace() )
 	{
 		Error( "Premature end of section." );
 		return False;
 	}
 
-	if( !Lexer::GetKeyword( "VALUE" ) || !Lexer::GetSpace() ||
-		!Lexer::GetNumeric() )
+	if( !Lex.GetKeyword( "VALUE" ) || !Lex.GetSpace() ||
+		!Lex.GetNumeric() )
 	{
 		Error( "Variable's coefficient expected." );
 		return False;
 	}
 
-	val = Lexer::Number;
+	val = Lex.Number;
 
-	Lexer::GetNewline( True );
+	Lex.GetNewline( True );
 
 	//--------------------------------------------------------------------------
 	//	Read the row's coefficients.
@@ -496,9 +496,9 @@ Bool_T Postsolver::GetRowData( Real_T &val, Int_T &len, // )
 		a.Resize( max_len);		a.Fill( 0.0, max_len );
 		ind.Resize( max_len );	ind.Fill( -1, max_len );
 
-		for( len = 0; Lexer::GetSpace(); len++ )
+		for( len = 0; Lex.GetSpace(); len++ )
 		{
-			if( !Lexer::GetKeyword( "COEFF" ) || !Lexer::GetSpace() )
+			if( !Lex.GetKeyword( "COEFF" ) || !Lex.GetSpace() )
 			{
 				Error( "Matrix coefficient expected." );
 				return False;
@@ -517,27 +517,27 @@ Bool_T Postsolver::GetRowData( Real_T &val, Int_T &len, // )
 				max_len = new_max_len;
 			}
 
-			if( !Lexer::GetNumeric() || !Lexer::GetSpace() )
+			if( !Lex.GetNumeric() || !Lex.GetSpace() )
 			{
 				Error( "Variable index expected." );
 				return False;
 			}
-			ind[len]	= (Int_T) Lexer::Number;
+			ind[len]	= (Int_T) Lex.Number;
 
-			if( !Lexer::GetNumeric() )
+			if( !Lex.GetNumeric() )
 			{
 				Error( "Matrix coefficient expected." );
 				return False;
 			}
 
-			a[len]		= Lexer::Number;
+			a[len]		= Lex.Number;
 
 			if( ind[len] < 0 || ind[len] >= n )
 			{
 				Error( "Variable index out of range: %d", ind[len] );
 				return False;
 			}
-			Lexer::GetNewline( True );
+			Lex.GetNewline( True );
 		}
 	}
 	
@@ -566,8 +566,8 @@ SIDE EFFECTS:
 
 Bool_T Postsolver::GetExplicitSlackAction( Int_T &nn, Int_T var )
 {
-	if( !Lexer::GetKeyword( "EXPL_SLACK" ) ) return False;
-	Lexer::GetNewline( True );
+	if( !Lex.GetKeyword( "EXPL_SLACK" ) ) return False;
+	Lex.GetNewline( True );
 
 	nn--;
 
@@ -582,19 +582,19 @@ Bool_T Postsolver::GetExplicitSlackAction( Int_T &nn, Int_T var )
 	//--------------------------------------------------------------------------
 	//	Read the row type and the row activity bounds.
 	//
-	if( !Lexer::GetSpace() )
+	if( !Lex.GetSpace() )
 	{
 		Error( "Premature end of the ACTION EXPL_SLACK section." );
 		return False;
 	}
 
-	if( Lexer::GetKeyword( "GE" ) )
+	if( Lex.GetKeyword( "GE" ) )
 		rt = VT_NORM;
-	else if( Lexer::GetKeyword( "LE" ) )
+	else if( Lex.GetKeyword( "LE" ) )
 		rt = VT_MI;
-	else if( Lexer::GetKeyword( "EQ" ) )
+	else if( Lex.GetKeyword( "EQ" ) )
 		rt = VT_FIXED;
-	else if( Lexer::GetKeyword( "RG" ) )
+	else if( Lex.GetKeyword( "RG" ) )
 		rt = VT_BOUNDED;
 	else
 	{
@@ -602,7 +602,7 @@ Bool_T Postsolver::GetExplicitSlackAction( Int_T &nn, Int_T var )
 		goto error;
 	}
 
-	if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex.GetSpace() || !Lex.GetNumeric() )
 	{
 		Error( "Numeric value(s) expected." );
 		goto error;
@@ -610,10 +610,10 @@ Bool_T Postsolver::GetExplicitSlackAction( Int_T &nn, Int_T var )
 
 	switch( rt )
 	{
-	case VT_NORM:		bl = Lexer::Number;			break;
-	case VT_MI:			bu = Lexer::Number;			break;
-	case VT_FIXED: 		bl = bu = Lexer::Number;	break;
-	case VT_BOUNDED:	bl = Lexer::Number;			break;
+	case VT_NORM:		bl = Lex.Number;			break;
+	case VT_MI:			bu = Lex.Number;			break;
+	case VT_FIXED: 		bl = bu = Lex.Number;	break;
+	case VT_BOUNDED:	bl = Lex.Number;			break;
 #ifndef NDEBUG
 	default:			abort();
 #endif
@@ -621,32 +621,32 @@ Bool_T Postsolver::GetExplicitSlackAction( Int_T &nn, Int_T var )
 
 	if( rt == RT_RNG )
 	{
-		if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+		if( !Lex.GetSpace() || !Lex.GetNumeric() )
 		{
 			Error( "Numeric value(s) expected." );
 			goto error;
 		}
-		bu = Lexer::Number;
+		bu = Lex.Number;
 	}
 
-	Lexer::GetNewline( True );
+	Lex.GetNewline( True );
 	
 	//--------------------------------------------------------------------------
 	//	Read the variable type and its simple bounds.
 	//
-	if( !Lexer::GetSpace() )
+	if( !Lex.GetSpace() )
 	{
 		Error( "Premature end of section." );
 		return False;
 	}
 
-	if( Lexer::GetKeyword( "FX" ) )
+	if( Lex.GetKeyword( "FX" ) )
 		vt = VT_FIXED;
-	else if( Lexer::GetKeyword( "UP" ) )
+	else if( Lex.GetKeyword( "UP" ) )
 		vt = VT_BOUNDED;
-	else if( Lexer::GetKeyword( "PL" ) )
+	else if( Lex.GetKeyword( "PL" ) )
 		vt = VT_NORM;
-	else if( Lexer::GetKeyword( "MI" ) )
+	else if( Lex.GetKeyword( "MI" ) )
 		vt = VT_MI;
 	else
 	{
@@ -654,7 +654,7 @@ Bool_T Postsolver::GetExplicitSlackAction( Int_T &nn, Int_T var )
 		goto error;
 	}
 
-	if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex.GetSpace() || !Lex.GetNumeric() )
 	{
 		Error( "Numeric value(s) expected." );
 		goto error;
@@ -662,10 +662,10 @@ Bool_T Postsolver::GetExplicitSlackAction( Int_T &nn, Int_T var )
 
 	switch( vt )
 	{
-	case VT_FIXED:		l = u = Lexer::Number;	break;
-	case VT_BOUNDED:	l = Lexer::Number;		break;
-	case VT_NORM:		l = Lexer::Number;		break;
-	case VT_MI:			u = Lexer::Number;		break;
+	case VT_FIXED:		l = u = Lex.Number;	break;
+	case VT_BOUNDED:	l = Lex.Number;		break;
+	case VT_NORM:		l = Lex.Number;		break;
+	case VT_MI:			u = Lex.Number;		break;
 #ifndef NDEBUG
 	default:			abort();
 #endif
@@ -673,15 +673,15 @@ Bool_T Postsolver::GetExplicitSlackAction( Int_T &nn, Int_T var )
 
 	if( vt == VT_BOUNDED )
 	{
-		if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+		if( !Lex.GetSpace() || !Lex.GetNumeric() )
 		{
 			Error( "Numeric value(s) expected." );
 			goto error;
 		}
-		u = Lexer::Number;
+		u = Lex.Number;
 	}
 
-	Lexer::GetNewline( True );
+	Lex.GetNewline( True );
 
 	//--------------------------------------------------------------------------
 	//	Read the matrix row.
@@ -726,8 +726,8 @@ SIDE EFFECTS:
 
 Bool_T Postsolver::GetFreeSingletonAction( Int_T &nn, Int_T var )
 {
-	if( !Lexer::GetKeyword( "FREE_SINGL" ) ) return False;
-	Lexer::GetNewline( True );
+	if( !Lex.GetKeyword( "FREE_SINGL" ) ) return False;
+	Lex.GetNewline( True );
 
 	nn--;
 
@@ -738,25 +738,25 @@ Bool_T Postsolver::GetFreeSingletonAction( Int_T &nn, Int_T var )
 	//--------------------------------------------------------------------------
 	//	Read the optional optimal slack value.
 	//
-	if( !Lexer::GetSpace() )
+	if( !Lex.GetSpace() )
 	{
 		Error( "Premature end of the ACTION FREE_SINGL section." );
 		return False;
 	}
 
-	if( Lexer::GetKeyword( "SLACK" ) )
+	if( Lex.GetKeyword( "SLACK" ) )
 	{
-		if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+		if( !Lex.GetSpace() || !Lex.GetNumeric() )
 		{
 			Error( "SLACK value expected." );
 			goto error;
 		}
 
-		slOpt = Lexer::Number;
+		slOpt = Lex.Number;
 	
-		Lexer::GetNewline( True );
+		Lex.GetNewline( True );
 
-		if( !Lexer::GetSpace() )
+		if( !Lex.GetSpace() )
 		{
 			Error( "Premature end of the ACTION FREE_SINGL section." );
 			return False;
@@ -766,16 +766,16 @@ Bool_T Postsolver::GetFreeSingletonAction( Int_T &nn, Int_T var )
 	//--------------------------------------------------------------------------
 	//	Read the RHS value.
 	//
-	if( !Lexer::GetKeyword( "RHS" ) || !Lexer::GetSpace() ||
-		!Lexer::GetNumeric() )
+	if( !Lex.GetKeyword( "RHS" ) || !Lex.GetSpace() ||
+		!Lex.GetNumeric() )
 	{
 		Error( "RHS value expected." );
 		goto error;
 	}
 
-	b = Lexer::Number;
+	b = Lex.Number;
 
-	Lexer::GetNewline( True );
+	Lex.GetNewline( True );
 
 	//--------------------------------------------------------------------------
 	//	Read the matrix row.
@@ -824,6 +824,6 @@ void Postsolver::SkipToNextSection( void )
 {
 	do
 	{
-		Lexer::GetNewline( True );
-	} while( !Lexer::GetSpace() );
+		Lex.GetNewline( True );
+	} while( !Lex.GetSpace() );
 }
@@ -116,7 +116,8 @@ static VerbLevel StatVerbosity;
 PURPOSE:
 	This function recognizes one of three possible file types of the file read 
 from an open stream "LP_File". It then calls the "ReadMPS" file reading
-procedure which reads the rest of the data and stores it in MPS_LP object. If
+procedure which reads the rest of the data and stores it in MPS_LP object. A
+binary LP file (see "WriteLP_Bin()") is read by "ReadLP_Bin()" instead. If
 the file type is not recognized, procedure returns failure status (False). If
 more than 20 errors or more than 20 warnings are encountered, file processing
 is aborted with a call to "FatalError".
@@ -169,14 +170,29 @@ Bool_T MPS_LP::ReadLP( const char *FileName, FILE *LP_File, // )
 	MaxWarnCount( 20 );
 	MaxErrCount( 20 );
 
-	Lexer::SetInputStream( FileName, LP_File );
-	SetLP_TargetObject( this );
+	Lexer Lex;
 
 	if( Verbosity >= V_HIGH )
 		Print( "Reading input file: %s\n", FileName );
 
-	FF FileType = GetNameLine();
+	if( IsBinaryLP( LP_File ) )
+	{
+		if( Verbosity >= V_HIGH )
+			Print( "Binary LP file.\n" );
+		if( !ReadLP_Bin( LP_File ) )
+			goto error;
+
+		MaxWarnCount();
+		MaxErrCount();
+		goto success;
+	}
+
+	Lex.SetInputStream( FileName, LP_File );
+	SetLP_TargetObject( this, &Lex );
+
+	FF FileType;
 
+	FileType = GetNameLine();
 	switch( FileType )
 	{
 	case FF_FIXED_MPS:			// Fixed or free format MPS file.
@@ -198,7 +214,7 @@ Bool_T MPS_LP::ReadLP( const char *FileName, FILE *LP_File, // )
 	MaxWarnCount();
 	MaxErrCount();
 
-//success:
+success:
 	if( Verbosity >= V_LOW )
 	{
 		Print(
@@ -82,7 +82,9 @@ Bool_T ReadTimes( FILE *fp, MPS_LP &LP, Int_T &Stage1Row, // )
 	if( Verbosity >= V_HIGH )
 		Print( "\nReading the time file.\n" );
 
-	Lexer::SetInputStream( "Time file", fp );
+	Lexer Lex;
+
+	Lex.SetInputStream( "Time file", fp );
 
 	const unsigned NAME_LEN = 8;
 	typedef char Label[NAME_LEN+1];
@@ -97,18 +99,18 @@ Bool_T ReadTimes( FILE *fp, MPS_LP &LP, Int_T &Stage1Row, // )
 	//--------------------------------------------------------------------------
 	//	Read in the first line.
 	//
-	if( !Lexer::GetKeyword( "TIME" ) || !Lexer::GetSpace() ||
-		!Lexer::GetLabelFree( 0 ) )
+	if( !Lex.GetKeyword( "TIME" ) || !Lex.GetSpace() ||
+		!Lex.GetLabelFree( 0 ) )
 	{
 		Error( "Error reading the first line." );
 		goto error;
 	}
-	strncpy( ProblemName, Lexer::LabelPtr[0], NAME_LEN );
+	strncpy( ProblemName, Lex.LabelPtr[0], NAME_LEN );
 	ProblemName[NAME_LEN] = '\0';
 	if( Verbosity >= V_HIGH )
 		Print( "\t%-20s%-20s\n", "Problem name:", ProblemName );
 
-	if( !Lexer::GetNewline() )
+	if( !Lex.GetNewline() )
 	{
 		Error( "Extra input in the first line." );
 		goto error;
@@ -117,46 +119,46 @@ Bool_T ReadTimes( FILE *fp, MPS_LP &LP, Int_T &Stage1Row, // )
 	//--------------------------------------------------------------------------
 	//	Read in the 'PERIODS' keyword and two lines defining actual periods.
 	//
-	if( !Lexer::GetKeyword( "PERIODS" ) )
+	if( !Lex.GetKeyword( "PERIODS" ) )
 	{
 		Error( "'PERIODS' expected." );
 		goto error;
 	}
 
-	Lexer::GetSpace();
-	Lexer::GetKeyword( "LP" );
+	Lex.GetSpace();
+	Lex.GetKeyword( "LP" );
 
-	if( !Lexer::GetNewline( True ) )
+	if( !Lex.GetNewline( True ) )
 		Error( "Unexpected end of text?" );
 
 	for( i = 0; i < 2; i++ )
 	{
-		if( !Lexer::GetSpace() || !Lexer::GetLabelFree( 0 ) ||
-			!Lexer::GetSpace() || !Lexer::GetLabelFree( 1 ) )
+		if( !Lex.GetSpace() || !Lex.GetLabelFree( 0 ) ||
+			!Lex.GetSpace() || !Lex.GetLabelFree( 1 ) )
 		{
 			Error( "Column and row labels expected." );
 			goto error;
 		}
-		strncpy( StageColLabel[i], Lexer::LabelPtr[0], NAME_LEN );
-		strncpy( StageRowLabel[i], Lexer::LabelPtr[1], NAME_LEN );
+		strncpy( StageColLabel[i], Lex.LabelPtr[0], NAME_LEN );
+		strncpy( StageRowLabel[i], Lex.LabelPtr[1], NAME_LEN );
 		StageRowLabel[i][NAME_LEN] = StageColLabel[i][NAME_LEN] = '\0';
 
-		if( !Lexer::GetSpace() || !Lexer::GetLabelFree( 0 ) )
+		if( !Lex.GetSpace() || !Lex.GetLabelFree( 0 ) )
 		{
 			Error( "Period label expected." );
 			goto error;
 		}
-		strncpy( StagePeriodLabel[i], Lexer::LabelPtr[0], NAME_LEN );
+		strncpy( StagePeriodLabel[i], Lex.LabelPtr[0], NAME_LEN );
 		StagePeriodLabel[i][NAME_LEN] = '\0';
 
-		if( !Lexer::GetNewline( True ) )
+		if( !Lex.GetNewline( True ) )
 			goto error;
 	}
 
 	//--------------------------------------------------------------------------
 	//	Read in the keyword 'ENDATA' and end reading file.
 	//
-	if( !Lexer::GetKeyword( "ENDATA" ) )
+	if( !Lex.GetKeyword( "ENDATA" ) )
 	{
 		Error( "'ENDATA' expected. (Only two period problems understood.)" );
 		goto error;
@@ -73,6 +73,8 @@ Int_T Presolver::ForcingAndDominatedRows( void )
 			Real_T AL, AU;
 			Short_T RT;
 
+			if( IsProtectedRow( i ) ) continue;
+
 			ComputeRowActivityLimits( i, AL, AU, RT );
 
 			if( AL > bu[i] )
@@ -104,7 +106,7 @@ Int_T Presolver::ForcingAndDominatedRows( void )
 				DominatedRows++;
 				ElNum++;
 			}
-			else if( IsForcingRow( i, AL, AU, RT ) )
+			else if( IsScenarioSafeRow( i ) && IsForcingRow( i, AL, AU, RT ) )
 			{
 				ForcingRows++;
 				ElNum++;
@@ -0,0 +1,623 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		Project core code.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE NAME:	run_stat.cpp
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.18
+
+DEPENDENCIES:		run_stat.h, solver.h, inverse.h, stdtype.h, smartptr.h,
+					std_tmpl.h
+					<stdio.h>, <time.h>, <assert.h>, <sys/time.h> (UNIX only)
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE CONTENTS:
+	Implementation of class "RunStatistics" (timers and event counters of a
+run and their output to a CSV or JSON file).
+	Every record holds the processor and wall clock time of each phase, the
+total time since the previous record of the same (or a coarser) level, the
+event counters and the values set for the record (objective, gap estimate,
+variance). Batch records (and the record of the first solution) are followed
+by the numbers of subproblems solved and of pivots made for each scenario: in
+the CSV format as separate "scenario" lines, in the JSON format as two arrays
+of the record.
+
+--------------------------------------------------------------------------------
+
+PUBLIC INTERFACE:
+	RunStatistics::RunStatistics( void )
+	RunStatistics::~RunStatistics( void )
+
+	Bool_T RunStatistics::Open( const char *FileName, Format f )
+	void RunStatistics::Close( void )
+	void RunStatistics::WatchSolver( const Solver &s )
+	void RunStatistics::Subproblem( Int_T block, Long_T Pivots, // )
+		Bool_T Optimal )
+	void RunStatistics::Record( Level lv, Int_T Rep, Int_T Batch )
+
+STATIC FUNCTIONS:
+	static void RunStatistics::Now( double &cpu, double &wall )
+	static void PrintNumber( FILE *fp, double x, Bool_T Json )
+
+STATIC DATA:
+	static const char *PhaseName[], *CounterName[], *ValueName[], *LevelName[]
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <time.h>
+#include <assert.h>
+
+#if defined( unix ) || defined( __unix ) || defined( __unix__ )
+#	include <sys/time.h>
+#endif
+
+#ifndef __RUN_STAT_H__
+#	include "run_stat.h"
+#endif
+#ifndef __SOLVER_H__
+#	include "solver.h"
+#endif
+#ifndef __INVERSE_H__
+#	include "inverse.h"
+#endif
+#ifndef __STD_TMPL_H__
+#	include "std_tmpl.h"
+#endif
+
+
+//------------------------------------------------------------------------------
+//	The only object of the class.
+//
+RunStatistics RunStat;
+
+
+//------------------------------------------------------------------------------
+//	Names of the phases, counters, values and levels (used as the CSV column
+//	names and the JSON keys).
+//
+static const char *PhaseName[] = { "read_lp", "read_time", "crash",
+	"read_scen", "gen_scen", "divide", "solve", "master_qp", "subproblems",
+	"xhat" };
+
+static const char *CounterName[] = { "rd_iter", "master_qp", "subproblems",
+	"sub_optimal", "sub_infeasible", "pivots", "refact", "updates", "ftran",
+	"btran", "cuts_added", "cuts_removed" };
+
+static const char *ValueName[] = { "objective", "gap", "variance" };
+
+static const char *LevelName[] = { "startup", "replication", "batch" };
+
+static void PrintNumber( FILE *fp, double x, Bool_T Json );
+
+
+/*------------------------------------------------------------------------------
+
+	RunStatistics::RunStatistics( void )
+	RunStatistics::~RunStatistics( void )
+
+PURPOSE:
+	Constructor and destructor. The constructor clears all the accumulators.
+The destructor closes the statistics file (if one is open).
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+RunStatistics::RunStatistics( void )
+	: fp( NULL ), Fmt( CSV ), ScenLen( 0 ), ScenUsed( 0 ), Sub( NULL )
+{
+	Int_T i;
+
+	for( i = 0; i < PH_END_MARKER; i++ )
+		RepCpu[i] = RepWall[i] = CpuStart[i] = WallStart[i] = 0.0;
+	for( i = 0; i < CNT_END_MARKER; i++ )
+		RepCnt[i] = 0;
+	for( i = 0; i < LV_END_MARKER; i++ )
+		LevelCpu[i] = LevelWall[i] = 0.0;
+	for( i = 0; i < 4; i++ )
+		SubSnap[i] = 0;
+
+	ClearRecord();
+}
+
+
+RunStatistics::~RunStatistics( void )
+{
+	Close();
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T RunStatistics::Open( const char *FileName, Format f )
+	void RunStatistics::Close( void )
+
+PURPOSE:
+	Open (create) and close the statistics file. The CSV header line is
+written by "Open()". The times of the records are measured from the moment the
+file is opened. "Close()" also releases the per scenario counters (it has to be
+called before the program checks for memory leaks).
+
+PARAMETERS:
+	const char *FileName
+		Statistics file name.
+
+	Format f
+		Record format.
+
+RETURN VALUE:
+	"Open()" returns True on success, False if the file could not be created.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T RunStatistics::Open( const char *FileName, Format f )
+{
+	assert( FileName != NULL );
+	assert( fp == NULL );
+
+	if( ( fp = fopen( FileName, "w" ) ) == NULL )
+		return False;
+
+	Fmt = f;
+	if( Fmt == CSV )
+		WriteHeader();
+
+	double c, w;
+
+	Now( c, w );
+	for( Int_T i = 0; i < LV_END_MARKER; i++ )
+	{
+		LevelCpu[i]		= c;
+		LevelWall[i]	= w;
+	}
+
+	return True;
+}
+
+
+void RunStatistics::Close( void )
+{
+	if( fp != NULL )
+	{
+		fclose( fp );
+		fp = NULL;
+	}
+	Sub = NULL;
+
+	ScenSolved.Resize( 0 );
+	ScenPivots.Resize( 0 );
+	ScenLen = ScenUsed = 0;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void RunStatistics::WatchSolver( const Solver &s )
+
+PURPOSE:
+	Sets the subproblem solver, whose basis factorization counters
+(refactorizations, updates, FTRAN's and BTRAN's) are added to the records.
+Only the events that take place after this call are counted.
+
+PARAMETERS:
+	const Solver &s
+		The subproblem solver. It has to exist until the last record is made
+		or the file is closed.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void RunStatistics::WatchSolver( const Solver &s )
+{
+	Sub = &s;
+	ReadSolverCounters( SubSnap );
+}
+
+
+//------------------------------------------------------------------------------
+//	Reads the current values of the solver counters ("Snap") and (second
+//	version) adds their increments since the last reading to the record.
+//
+void RunStatistics::ReadSolverCounters( Long_T *Snap )
+const
+{
+	assert( Sub != NULL );
+
+	Snap[0] = Sub->ReadStatisticCounter( Inverse::Refact );
+	Snap[1] = Sub->ReadStatisticCounter( Inverse::Upd );
+	Snap[2] = Sub->ReadStatisticCounter( Inverse::SpFTRAN ) +
+		Sub->ReadStatisticCounter( Inverse::DenFTRAN );
+	Snap[3] = Sub->ReadStatisticCounter( Inverse::SpBTRAN ) +
+		Sub->ReadStatisticCounter( Inverse::DenBTRAN );
+}
+
+
+void RunStatistics::ReadSolverCounters( void )
+{
+	if( Sub == NULL ) return;
+
+	Long_T Snap[4];
+
+	ReadSolverCounters( Snap );
+
+	Cnt[CNT_REFACT]		+= Snap[0] - SubSnap[0];
+	Cnt[CNT_UPDATES]	+= Snap[1] - SubSnap[1];
+	Cnt[CNT_FTRAN]		+= Snap[2] - SubSnap[2];
+	Cnt[CNT_BTRAN]		+= Snap[3] - SubSnap[3];
+
+	for( Int_T i = 0; i < 4; i++ )
+		SubSnap[i] = Snap[i];
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void RunStatistics::Subproblem( Int_T block, Long_T Pivots,
+		Bool_T Optimal )
+
+PURPOSE:
+	Counts a subproblem solution. When the statistics file is open, the
+solution and its pivots are also counted for the scenario.
+
+PARAMETERS:
+	Int_T block
+		Scenario number (counted from zero).
+
+	Long_T Pivots
+		Number of simplex iterations made.
+
+	Bool_T Optimal
+		True if the subproblem was solved to optimality, False if it was found
+		infeasible.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void RunStatistics::Subproblem( Int_T block, Long_T Pivots, Bool_T Optimal )
+{
+	assert( block >= 0 );
+
+	Cnt[CNT_SUBPROBLEMS]++;
+	Cnt[ Optimal ? CNT_SUB_OPTIMAL : CNT_SUB_INFEAS ]++;
+	Cnt[CNT_PIVOTS] += Pivots;
+
+	if( fp == NULL ) return;
+
+	if( block >= ScenLen )
+	{
+		Int_T len = Max( block + 1, 2 * ScenLen );
+
+		ScenSolved.Resize( len );
+		ScenPivots.Resize( len );
+		for( ; ScenLen < len; ScenLen++ )
+			ScenSolved[ScenLen] = ScenPivots[ScenLen] = 0;
+	}
+	if( block >= ScenUsed )
+		ScenUsed = block + 1;
+
+	ScenSolved[block]++;
+	ScenPivots[block] += Pivots;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void RunStatistics::Record( Level lv, Int_T Rep, Int_T Batch )
+
+PURPOSE:
+	Ends a record. The solver counters are read. Unless this is the start-up
+record, the batch accumulators are added to the replication accumulators. The
+record is written (if the file is open): the replication accumulators for a
+replication record, the batch accumulators otherwise. Afterwards the batch
+accumulators, the values and the per scenario counts are cleared (after the
+start-up and replication records the replication accumulators as well).
+
+PARAMETERS:
+	Level lv
+		Record level.
+
+	Int_T Rep, Int_T Batch
+		Replication and batch numbers (negative if not applicable).
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void RunStatistics::Record( Level lv, Int_T Rep, Int_T Batch )
+{
+	Int_T i;
+
+	ReadSolverCounters();
+
+	if( lv != LV_STARTUP )
+	{
+		for( i = 0; i < PH_END_MARKER; i++ )
+		{
+			RepCpu[i]	+= Cpu[i];
+			RepWall[i]	+= Wall[i];
+		}
+		for( i = 0; i < CNT_END_MARKER; i++ )
+			RepCnt[i] += Cnt[i];
+	}
+
+	if( fp != NULL )
+	{
+		double c, w;
+
+		Now( c, w );
+
+		const Bool_T Rp = ( lv == LV_REPLICATION ) ? True : False;
+
+		if( Fmt == CSV )
+			WriteCSV( lv, Rep, Batch, Rp ? RepCpu : Cpu, Rp ? RepWall : Wall,
+				Rp ? RepCnt : Cnt, c - LevelCpu[lv], w - LevelWall[lv] );
+		else
+			WriteJSON( lv, Rep, Batch, Rp ? RepCpu : Cpu, Rp ? RepWall : Wall,
+				Rp ? RepCnt : Cnt, c - LevelCpu[lv], w - LevelWall[lv] );
+		fflush( fp );
+
+		for( i = lv; i < LV_END_MARKER; i++ )
+		{
+			LevelCpu[i]		= c;
+			LevelWall[i]	= w;
+		}
+	}
+
+	if( lv != LV_BATCH )
+	{
+		for( i = 0; i < PH_END_MARKER; i++ )
+			RepCpu[i] = RepWall[i] = 0.0;
+		for( i = 0; i < CNT_END_MARKER; i++ )
+			RepCnt[i] = 0;
+	}
+
+	ClearRecord();
+}
+
+
+void RunStatistics::ClearRecord( void )
+{
+	Int_T i;
+
+	for( i = 0; i < PH_END_MARKER; i++ )
+		Cpu[i] = Wall[i] = 0.0;
+	for( i = 0; i < CNT_END_MARKER; i++ )
+		Cnt[i] = 0;
+	for( i = 0; i < VAL_END_MARKER; i++ )
+	{
+		Val[i]		= 0.0;
+		ValSet[i]	= False;
+	}
+
+	for( i = 0; i < ScenUsed; i++ )
+		ScenSolved[i] = ScenPivots[i] = 0;
+	ScenUsed = 0;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void RunStatistics::WriteHeader( void )
+	void RunStatistics::WriteCSV( ... )
+	void RunStatistics::WriteJSON( ... )
+
+PURPOSE:
+	Output of the CSV header line and of a record in either format. Missing
+numbers are written as empty CSV fields or JSON "null" values.
+
+PARAMETERS:
+	Level lv, Int_T Rep, Int_T Batch
+		Record level, replication and batch numbers.
+
+	const double *cpu, const double *wall, const Long_T *cnt
+		Phase times and event counts of the record.
+
+	double TotCpu, double TotWall
+		Time since the previous record of the same (or coarser) level.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void RunStatistics::WriteHeader( void )
+{
+	Int_T i;
+
+	fprintf( fp, "level,rep,batch,scenario,total_cpu,total_wall" );
+	for( i = 0; i < PH_END_MARKER; i++ )
+		fprintf( fp, ",%s_cpu,%s_wall", PhaseName[i], PhaseName[i] );
+	for( i = 0; i < CNT_END_MARKER; i++ )
+		fprintf( fp, ",%s", CounterName[i] );
+	for( i = 0; i < VAL_END_MARKER; i++ )
+		fprintf( fp, ",%s", ValueName[i] );
+	fprintf( fp, "\n" );
+}
+
+
+void RunStatistics::WriteCSV( Level lv, Int_T Rep, Int_T Batch, // )
+	const double *cpu, const double *wall, const Long_T *cnt, double TotCpu,
+	double TotWall )
+{
+	Int_T i;
+
+	fprintf( fp, "%s,", LevelName[lv] );
+	if( Rep >= 0 )		fprintf( fp, "%d", (int) Rep );
+	fprintf( fp, "," );
+	if( Batch >= 0 )	fprintf( fp, "%d", (int) Batch );
+	fprintf( fp, ",,%.6f,%.6f", TotCpu, TotWall );
+
+	for( i = 0; i < PH_END_MARKER; i++ )
+		fprintf( fp, ",%.6f,%.6f", cpu[i], wall[i] );
+	for( i = 0; i < CNT_END_MARKER; i++ )
+		fprintf( fp, ",%ld", (long) cnt[i] );
+	for( i = 0; i < VAL_END_MARKER; i++ )
+	{
+		fprintf( fp, "," );
+		if( ValSet[i] ) PrintNumber( fp, Val[i], False );
+	}
+	fprintf( fp, "\n" );
+
+	if( lv == LV_REPLICATION ) return;
+
+	//--------------------------------------------------------------------------
+	//	Per scenario lines: only the subproblem and pivot counts are given.
+	//
+	for( Int_T s = 0; s < ScenUsed; s++ )
+	{
+		fprintf( fp, "scenario," );
+		if( Rep >= 0 )		fprintf( fp, "%d", (int) Rep );
+		fprintf( fp, "," );
+		if( Batch >= 0 )	fprintf( fp, "%d", (int) Batch );
+		fprintf( fp, ",%d,,", (int) s );
+
+		for( i = 0; i < PH_END_MARKER; i++ )
+			fprintf( fp, ",," );
+		for( i = 0; i < CNT_END_MARKER; i++ )
+			if( i == CNT_SUBPROBLEMS )
+				fprintf( fp, ",%ld", (long) ScenSolved[s] );
+			else if( i == CNT_PIVOTS )
+				fprintf( fp, ",%ld", (long) ScenPivots[s] );
+			else
+				fprintf( fp, "," );
+		for( i = 0; i < VAL_END_MARKER; i++ )
+			fprintf( fp, "," );
+		fprintf( fp, "\n" );
+	}
+}
+
+
+void RunStatistics::WriteJSON( Level lv, Int_T Rep, Int_T Batch, // )
+	const double *cpu, const double *wall, const Long_T *cnt, double TotCpu,
+	double TotWall )
+{
+	Int_T i;
+
+	fprintf( fp, "{\"level\":\"%s\",\"rep\":", LevelName[lv] );
+	if( Rep >= 0 )		fprintf( fp, "%d", (int) Rep );
+	else				fprintf( fp, "null" );
+	fprintf( fp, ",\"batch\":" );
+	if( Batch >= 0 )	fprintf( fp, "%d", (int) Batch );
+	else				fprintf( fp, "null" );
+
+	fprintf( fp, ",\"cpu\":{\"total\":%.6f", TotCpu );
+	for( i = 0; i < PH_END_MARKER; i++ )
+		fprintf( fp, ",\"%s\":%.6f", PhaseName[i], cpu[i] );
+	fprintf( fp, "},\"wall\":{\"total\":%.6f", TotWall );
+	for( i = 0; i < PH_END_MARKER; i++ )
+		fprintf( fp, ",\"%s\":%.6f", PhaseName[i], wall[i] );
+
+	fprintf( fp, "},\"counters\":{" );
+	for( i = 0; i < CNT_END_MARKER; i++ )
+		fprintf( fp, "%s\"%s\":%ld", i ? "," : "", CounterName[i],
+			(long) cnt[i] );
+
+	fprintf( fp, "},\"values\":{" );
+	for( i = 0; i < VAL_END_MARKER; i++ )
+	{
+		fprintf( fp, "%s\"%s\":", i ? "," : "", ValueName[i] );
+		if( ValSet[i] )	PrintNumber( fp, Val[i], True );
+		else			fprintf( fp, "null" );
+	}
+	fprintf( fp, "}" );
+
+	if( lv != LV_REPLICATION )
+	{
+		Int_T s;
+
+		fprintf( fp, ",\"scenario_subproblems\":[" );
+		for( s = 0; s < ScenUsed; s++ )
+			fprintf( fp, "%s%ld", s ? "," : "", (long) ScenSolved[s] );
+		fprintf( fp, "],\"scenario_pivots\":[" );
+		for( s = 0; s < ScenUsed; s++ )
+			fprintf( fp, "%s%ld", s ? "," : "", (long) ScenPivots[s] );
+		fprintf( fp, "]" );
+	}
+
+	fprintf( fp, "}\n" );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static void RunStatistics::Now( double &cpu, double &wall )
+
+PURPOSE:
+	Reads the processor time used so far and the wall clock time (both in
+seconds).
+
+PARAMETERS:
+	double &cpu, double &wall
+		Output: the times.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void RunStatistics::Now( double &cpu, double &wall )
+{
+	cpu = (double) clock() / (double) CLOCKS_PER_SEC;
+
+#if defined( unix ) || defined( __unix ) || defined( __unix__ )
+	struct timeval tv;
+
+	gettimeofday( &tv, NULL );
+	wall = (double) tv.tv_sec + 1.0e-6 * (double) tv.tv_usec;
+#else
+	wall = (double) time( NULL );
+#endif
+}
+
+
+//------------------------------------------------------------------------------
+//	Writes a number. Infinities and NaN's are written as "null" in JSON (which
+//	has no representation for them).
+//
+static void PrintNumber( FILE *fp, double x, Bool_T Json )
+{
+	if( Json && !( x - x == 0.0 ) )
+		fprintf( fp, "null" );
+	else
+		fprintf( fp, "%.12g", x );
+}
@@ -0,0 +1,248 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		Project core code.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+HEADER FILE NAME:	run_stat.h
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.18
+
+DEPENDENCIES:		stdtype.h, smartptr.h,
+					<stdio.h>
+
+--------------------------------------------------------------------------------
+
+HEADER CONTENTS:
+	Declaration of class "RunStatistics" and of its only object "RunStat".
+	The object collects the processor and the wall clock times of the phases
+of the solution process (reading, crash, scenario generation, master QP,
+subproblems, evaluation of the candidate solution) and the counts of the
+events (decomposition iterations, master QP solutions, subproblems solved,
+simplex pivots, refactorizations, FTRAN's and BTRAN's, cuts added to and
+removed from the committee). Subproblem pivots are also counted separately
+for each scenario.
+	When a statistics file is opened (option "-stats"), one record is written
+after the first solution, one after every batch and one after every
+replication of the multiple replication procedure. The records are CSV lines
+(with a header line) or JSON objects (one object per line). The counting goes
+on when no file is open, but the timers are not read then.
+
+------------------------------------------------------------------------------*/
+
+#ifndef __RUN_STAT_H__
+#define __RUN_STAT_H__
+
+#include <stdio.h>
+
+#ifndef __STDTYPE_H__
+#	include "stdtype.h"
+#endif
+#ifndef __SMARTPTR_H__
+#	include "smartptr.h"
+#endif
+
+class Solver;
+
+//==============================================================================
+//
+//	Class "RunStatistics" declaration.
+//
+//==============================================================================
+
+class RunStatistics
+{
+public:
+	//--------------------------------------------------------------------------
+	//	The timed phases. "PH_SOLVE" and "PH_XHAT" contain the master QP and
+	//	subproblem times of the corresponding solutions.
+	//
+	enum Phase
+	{
+		PH_READ_LP = 0,		// Reading of the core file.
+		PH_READ_TIME,		// Reading of the time file.
+		PH_CRASH,			// Crash LP solution.
+		PH_READ_SCEN,		// Reading of the stoch file.
+		PH_GEN_SCEN,		// Scenario (re)generation.
+		PH_DIVIDE,			// Division of the LP into stages.
+		PH_SOLVE,			// Solution of the sampled problem.
+		PH_MASTER,			// Regularized master QP.
+		PH_SUBPROBLEMS,		// Second stage subproblems.
+		PH_XHAT,			// Evaluation of the candidate solution.
+
+		PH_END_MARKER
+	};
+
+	enum Counter
+	{
+		CNT_RD_ITER = 0,	// Regularized decomposition iterations.
+		CNT_MASTER_QP,		// Master QP solutions.
+		CNT_SUBPROBLEMS,	// Subproblems solved,
+		CNT_SUB_OPTIMAL,	// ... of which optimal
+		CNT_SUB_INFEAS,		// ... and infeasible.
+		CNT_PIVOTS,			// Subproblem simplex pivots.
+		CNT_REFACT,			// Subproblem basis refactorizations,
+		CNT_UPDATES,		// basis updates,
+		CNT_FTRAN,			// FTRAN's (sparse and dense)
+		CNT_BTRAN,			// and BTRAN's.
+		CNT_CUTS_ADDED,		// Cuts added to the committee.
+		CNT_CUTS_REMOVED,	// Cuts removed by committee compression.
+
+		CNT_END_MARKER
+	};
+
+	enum Value
+	{
+		VAL_OBJECTIVE = 0,	// Optimal value of the sampled problem.
+		VAL_GAP,			// Gap estimate (of the batch or replication).
+		VAL_VARIANCE,		// Variance of the gap estimates.
+
+		VAL_END_MARKER
+	};
+
+	enum Level { LV_STARTUP = 0, LV_REPLICATION, LV_BATCH, LV_END_MARKER };
+	enum Format { CSV, JSON };
+
+private:
+	FILE *fp;
+	Format Fmt;
+
+	//--------------------------------------------------------------------------
+	//	Accumulators of the current record (the batch) and of the current
+	//	replication.
+	//
+	double Cpu[PH_END_MARKER], Wall[PH_END_MARKER],
+		RepCpu[PH_END_MARKER], RepWall[PH_END_MARKER];
+	Long_T Cnt[CNT_END_MARKER], RepCnt[CNT_END_MARKER];
+
+	double Val[VAL_END_MARKER];
+	Bool_T ValSet[VAL_END_MARKER];
+
+	Array<Long_T> ScenSolved, ScenPivots;	// Per scenario counts.
+	Int_T ScenLen, ScenUsed;
+
+	//--------------------------------------------------------------------------
+	//	Running timers and the times of the last record of every level.
+	//
+	double CpuStart[PH_END_MARKER], WallStart[PH_END_MARKER];
+	double LevelCpu[LV_END_MARKER], LevelWall[LV_END_MARKER];
+
+	//--------------------------------------------------------------------------
+	//	The subproblem solver, whose basis factorization counters are read
+	//	(as differences) when a record is made.
+	//
+	const Solver *Sub;
+	Long_T SubSnap[4];
+
+private:
+	RunStatistics( const RunStatistics & );
+	RunStatistics &operator=( const RunStatistics & );
+
+	void ClearRecord( void );
+	void ReadSolverCounters( Long_T *Snap ) const;
+	void ReadSolverCounters( void );
+	void WriteHeader( void );
+	void WriteCSV( Level lv, Int_T Rep, Int_T Batch, const double *cpu,
+		const double *wall, const Long_T *cnt, double TotCpu, double TotWall );
+	void WriteJSON( Level lv, Int_T Rep, Int_T Batch, const double *cpu,
+		const double *wall, const Long_T *cnt, double TotCpu, double TotWall );
+
+	static void Now( double &cpu, double &wall );
+
+public:
+	RunStatistics( void );
+	~RunStatistics( void );
+
+	Bool_T Open( const char *FileName, Format f );
+	void Close( void );
+	Bool_T Active( void ) const;
+
+	void WatchSolver( const Solver &s );
+
+	//--------------------------------------------------------------------------
+	//	Collection of data.
+	//
+	void Start( Phase p );
+	void Stop( Phase p );
+	void AddTime( Phase p, double cpu, double wall );
+	void Count( Counter c, Long_T n = 1 );
+	void Subproblem( Int_T block, Long_T Pivots, Bool_T Optimal );
+	void SetValue( Value v, double x );
+
+	//--------------------------------------------------------------------------
+	//	Output of a record. The batch accumulators are added to the ones of
+	//	the replication and cleared.
+	//
+	void Record( Level lv, Int_T Rep = -1, Int_T Batch = -1 );
+};
+
+extern RunStatistics RunStat;
+
+//==============================================================================
+//
+//	End of class "RunStatistics" declaration.
+//
+//==============================================================================
+
+
+//==============================================================================
+//
+//	Inline functions.
+//
+//==============================================================================
+
+inline
+Bool_T RunStatistics::Active( void )
+const
+{ return ( fp != NULL ) ? True : False; }
+
+
+inline
+void RunStatistics::Start( Phase p )
+{
+	if( fp ) Now( CpuStart[p], WallStart[p] );
+}
+
+
+inline
+void RunStatistics::Stop( Phase p )
+{
+	if( fp )
+	{
+		double c, w;
+
+		Now( c, w );
+		Cpu[p]	+= c - CpuStart[p];
+		Wall[p]	+= w - WallStart[p];
+	}
+}
+
+
+inline
+void RunStatistics::AddTime( Phase p, double cpu, double wall )
+{
+	Cpu[p]	+= cpu;
+	Wall[p]	+= wall;
+}
+
+
+inline
+void RunStatistics::Count( Counter c, Long_T n )
+{ Cnt[c] += n; }
+
+
+inline
+void RunStatistics::SetValue( Value v, double x )
+{
+	Val[v]		= x;
+	ValSet[v]	= True;
+}
+
+
+#endif
@@ -0,0 +1,498 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		General purpose mathematical module.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE NAME:	sampler.cpp
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.18
+
+DEPENDENCIES:		sampler.h, rand01.h, stdtype.h, smartptr.h
+					<assert.h>
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE CONTENTS:
+	Implementation of class "UniformSampler" (Monte Carlo, Latin hypercube
+and randomized quasi-Monte Carlo uniform samples, optionally in antithetic
+pairs).
+
+--------------------------------------------------------------------------------
+
+PUBLIC INTERFACE:
+	UniformSampler::UniformSampler( void )
+	UniformSampler::~UniformSampler( void )
+
+	void UniformSampler::NewBlock( Int_T points, Int_T dim )
+	Real_T UniformSampler::Next( Int_T p, Int_T j )
+
+STATIC FUNCTIONS:
+	static inline unsigned long Parity( unsigned long x )
+
+STATIC DATA:
+	static const SobolInit SobolTable[]
+
+------------------------------------------------------------------------------*/
+
+#include <assert.h>
+
+#ifndef __SAMPLER_H__
+#	include "sampler.h"
+#endif
+
+
+//------------------------------------------------------------------------------
+//	Explicit template instantiation (for GNU C++  ver. 2.6.2 or later only).
+//
+#if defined( explicit_templates )
+	template class SmartPointerBase<unsigned long>;
+	template class Array<unsigned long>;
+	template class Ptr<unsigned long>;
+#endif
+//
+//------------------------------------------------------------------------------
+
+
+#define WORD_MASK	(0xFFFFFFFFUL)
+
+//------------------------------------------------------------------------------
+//	Primitive polynomials (the coefficients as bits, including the leading and
+//	the constant one) and the initial direction numbers "m_1", ..., "m_s" of
+//	dimensions 2, ..., SOBOL_DIM of the Sobol sequence. From: S. Joe,
+//	F. Y. Kuo, "Constructing Sobol sequences with better two-dimensional
+//	projections", SIAM J. Sci. Comput. 30 (2008), 2635-2654 (the
+//	"new-joe-kuo-6.21201" direction numbers). The first dimension is the van
+//	der Corput sequence.
+//
+struct SobolInit
+{
+	unsigned short Poly;
+	unsigned short M[10];
+};
+
+static const SobolInit SobolTable[ UniformSampler::SOBOL_DIM - 1 ] =
+{
+	{    3, { 1 } },
+	{    7, { 1, 3 } },
+	{   11, { 1, 3, 1 } },
+	{   13, { 1, 1, 1 } },
+	{   19, { 1, 1, 3, 3 } },
+	{   25, { 1, 3, 5, 13 } },
+	{   37, { 1, 1, 5, 5, 17 } },
+	{   41, { 1, 1, 5, 5, 5 } },
+	{   47, { 1, 1, 7, 11, 19 } },
+	{   55, { 1, 1, 5, 1, 1 } },
+	{   59, { 1, 1, 1, 3, 11 } },
+	{   61, { 1, 3, 5, 5, 31 } },
+	{   67, { 1, 3, 3, 9, 7, 49 } },
+	{   91, { 1, 1, 1, 15, 21, 21 } },
+	{   97, { 1, 3, 1, 13, 27, 49 } },
+	{  103, { 1, 1, 1, 15, 7, 5 } },
+	{  109, { 1, 3, 1, 15, 13, 25 } },
+	{  115, { 1, 1, 5, 5, 19, 61 } },
+	{  131, { 1, 3, 7, 11, 23, 15, 103 } },
+	{  137, { 1, 3, 7, 13, 13, 15, 69 } },
+	{  143, { 1, 1, 3, 13, 7, 35, 63 } },
+	{  145, { 1, 3, 5, 9, 1, 25, 53 } },
+	{  157, { 1, 3, 1, 13, 9, 35, 107 } },
+	{  167, { 1, 3, 1, 5, 27, 61, 31 } },
+	{  171, { 1, 1, 5, 11, 19, 41, 61 } },
+	{  185, { 1, 3, 5, 3, 3, 13, 69 } },
+	{  191, { 1, 1, 7, 13, 1, 19, 1 } },
+	{  193, { 1, 3, 7, 5, 13, 19, 59 } },
+	{  203, { 1, 1, 3, 9, 25, 29, 41 } },
+	{  211, { 1, 3, 5, 13, 23, 1, 55 } },
+	{  213, { 1, 3, 7, 3, 13, 59, 17 } },
+	{  229, { 1, 3, 1, 3, 5, 53, 69 } },
+	{  239, { 1, 1, 5, 5, 23, 33, 13 } },
+	{  241, { 1, 1, 7, 7, 1, 61, 123 } },
+	{  247, { 1, 1, 7, 9, 13, 61, 49 } },
+	{  253, { 1, 3, 3, 5, 3, 55, 33 } },
+	{  285, { 1, 3, 1, 15, 31, 13, 49, 245 } },
+	{  299, { 1, 3, 5, 15, 31, 59, 63, 97 } },
+	{  301, { 1, 3, 1, 11, 11, 11, 77, 249 } },
+	{  333, { 1, 3, 1, 11, 27, 43, 71, 9 } },
+	{  351, { 1, 1, 7, 15, 21, 11, 81, 45 } },
+	{  355, { 1, 3, 7, 3, 25, 31, 65, 79 } },
+	{  357, { 1, 3, 1, 1, 19, 11, 3, 205 } },
+	{  361, { 1, 1, 5, 9, 19, 21, 29, 157 } },
+	{  369, { 1, 3, 7, 11, 1, 33, 89, 185 } },
+	{  391, { 1, 3, 3, 3, 15, 9, 79, 71 } },
+	{  397, { 1, 3, 7, 11, 15, 39, 119, 27 } },
+	{  425, { 1, 1, 3, 1, 11, 31, 97, 225 } },
+	{  451, { 1, 1, 1, 3, 23, 43, 57, 177 } },
+	{  463, { 1, 3, 7, 7, 17, 17, 37, 71 } },
+	{  487, { 1, 3, 1, 5, 27, 63, 123, 213 } },
+	{  501, { 1, 1, 3, 5, 11, 43, 53, 133 } },
+	{  529, { 1, 3, 5, 5, 29, 17, 47, 173, 479 } },
+	{  539, { 1, 3, 3, 11, 3, 1, 109, 9, 69 } },
+	{  545, { 1, 1, 1, 5, 17, 39, 23, 5, 343 } },
+	{  557, { 1, 3, 1, 5, 25, 15, 31, 103, 499 } },
+	{  563, { 1, 1, 1, 11, 11, 17, 63, 105, 183 } },
+	{  601, { 1, 1, 5, 11, 9, 29, 97, 231, 363 } },
+	{  607, { 1, 1, 5, 15, 19, 45, 41, 7, 383 } },
+	{  617, { 1, 3, 7, 7, 31, 19, 83, 137, 221 } },
+	{  623, { 1, 1, 1, 3, 23, 15, 111, 223, 83 } },
+	{  631, { 1, 1, 5, 13, 31, 15, 55, 25, 161 } },
+	{  637, { 1, 1, 3, 13, 25, 47, 39, 87, 257 } },
+	{  647, { 1, 1, 1, 11, 21, 53, 125, 249, 293 } },
+	{  661, { 1, 1, 7, 11, 11, 7, 57, 79, 323 } },
+	{  675, { 1, 1, 5, 5, 17, 13, 81, 3, 131 } },
+	{  677, { 1, 1, 7, 13, 23, 7, 65, 251, 475 } },
+	{  687, { 1, 3, 5, 1, 9, 43, 3, 149, 11 } },
+	{  695, { 1, 1, 3, 13, 31, 13, 13, 255, 487 } },
+	{  701, { 1, 3, 3, 1, 5, 63, 89, 91, 127 } },
+	{  719, { 1, 1, 3, 3, 1, 19, 123, 127, 237 } },
+	{  721, { 1, 1, 5, 7, 23, 31, 37, 243, 289 } },
+	{  731, { 1, 1, 5, 11, 17, 53, 117, 183, 491 } },
+	{  757, { 1, 1, 1, 5, 1, 13, 13, 209, 345 } },
+	{  761, { 1, 1, 3, 15, 1, 57, 115, 7, 33 } },
+	{  787, { 1, 3, 1, 11, 7, 43, 81, 207, 175 } },
+	{  789, { 1, 3, 1, 1, 15, 27, 63, 255, 49 } },
+	{  799, { 1, 3, 5, 3, 27, 61, 105, 171, 305 } },
+	{  803, { 1, 1, 5, 3, 1, 3, 57, 249, 149 } },
+	{  817, { 1, 1, 3, 5, 5, 57, 15, 13, 159 } },
+	{  827, { 1, 1, 1, 11, 7, 11, 105, 141, 225 } },
+	{  847, { 1, 3, 3, 5, 27, 59, 121, 101, 271 } },
+	{  859, { 1, 3, 5, 9, 11, 49, 51, 59, 115 } },
+	{  865, { 1, 1, 7, 1, 23, 45, 125, 71, 419 } },
+	{  875, { 1, 1, 3, 5, 23, 5, 105, 109, 75 } },
+	{  877, { 1, 1, 7, 15, 7, 11, 67, 121, 453 } },
+	{  883, { 1, 3, 7, 3, 9, 13, 31, 27, 449 } },
+	{  895, { 1, 3, 1, 15, 19, 39, 39, 89, 15 } },
+	{  901, { 1, 1, 1, 1, 1, 33, 73, 145, 379 } },
+	{  911, { 1, 3, 1, 15, 15, 43, 29, 13, 483 } },
+	{  949, { 1, 1, 7, 3, 19, 27, 85, 131, 431 } },
+	{  953, { 1, 3, 3, 3, 5, 35, 23, 195, 349 } },
+	{  967, { 1, 3, 3, 7, 9, 27, 39, 59, 297 } },
+	{  971, { 1, 1, 3, 9, 11, 17, 13, 241, 157 } },
+	{  973, { 1, 3, 7, 15, 25, 57, 33, 189, 213 } },
+	{  981, { 1, 1, 7, 1, 9, 55, 73, 83, 217 } },
+	{  985, { 1, 3, 3, 13, 19, 27, 23, 113, 249 } },
+	{  995, { 1, 3, 5, 3, 23, 43, 3, 253, 479 } },
+	{ 1001, { 1, 1, 5, 5, 11, 5, 45, 117, 217 } },
+	{ 1019, { 1, 3, 3, 7, 29, 37, 33, 123, 147 } },
+	{ 1033, { 1, 3, 1, 15, 5, 5, 37, 227, 223, 459 } },
+	{ 1051, { 1, 1, 7, 5, 5, 39, 63, 255, 135, 487 } },
+	{ 1063, { 1, 3, 1, 7, 9, 7, 87, 249, 217, 599 } },
+	{ 1069, { 1, 1, 3, 13, 9, 47, 7, 225, 363, 247 } },
+	{ 1125, { 1, 3, 7, 13, 19, 13, 9, 67, 9, 737 } },
+	{ 1135, { 1, 3, 5, 5, 19, 59, 7, 41, 319, 677 } },
+	{ 1153, { 1, 1, 5, 3, 31, 63, 15, 43, 207, 789 } },
+	{ 1163, { 1, 1, 7, 9, 13, 39, 3, 47, 497, 169 } },
+	{ 1221, { 1, 3, 1, 7, 21, 17, 97, 19, 415, 905 } },
+	{ 1239, { 1, 3, 7, 1, 3, 31, 71, 111, 165, 127 } },
+	{ 1255, { 1, 1, 5, 11, 1, 61, 83, 119, 203, 847 } },
+	{ 1267, { 1, 3, 3, 13, 9, 61, 19, 97, 47, 35 } },
+	{ 1279, { 1, 1, 7, 7, 15, 29, 63, 95, 417, 469 } },
+	{ 1293, { 1, 3, 1, 9, 25, 9, 71, 57, 213, 385 } },
+	{ 1305, { 1, 3, 5, 13, 31, 47, 101, 57, 39, 341 } },
+	{ 1315, { 1, 1, 3, 3, 31, 57, 125, 173, 365, 551 } },
+	{ 1329, { 1, 3, 7, 1, 13, 57, 67, 157, 451, 707 } },
+	{ 1341, { 1, 1, 1, 7, 21, 13, 105, 89, 429, 965 } },
+	{ 1347, { 1, 1, 5, 9, 17, 51, 45, 119, 157, 141 } },
+	{ 1367, { 1, 3, 7, 7, 13, 45, 91, 9, 129, 741 } },
+	{ 1387, { 1, 3, 7, 1, 23, 57, 67, 141, 151, 571 } },
+	{ 1413, { 1, 1, 3, 11, 17, 47, 93, 107, 375, 157 } },
+	{ 1423, { 1, 3, 3, 5, 11, 21, 43, 51, 169, 915 } },
+	{ 1431, { 1, 1, 5, 3, 15, 55, 101, 67, 455, 625 } },
+	{ 1441, { 1, 3, 5, 9, 1, 23, 29, 47, 345, 595 } },
+	{ 1479, { 1, 3, 7, 7, 5, 49, 29, 155, 323, 589 } },
+	{ 1509, { 1, 3, 3, 7, 5, 41, 127, 61, 261, 717 } }
+};
+
+
+static inline unsigned long Parity( unsigned long x )
+{
+	x ^= x >> 16;
+	x ^= x >> 8;
+	x ^= x >> 4;
+	x ^= x >> 2;
+	x ^= x >> 1;
+	return x & 1UL;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	UniformSampler::UniformSampler( void )
+	UniformSampler::~UniformSampler( void )
+
+PURPOSE:
+	Constructor and destructor. The object initially produces plain Monte
+Carlo samples.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+UniformSampler::UniformSampler( void )
+	: Meth( MC ), Points( 0 ), Dim( 0 ), QmcDim( 0 ), PermLen( 0 ), DirDim( 0 ),
+	Anti( False ), LastLen( 0 ), Last(), Perm(), Dir(), Shift()
+{}
+
+
+UniformSampler::~UniformSampler( void )
+{}
+
+
+/*------------------------------------------------------------------------------
+
+	void UniformSampler::NewBlock( Int_T points, Int_T dim )
+
+PURPOSE:
+	Starts a new block of "points" points in "dim" dimensions: draws the Latin
+hypercube permutations or the Sobol sequence scrambling. Nothing is drawn for
+Monte Carlo sampling. With antithetic variates only "(points+1)/2" points are
+drawn (the even ones).
+
+PARAMETERS:
+	Int_T points, Int_T dim
+		The size of the block.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	Consumes random numbers of "Random01".
+
+------------------------------------------------------------------------------*/
+
+void UniformSampler::NewBlock( Int_T points, Int_T dim )
+{
+	assert( points > 0 && dim >= 0 );
+
+	Points	= Anti ? ( points + 1 ) / 2 : points;
+	Dim		= dim;
+
+	if( Anti && LastLen < Dim )
+		Last.Resize( LastLen = Dim );
+
+	switch( Meth )
+	{
+	case MC:
+		QmcDim = 0;
+		break;
+
+	case LHS:
+		QmcDim = 0;
+		NewPermutations( 0 );
+		break;
+
+	case RQMC:
+		QmcDim = ( Dim < SOBOL_DIM ) ? Dim : (Int_T) SOBOL_DIM;
+		NewScrambling();
+		NewPermutations( QmcDim );
+		break;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Real_T UniformSampler::Next( Int_T p, Int_T j )
+	Real_T UniformSampler::Draw( Int_T p, Int_T j )
+
+PURPOSE:
+	Produces the coordinate "j" of the point "p" of the current block. For the
+Monte Carlo and the Latin hypercube sampling each call draws a random number,
+so the points have to be produced in the same order every time a block is
+regenerated (the scenario generators take them point by point, dimension by
+dimension). The same order lets the antithetic variates keep only the last
+even point: the odd point "p" must follow the point "p-1".
+	"Draw()" produces the coordinate of the point of the underlying sample
+(which is half as large for the antithetic variates).
+
+PARAMETERS:
+	Int_T p, Int_T j
+		Point number (0 <= p < points) and dimension (0 <= j < dim).
+
+RETURN VALUE:
+	A number from the (0,1) range.
+
+SIDE EFFECTS:
+	See above.
+
+------------------------------------------------------------------------------*/
+
+Real_T UniformSampler::Next( Int_T p, Int_T j )
+{
+	if( !Anti )
+		return Draw( p, j );
+
+	assert( j >= 0 && j < Dim );
+
+	if( p % 2 )
+		return 1.0 - Last[j];
+	else
+		return Last[j] = Draw( p / 2, j );
+}
+
+
+Real_T UniformSampler::Draw( Int_T p, Int_T j )
+{
+	if( Meth == MC )
+		return Random01::Next();
+
+	assert( p >= 0 && p < Points );
+	assert( j >= 0 && j < Dim );
+
+	if( j >= QmcDim )
+		return ( Perm[ ( j - QmcDim ) * Points + p ] + Random01::Next() ) /
+			(Real_T) Points;
+
+	//--------------------------------------------------------------------------
+	//	Sobol point "p" (in the Gray code order) of the scrambled sequence.
+	//
+	const unsigned long *d = Dir.start + j * SOBOL_BITS;
+	unsigned long x = Shift[j];
+
+	for( unsigned long g = (unsigned long) p ^ ( (unsigned long) p >> 1 ); g;
+		g >>= 1, d++ )
+		if( g & 1UL ) x ^= *d;
+
+	return ( (Real_T) x + 0.5 ) / 4294967296.0;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void UniformSampler::NewPermutations( Int_T FirstDim )
+	void UniformSampler::NewScrambling( void )
+	static unsigned long UniformSampler::RandomWord( void )
+
+PURPOSE:
+	The first function draws random permutations of the strata for
+dimensions "FirstDim", ..., "Dim-1" (Latin hypercube sampling). The second one
+computes the direction numbers of the first "QmcDim" dimensions of the Sobol
+sequence and scrambles them: each dimension is multiplied by a random lower
+triangular binary matrix with unit diagonal (Matousek's linear scramble) and
+gets a random digital shift. The last one draws 32 random bits.
+
+PARAMETERS:
+	Int_T FirstDim
+		The first Latin hypercube dimension.
+
+RETURN VALUE:
+	A random word (the last function).
+
+SIDE EFFECTS:
+	Consume random numbers of "Random01".
+
+------------------------------------------------------------------------------*/
+
+void UniformSampler::NewPermutations( Int_T FirstDim )
+{
+	Int_T len = Points * ( Dim - FirstDim );
+
+	if( len == 0 ) return;
+	if( PermLen < len ) Perm.Resize( PermLen = len );
+
+	for( Int_T j = 0; j < Dim - FirstDim; j++ )
+	{
+		Int_T *perm = Perm.start + j * Points;
+		Int_T p;
+
+		for( p = 0; p < Points; p++ )
+			perm[p] = p;
+
+		for( p = Points - 1; p > 0; p-- )
+		{
+			Int_T q = (Int_T) ( Random01::Next() * ( p + 1 ) );
+
+			if( q > p ) q = p;
+
+			Int_T t = perm[p]; perm[p] = perm[q]; perm[q] = t;
+		}
+	}
+}
+
+
+void UniformSampler::NewScrambling( void )
+{
+	if( QmcDim == 0 ) return;
+
+	if( DirDim < QmcDim )
+	{
+		DirDim = QmcDim;
+		Dir.Resize( DirDim * SOBOL_BITS );
+		Shift.Resize( DirDim );
+	}
+
+	unsigned long v[ SOBOL_BITS ], rows[ SOBOL_BITS ];
+	Int_T k, r;
+
+	for( Int_T j = 0; j < QmcDim; j++ )
+	{
+		//----------------------------------------------------------------------
+		//	Direction numbers "v[k] = m_(k+1) / 2^(k+1)" (as 32 bit fractions).
+		//
+		if( j == 0 )
+			for( k = 0; k < SOBOL_BITS; k++ )
+				v[k] = 1UL << ( SOBOL_BITS - 1 - k );
+		else
+		{
+			const SobolInit &si = SobolTable[j-1];
+			Int_T s = 0;
+
+			while( ( si.Poly >> ( s + 1 ) ) != 0 ) s++;
+
+			unsigned long a = ( si.Poly >> 1 ) & ( ( 1UL << ( s - 1 ) ) - 1 );
+
+			for( k = 0; k < s && k < SOBOL_BITS; k++ )
+				v[k] = (unsigned long) si.M[k] << ( SOBOL_BITS - 1 - k );
+
+			for( k = s; k < SOBOL_BITS; k++ )
+			{
+				v[k] = v[k-s] ^ ( v[k-s] >> s );
+				for( Int_T i = 1; i < s; i++ )
+					if( ( a >> ( s - 1 - i ) ) & 1UL )
+						v[k] ^= v[k-i];
+			}
+		}
+
+		//----------------------------------------------------------------------
+		//	Random lower triangular matrix: row "r" gives the output digit "r"
+		//	(bit 31-r) as the parity of the input digits 0, ..., r.
+		//
+		for( r = 0; r < SOBOL_BITS; r++ )
+		{
+			unsigned long bit = 1UL << ( SOBOL_BITS - 1 - r );
+
+			rows[r] = bit | ( RandomWord() & ~( ( bit << 1 ) - 1 ) & WORD_MASK );
+		}
+
+		unsigned long *d = Dir.start + j * SOBOL_BITS;
+
+		for( k = 0; k < SOBOL_BITS; k++ )
+		{
+			unsigned long x = 0;
+
+			for( r = 0; r < SOBOL_BITS; r++ )
+				x |= Parity( v[k] & rows[r] ) << ( SOBOL_BITS - 1 - r );
+			d[k] = x;
+		}
+
+		Shift[j] = RandomWord();
+	}
+}
+
+
+unsigned long UniformSampler::RandomWord( void )
+{
+	return (unsigned long) ( Random01::Next() * 4294967296.0 ) & WORD_MASK;
+}
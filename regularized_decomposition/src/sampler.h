@@ -0,0 +1,141 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		General purpose mathematical module.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+HEADER FILE NAME:	sampler.h
+CREATED:			2026.10.18
+LAST MODIFIED:		2026.10.18
+
+DEPENDENCIES:		stdtype.h, smartptr.h, rand01.h
+
+--------------------------------------------------------------------------------
+
+HEADER CONTENTS:
+	Declaration of class "UniformSampler". An object of the class produces the
+uniform (0,1) random numbers from which the scenarios are sampled: one number
+per scenario and distribution. The numbers are produced in blocks of points;
+within a block they may be:
+	(1)	independent (plain Monte Carlo, "MC"; the numbers are taken directly
+		from "Random01", one at a time),
+	(2)	a Latin hypercube sample ("LHS"): in every dimension each of the
+		"points" equal strata of (0,1) gets exactly one point,
+	(3)	a randomized quasi-Monte Carlo sample ("RQMC"): the first points of
+		the Sobol sequence, scrambled (random linear scramble and digital
+		shift) anew for every block.
+	All randomness comes from "Random01" and is consumed in the same order
+whenever a block is regenerated from the same generator state. Thus the
+overlapping batches (see "Scenarios::ReGenerateScenarios()") stay consistent.
+	With antithetic variates the points of a block come in pairs: point "2k+1"
+is "1-u" where "u" is point "2k" (in every dimension). The even points form a
+block of the chosen kind of half the size.
+
+------------------------------------------------------------------------------*/
+
+#ifndef __SAMPLER_H__
+#define __SAMPLER_H__
+
+#ifndef __STDTYPE_H__
+#	include "stdtype.h"
+#endif
+#ifndef __SMARTPTR_H__
+#	include "smartptr.h"
+#endif
+#ifndef __RAND01_H__
+#	include "rand01.h"
+#endif
+
+//==============================================================================
+//
+//	Class "UniformSampler" declaration.
+//
+//==============================================================================
+
+class UniformSampler
+{
+public:
+	enum Method { MC, LHS, RQMC };
+
+	//--------------------------------------------------------------------------
+	//	Number of the dimensions for which the Sobol sequence is tabulated.
+	//	Further dimensions of a RQMC block are Latin hypercube sampled.
+	//
+	enum { SOBOL_DIM = 128, SOBOL_BITS = 32 };
+
+private:
+	Method Meth;
+	Int_T Points, Dim;			// Size of the current block.
+	Int_T QmcDim;				// Dimensions taken from the Sobol sequence.
+	Int_T PermLen, DirDim;		// Allocated lengths of "Perm" and "Shift".
+
+	Bool_T Anti;				// Antithetic pairs of points.
+	Int_T LastLen;				// Allocated length of "Last".
+	Array<Real_T> Last;			// [Dim] The last even point (antithetic
+								// variates only).
+
+	Array<Int_T> Perm;			// [Points*(Dim-QmcDim)] The LHS strata of the
+								// points (one permutation per dimension).
+	Array<unsigned long> Dir;	// [QmcDim*SOBOL_BITS] Scrambled direction
+								// numbers (modulo 2^32).
+	Array<unsigned long> Shift;	// [QmcDim] Digital shifts.
+
+private:
+	UniformSampler( const UniformSampler & );
+	UniformSampler &operator=( const UniformSampler & );
+
+	void NewPermutations( Int_T FirstDim );
+	void NewScrambling( void );
+	Real_T Draw( Int_T p, Int_T j );
+
+	static unsigned long RandomWord( void );
+
+public:
+	UniformSampler( void );
+	~UniformSampler( void );
+
+	void SetMethod( Method m );
+	Method GetMethod( void ) const;
+	void SetAntithetic( Bool_T a );
+	Bool_T GetAntithetic( void ) const;
+
+	void NewBlock( Int_T points, Int_T dim );
+	Real_T Next( Int_T p, Int_T j );
+};
+
+//==============================================================================
+//
+//	End of class "UniformSampler" declaration.
+//
+//==============================================================================
+
+
+inline
+void UniformSampler::SetMethod( Method m )
+{ Meth = m; }
+
+
+inline
+UniformSampler::Method UniformSampler::GetMethod( void )
+const
+{ return Meth; }
+
+
+inline
+void UniformSampler::SetAntithetic( Bool_T a )
+{ Anti = a; }
+
+
+inline
+Bool_T UniformSampler::GetAntithetic( void )
+const
+{ return Anti; }
+
+
+#endif
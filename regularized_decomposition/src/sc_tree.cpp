@@ -18,7 +18,7 @@ DEPENDENCIES:		sc_tree.h, extendar.h, error.h, smartptr.h, smartdcl.h,
 					sptr_ndb.h, myalloc.h, std_tmpl.h, sort_lab.h, stdtype.h,
 					simplex.h, solv_lp.h, compile.h, lp_codes.h, mps_lp.h,
 					std_math.h, periods.h, changelp.h, my_defs.h, lexer.h,
-					print.h
+					print.h, mps_out.h
 					<stdio.h>, <assert.h>
 
 --------------------------------------------------------------------------------
@@ -49,6 +49,9 @@ SOURCE FILE CONTENTS:
 #ifndef __MAKELAB_H__
 #	include "makelab.h"
 #endif
+#ifndef __MPS_OUT_H__
+#	include "mps_out.h"
+#endif
 
 
 #define INIT_SC		10
@@ -181,7 +184,7 @@ Bool_T ScenarioTree::ReadScenarioFile( FILE *fp, const char *fname, // )
 	if( ( PeriodNum = per.NumberOfPeriods() ) == 0 )
 		return False;
 
-	Lexer::SetInputStream( fname, fp );
+	Lex.SetInputStream( fname, fp );
 	Bool_T success = ReadFile( lp, per );
 
 	if( success )
@@ -463,13 +466,13 @@ SIDE EFFECTS:
 
 Bool_T ScenarioTree::GetScenarioSection( void )
 {
-	if( Lexer::GetKeyword( "SCENARIOS" ) )
+	if( Lex.GetKeyword( "SCENARIOS" ) )
 	{
-		if( !Lexer::GetSpace() || !Lexer::GetKeyword( "DISCRETE" ) )
+		if( !Lex.GetSpace() || !Lex.GetKeyword( "DISCRETE" ) )
 			Error( "File %s, line %d: 'DISCRETE' expected after 'SCENARIOS'",
-				Lexer::FileName, Lexer::LineNumber );
+				Lex.FileName, Lex.LineNumber );
 
-		Lexer::GetNewline( True );
+		Lex.GetNewline( True );
 
 		//----------------------------------------------------------------------
 		//	Read in loop the consecutive scenarios. The first line has to start
@@ -477,16 +480,16 @@ Bool_T ScenarioTree::GetScenarioSection( void )
 		//
 		Int_T  AttachAtPeriod = -1;
 
-		if( !Lexer::GetSpace() || !Lexer::GetKeyword( "SC" ) )
+		if( !Lex.GetSpace() || !Lex.GetKeyword( "SC" ) )
 		{
 			Error( "File %s, line %d: section 'SCENARIOS' should begin with "
-				"'SC'.", Lexer::FileName, Lexer::LineNumber );
+				"'SC'.", Lex.FileName, Lex.LineNumber );
 		}
 		else if( !GetScenarioIndicator( AttachAtPeriod ) )
 			return False;
 
-		while( Lexer::GetSpace() )
-			if( Lexer::GetKeyword( "SC" ) )
+		while( Lex.GetSpace() )
+			if( Lex.GetKeyword( "SC" ) )
 			{
 				if( !GetScenarioIndicator( AttachAtPeriod ) )
 					return False;
@@ -533,42 +536,42 @@ Bool_T ScenarioTree::GetScenarioIndicator( Int_T &AttachAtPeriod )
 	//
 	//	Still reading the first line.
 	//
-	if( !Lexer::GetSpace() || !Lexer::GetLabelFree( 0 ) ||
-		!Lexer::GetSpace() || !Lexer::GetLabelFree( 1 ) )
+	if( !Lex.GetSpace() || !Lex.GetLabelFree( 0 ) ||
+		!Lex.GetSpace() || !Lex.GetLabelFree( 1 ) )
 	{
 		Error( "File %s, line %d: Scenario and relative root labels expected.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex.FileName, Lex.LineNumber );
 		return False;
 	}
 
-	const char *ScLab	= Lexer::LabelPtr[0],
-		*RootLab		= Lexer::LabelPtr[1];
+	const char *ScLab	= Lex.LabelPtr[0],
+		*RootLab		= Lex.LabelPtr[1];
 
-	if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex.GetSpace() || !Lex.GetNumeric() )
 	{
 		Error( "File %s, line %d: Numeric value expected.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex.FileName, Lex.LineNumber );
 		return False;
 	}
 
-	const Real_T prob = Lexer::Number;
+	const Real_T prob = Lex.Number;
 
 	if( prob < 0.0 || prob > 1.0 )
 	{
 		Error( "File %s, line %d: Probability outside <0,1> range.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex.FileName, Lex.LineNumber );
 		ParseError = True;
 	}
 
-	if( !Lexer::GetSpace() || !Lexer::GetLabelFree( 0 ) )
+	if( !Lex.GetSpace() || !Lex.GetLabelFree( 0 ) )
 	{
 		Error( "File %s, line %d: Period label expected.",
-			Lexer::FileName, Lexer::LineNumber );
-		Lexer::GetNewline( True );
+			Lex.FileName, Lex.LineNumber );
+		Lex.GetNewline( True );
 		return False;
 	}
 
-	const char *PeriodLab	= Lexer::LabelPtr[0];
+	const char *PeriodLab	= Lex.LabelPtr[0];
 
 	//-------------------------------------------------------------------------
 	//	Now store the data that has just been read.
@@ -578,7 +581,7 @@ Bool_T ScenarioTree::GetScenarioIndicator( Int_T &AttachAtPeriod )
 	//-------------------------------------------------------------------------
 	//	Read in the new line and exit.
 	//
-	Lexer::GetNewline( True );
+	Lex.GetNewline( True );
 	return True;
 }
 
@@ -603,9 +606,9 @@ SIDE EFFECTS:
 
 void ScenarioTree::IgnoreTillEndOfSection( void )
 {
-	Lexer::GetNewline( True );
-	while( Lexer::GetSpace() )
-		Lexer::GetNewline( True );
+	Lex.GetNewline( True );
+	while( Lex.GetSpace() )
+		Lex.GetNewline( True );
 }
 
 
@@ -634,33 +637,33 @@ Bool_T ScenarioTree::GetScenarioEntry( Int_T AttachAtPeriod )
 	//-------------------------------------------------------------------------
 	//	Read the entry (one line).
 	//
-	if( !Lexer::GetLabelFree( 0 ) ||
-		!Lexer::GetSpace() || !Lexer::GetLabelFree( 1 ) )
+	if( !Lex.GetLabelFree( 0 ) ||
+		!Lex.GetSpace() || !Lex.GetLabelFree( 1 ) )
 	{
 		Error( "File %s, line %d: Two labels expected in scenario data line.",
-			Lexer::FileName, Lexer::LineNumber );
-		Lexer::GetNewline( True );
+			Lex.FileName, Lex.LineNumber );
+		Lex.GetNewline( True );
 		return False;
 	}
 
-	if( !Lexer::GetSpace() || !Lexer::GetNumeric() )
+	if( !Lex.GetSpace() || !Lex.GetNumeric() )
 	{
 		Error( "File %s, line %d: Value expected in scenario data line.",
-			Lexer::FileName, Lexer::LineNumber );
-		Lexer::GetNewline( True );
+			Lex.FileName, Lex.LineNumber );
+		Lex.GetNewline( True );
 		return False;
 	}
 
 	//-------------------------------------------------------------------------
 	//	Add the entry to the data structures.
 	//
-	const char *Column	= Lexer::LabelPtr[0],
-		*Row			= Lexer::LabelPtr[1];
-	const Real_T Val	= Lexer::Number;
+	const char *Column	= Lex.LabelPtr[0],
+		*Row			= Lex.LabelPtr[1];
+	const Real_T Val	= Lex.Number;
 
 	AddEntry( Column, Row, Val, AttachAtPeriod );
 
-	Lexer::GetNewline( True );
+	Lex.GetNewline( True );
 
 	return True;
 }
@@ -708,7 +711,7 @@ void ScenarioTree::AddNewScenario( const char *ScLab, const char *RootLab, // )
 		if( strcmp( RootLab, "ROOT" ) != 0 )
 		{
 			Error( "File %s, line %d: The first scenario must have ROOT as its "
-				"predecessor.", Lexer::FileName, Lexer::LineNumber );
+				"predecessor.", Lex.FileName, Lex.LineNumber );
 			ParseError = True;
 		}
 		RootNum			= 0;
@@ -722,7 +725,7 @@ void ScenarioTree::AddNewScenario( const char *ScLab, const char *RootLab, // )
 	if( RootNum < 0 )
 	{
 		Error( "File %s, line %d: Predecessor scenario not found.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex.FileName, Lex.LineNumber );
 		ParseError = True;
 		RootNum = 0;
 	}
@@ -743,7 +746,7 @@ void ScenarioTree::AddNewScenario( const char *ScLab, const char *RootLab, // )
 	if( AttachAtPeriod < 0 )
 	{
 		Error( "File %s, line %d: Invalid period label.",
-			Lexer::FileName, Lexer::LineNumber );
+			Lex.FileName, Lex.LineNumber );
 		ParseError = True;
 		AttachAtPeriod = 0;
 	}
@@ -865,7 +868,7 @@ void ScenarioTree::AddEntry( const char *Column, const char *Row, // )
 	assert( p >= 0 && p < PeriodNum );
 	if( p < AttachAtPeriod  )
 		Error( "File %s, line %d: Random data belongs to a period earlier"
-			"than declared.", Lexer::FileName, Lexer::LineNumber );
+			"than declared.", Lex.FileName, Lex.LineNumber );
 
 	if( NewCLP == NULL ) FatalError( "Out of memory. ");
 
@@ -904,12 +907,12 @@ void ScenarioTree::AddEntry( const char *Column, const char *Row, // )
 	//
 RowLabelNotFound:
 	Error( "File %s, line %d: Row label not found.",
-		Lexer::FileName, Lexer::LineNumber );
+		Lex.FileName, Lex.LineNumber );
 	goto End;
 
 ColLabelNotFound:
 	Error( "File %s, line %d: Column label not found.",
-		Lexer::FileName, Lexer::LineNumber );
+		Lex.FileName, Lex.LineNumber );
 	goto End;
 
 End:
@@ -1018,11 +1021,11 @@ void ScenarioTree::CalculateProbabilities( void )
 		const Periods &periods, Int_T CutAt, FILE *fpCOR, FILE *fpSTO,
 		FILE *fpTIM, VerbLevel Verbosity )
 
-	Bool_T ScenarioTree::OutputCORE( FILE *fp, SolvableLP &lp,
+	void ScenarioTree::OutputCORE( MPS_Output &Out, SolvableLP &lp,
 		const Periods &periods, Int_T CutAt, VerbLevel Verbosity ) const
-	Bool_T ScenarioTree::OutputTIME( FILE *fp, SolvableLP &lp,
+	void ScenarioTree::OutputTIME( MPS_Output &Out, SolvableLP &lp,
 		const Periods &periods, Int_T CutAt, VerbLevel Verbosity ) const
-	Bool_T ScenarioTree::OutputSTOCH( FILE *fp, SolvableLP &lp,
+	void ScenarioTree::OutputSTOCH( MPS_Output &Out, SolvableLP &lp,
 		const Periods &periods, Int_T CutAt, VerbLevel Verbosity ) const
 
 
@@ -1051,8 +1054,9 @@ PARAMETERS:
 		equivalent is to be produced, the last two streams may be omitted (NULL
 		pointers may be given instead of the real names).
 
-	FILE *fp
-		One of the above (different in each one of the last three functions).
+	MPS_Output &Out
+		Buffered output to one of the above (different in each one of the last
+		three functions).
 
 	VerbLevel Verbosity
 		Directs the level of verbosity (detail of possible reportig on the
@@ -1080,8 +1084,13 @@ const
 	//--------------------------------------------------------------------------
 	//	Output the CORE file.
 	//
-	if( !OutputCORE( fpCOR, lp, periods, CutAt, Verbosity ) )
-		return False;
+	{
+		MPS_Output Out( fpCOR );
+
+		OutputCORE( Out, lp, periods, CutAt, Verbosity );
+		if( !Out.Flush() )
+			return False;
+	}
 
 	//--------------------------------------------------------------------------
 	//	TIME and STOCH files are to be prodeuced only when a two stage
@@ -1095,20 +1104,25 @@ const
 	//--------------------------------------------------------------------------
 	//	Output the TIME file.
 	//
-	if( !OutputTIME( fpTIM, lp, periods, CutAt, Verbosity ) )
-		return False;
+	{
+		MPS_Output Out( fpTIM );
+
+		OutputTIME( Out, lp, periods, CutAt, Verbosity );
+		if( !Out.Flush() )
+			return False;
+	}
 
 	//--------------------------------------------------------------------------
 	//	Output the STOCH file.
 	//
-	if( !OutputSTOCH( fpSTO, lp, periods, CutAt, Verbosity ) )
-		return False;
+	MPS_Output Out( fpSTO );
 
-	return True;
+	OutputSTOCH( Out, lp, periods, CutAt, Verbosity );
+	return Out.Flush();
 }
 
 
-Bool_T ScenarioTree::OutputCORE( FILE *fp, SolvableLP &lp, // )
+void ScenarioTree::OutputCORE( MPS_Output &Out, SolvableLP &lp, // )
 	const Periods &periods, Int_T CutAt, VerbLevel Verbosity )
 const
 {
@@ -1118,8 +1132,7 @@ const
 	//--------------------------------------------------------------------------
 	//	Output the header line.
 	//
-	if( fprintf( fp, "%-14s%-8s\n", "NAME", lp.GetName() ) == EOF )
-		return False;
+	Out.Printf( "%-14s%-8s\n", "NAME", lp.GetName() );
 
 	//--------------------------------------------------------------------------
 	//	Output the ROWS section.
@@ -1127,8 +1140,7 @@ const
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting ROWS\n" );
 
-	if( !OutputROWS( fp, lp, periods, CutAt ) )
-		return False;
+	OutputROWS( Out, lp, periods, CutAt );
 
 	//--------------------------------------------------------------------------
 	//	Output the COLUMNS section.
@@ -1136,8 +1148,7 @@ const
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting COLUMNS\n" );
 
-	if( !OutputCOLUMNS( fp, lp, periods, CutAt ) )
-		return False;
+	OutputCOLUMNS( Out, lp, periods, CutAt );
 
 	//--------------------------------------------------------------------------
 	//	Section RHS output.
@@ -1145,8 +1156,7 @@ const
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting RHS\n" );
 
-	if( !OutputRHS( fp, lp, periods, CutAt ) )
-		return False;
+	OutputRHS( Out, lp, periods, CutAt );
 
 	//--------------------------------------------------------------------------
 	//	BOUNDS section.
@@ -1154,8 +1164,7 @@ const
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting BOUNDS\n" );
 
-	if( !OutputBOUNDS( fp, lp, periods, CutAt ) )
-		return False;
+	OutputBOUNDS( Out, lp, periods, CutAt );
 
 	//--------------------------------------------------------------------------
 	//	Write "ENDATA" and finish processing.
@@ -1163,14 +1172,11 @@ const
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting ENDATA\n" );
 
-	if( fprintf( fp, "ENDATA\n" ) == EOF )
-		return False;
-
-	return True;
+	Out.Text( "ENDATA\n" );
 }
 
 
-Bool_T ScenarioTree::OutputTIME( FILE *fp, SolvableLP &lp, // )
+void ScenarioTree::OutputTIME( MPS_Output &Out, SolvableLP &lp, // )
 	const Periods &periods, Int_T CutAt, VerbLevel Verbosity )
 const
 {
@@ -1180,23 +1186,17 @@ const
 	if( Verbosity >= V_HIGH )
 		Print( "\nWriting output TIME file.\n" );
 
-	if( fprintf( fp, "TIME          %s\nPERIODS       LP\n", lp.GetName() )
-			== EOF ||
-		fprintf( fp, "    %s", MakeLabel( 0, 0 ) ) == EOF ||
-		fprintf( fp, "  %s  %15s%-8s\n", MakeLabel( 0, 0 ), "", "TIME0" )
-			== EOF ||
-		fprintf( fp, "    %s", MakeLabel( (int)periods.FirstColumn(CutAt), 0 ) )
-			== EOF ||
-		fprintf( fp, "  %s  %15s%-8s\n", MakeLabel(
-			(int)periods.FirstRow(CutAt), 0 ), "", "TIME1" ) == EOF ||
-		fprintf( fp, "ENDATA\n" ) == EOF )
-		return False;
-
-	return True;
+	Out.Printf( "TIME          %s\nPERIODS       LP\n", lp.GetName() );
+	Out.Printf( "    %s", MakeLabel( 0, 0 ) );
+	Out.Printf( "  %s  %15s%-8s\n", MakeLabel( 0, 0 ), "", "TIME0" );
+	Out.Printf( "    %s", MakeLabel( (int)periods.FirstColumn(CutAt), 0 ) );
+	Out.Printf( "  %s  %15s%-8s\n", MakeLabel(
+		(int)periods.FirstRow(CutAt), 0 ), "", "TIME1" );
+	Out.Text( "ENDATA\n" );
 }
 
 
-Bool_T ScenarioTree::OutputSTOCH( FILE *fp, SolvableLP &lp, // )
+void ScenarioTree::OutputSTOCH( MPS_Output &Out, SolvableLP &lp, // )
 	const Periods &periods, Int_T CutAt, VerbLevel Verbosity )
 const
 {
@@ -1206,9 +1206,7 @@ const
 	if( Verbosity >= V_HIGH )
 		Print( "\nWriting output STOCH file.\n" );
 
-	if( fprintf( fp, "STOCH         %s\nBLOCKS        DISCRETE\n",
-		lp.GetName() ) == EOF )
-		return False;
+	Out.Printf( "STOCH         %s\nBLOCKS        DISCRETE\n", lp.GetName() );
 
 	//--------------------------------------------------------------------------
 	//	Loop on scenarios belonging to the first period which are expanded in
@@ -1223,20 +1221,16 @@ const
 		for( ; i < ScenNum && Structure[i][0][CutAt].scen == scen; i++ )
 			;
 
-		if( fprintf( fp, " BL BLOCK     TIME1           %f\n", prob ) == EOF )
-			return False;
+		Out.Printf( " BL BLOCK     TIME1           %f\n", prob );
 
-		OutputStochVectors( fp, CutAt, s0, i );
-		OutputStochMatrix( fp, lp, periods, CutAt, s0, i );
+		OutputStochVectors( Out, CutAt, s0, i );
+		OutputStochMatrix( Out, lp, periods, CutAt, s0, i );
 	}
 
 	//--------------------------------------------------------------------------
 	//	STOCH file: output ENDATA
 	//
-	if( fprintf( fp, "ENDATA\n" ) == EOF )
-		return False;
-
-	return True;
+	Out.Text( "ENDATA\n" );
 }
 
 
@@ -1290,13 +1284,13 @@ const
 
 /*------------------------------------------------------------------------------
 
-	Bool_T ScenarioTree::OutputROWS( FILE *fp, SolvableLP &lp,
+	void ScenarioTree::OutputROWS( MPS_Output &Out, SolvableLP &lp,
 		const Periods &periods, Int_T CutAt ) const
-	Bool_T ScenarioTree::OutputCOLUMNS( FILE *fp, SolvableLP &lp,
+	void ScenarioTree::OutputCOLUMNS( MPS_Output &Out, SolvableLP &lp,
 		const Periods &periods, Int_T CutAt ) const
-	Bool_T ScenarioTree::OutputRHS( FILE *fp, SolvableLP &lp,
+	void ScenarioTree::OutputRHS( MPS_Output &Out, SolvableLP &lp,
 		const Periods &periods, Int_T CutAt ) const
-	Bool_T ScenarioTree::OutputBOUNDS( FILE *fp, SolvableLP &lp,
+	void ScenarioTree::OutputBOUNDS( MPS_Output &Out, SolvableLP &lp,
 		const Periods &periods, Int_T CutAt ) const
 
 PURPOSE:
@@ -1306,7 +1300,7 @@ problem structure, while the above functions output whole blocks of the linear
 problem.
 
 PARAMETERS:
-	FILE *fp
+	MPS_Output &Out
 		Output file.
 
 	SolvableLP &lp
@@ -1320,23 +1314,24 @@ PARAMETERS:
 		from 1 to "PeriodNum" (inclusive).
 
 RETURN VALUE:
-	Boolean success status ("False" only on I/O errors).
+	None (output errors are reported by "MPS_Output::Flush()").
 
 SIDE EFFECTS:
 	None.
 
 ------------------------------------------------------------------------------*/
 
-Bool_T ScenarioTree::OutputROWS( FILE *fp, SolvableLP &lp, // )
+void ScenarioTree::OutputROWS( MPS_Output &Out, SolvableLP &lp, // )
 	const Periods &periods, Int_T CutAt  )
 const
 {
 	//--------------------------------------------------------------------------
 	//	The section indicator line and the objective row goes first.
 	//
-	if( ( fprintf( fp, "ROWS\n" ) == EOF ) ||
-		( fprintf( fp, " %c  %-8s\n", 'N', "COST" ) == EOF ) )
-		return False;
+	Out.Text( "ROWS\n" );
+	Out.Text( " N  " );
+	Out.Field( "COST" );
+	Out.NewLine();
 
 	//--------------------------------------------------------------------------
 	//	Then the remaining rows.
@@ -1358,43 +1353,39 @@ const
 
 			for( Int_T j = start; j < end; j++ )
 			{
-				char c = ' ';
+				const char *c = "    ";
 
 				switch( lp.GetRowType( j ) & RT_TYPE )
 				{
-				case RT_FR:	c = 'N'; break;
-				case RT_EQ:	c = 'E'; break;
-				case RT_GE:	c = 'G'; break;
-				case RT_LE:	c = 'L'; break;
+				case RT_FR:	c = " N  "; break;
+				case RT_EQ:	c = " E  "; break;
+				case RT_GE:	c = " G  "; break;
+				case RT_LE:	c = " L  "; break;
 				}
-				if( fprintf( fp, " %c  %-8s\n", c, MakeLabel( j, scen ) )
-					== EOF )
-					return False;
+				Out.Text( c );
+				Out.Field( MakeLabel( j, scen ) );
+				Out.NewLine();
 			}
 		}
 	}
-
-	return True;
 }
 
 
-Bool_T ScenarioTree::OutputCOLUMNS( FILE *fp, SolvableLP &lp, // )
+void ScenarioTree::OutputCOLUMNS( MPS_Output &Out, SolvableLP &lp, // )
 	const Periods &periods, Int_T CutAt  )
 const
 {
 	//--------------------------------------------------------------------------
 	//	The section indicator line goes first.
 	//
-	if( fprintf( fp, "%s\n", "COLUMNS" ) == EOF )
-		return False;
+	Out.Text( "COLUMNS\n" );
 
 	//--------------------------------------------------------------------------
 	//	First handle the 0'th (deterministic) period columns. Those columns are
 	//	to be output all at once.
 	//
-	if( !OutputCOLUMNSFromSubTree( fp, lp, periods, 0, PeriodNum, 0, ScenNum,
-		CutAt ) )
-		return False;
+	OutputCOLUMNSFromSubTree( Out, lp, periods, 0, PeriodNum, 0, ScenNum,
+		CutAt );
 
 	//--------------------------------------------------------------------------
 	//	Now the columns which will belong to the first stage problem.
@@ -1409,9 +1400,8 @@ const
 			for( ; i < ScenNum && Structure[i][0][p].scen == scen; i++ )
 				;
 
-			if( !OutputCOLUMNSFromSubTree( fp, lp, periods, p, CutAt, sStart, i,
-				CutAt ) )
-				return False;
+			OutputCOLUMNSFromSubTree( Out, lp, periods, p, CutAt, sStart, i,
+				CutAt );
 		}
 
 	//--------------------------------------------------------------------------
@@ -1428,18 +1418,15 @@ const
 			for( ; i < ScenMax && Structure[i][0][p].scen == scen; i++ )
 				;
 
-			if( !OutputCOLUMNSFromSubTree( fp, lp, periods, p, PeriodNum,
-				sStart, i, CutAt ) )
-				return False;
+			OutputCOLUMNSFromSubTree( Out, lp, periods, p, PeriodNum,
+				sStart, i, CutAt );
 		}
-
-	return True;
 }
 
 
-Bool_T ScenarioTree::OutputCOLUMNSFromSubTree( FILE *fp, SolvableLP &lp, // )
-	const Periods &periods, Int_T p0, Int_T p1, Int_T s0, Int_T s1,
-	Int_T CutAt )
+void ScenarioTree::OutputCOLUMNSFromSubTree( MPS_Output &Out, // )
+	SolvableLP &lp, const Periods &periods, Int_T p0, Int_T p1, Int_T s0,
+	Int_T s1, Int_T CutAt )
 const
 {
 	Int_T colStart, colEnd;
@@ -1474,9 +1461,7 @@ const
 		//
 		ApplyScenario( lp, sc, p0 );
 		if( IsNonZero( lp.GetC( j ) ) )
-			if( fprintf( fp, "    %-8s  %-8s  %12G\n", lab, "COST",
-				probability * lp.GetC( j ) ) == EOF )
-				return False;
+			Out.Entry( "    ", lab, "COST", probability * lp.GetC( j ) );
 
 		//----------------------------------------------------------------------
 		//	Now output the remaining column data (period by period).
@@ -1504,26 +1489,21 @@ const
 				lp.MPS_LP::GetColumn( j, a, row, len );
 				for( ; len; --len, ++a, ++row )
 					if( *row >= rowStart && *row < rowEnd )
-						if( fprintf( fp, "    %-8s  %-8s  %12G\n", lab,
-							MakeLabel( *row, scen ), *a ) == EOF )
-							return False;
+						Out.Entry( "    ", lab, MakeLabel( *row, scen ), *a );
 			}
 		}
 	}
-
-	return True;
 }
 
 
-Bool_T ScenarioTree::OutputRHS( FILE *fp, SolvableLP &lp, // )
+void ScenarioTree::OutputRHS( MPS_Output &Out, SolvableLP &lp, // )
 	const Periods &periods, Int_T CutAt  )
 const
 {
 	//--------------------------------------------------------------------------
 	//	The section indicator line goes first.
 	//
-	if( fprintf( fp, "%s\n", "RHS" ) == EOF )
-		return False;
+	Out.Text( "RHS\n" );
 
 	//--------------------------------------------------------------------------
 	//	Then the right hand sides of the whole problem.
@@ -1549,26 +1529,21 @@ const
 				Real_T b = lp.GetB( j );
 
 				if( IsNonZero( b ) )
-					if( fprintf( fp, "    %-8s  %-8s  %12G\n",
-						"RHS", MakeLabel( j, scen ), b ) == EOF )
-						return False;
+					Out.Entry( "    ", "RHS", MakeLabel( j, scen ), b );
 			}
 		}
 	}
-
-	return True;
 }
 
 
-Bool_T ScenarioTree::OutputBOUNDS( FILE *fp, SolvableLP &lp, // )
+void ScenarioTree::OutputBOUNDS( MPS_Output &Out, SolvableLP &lp, // )
 	const Periods &periods, Int_T CutAt  )
 const
 {
 	//--------------------------------------------------------------------------
 	//	The section indicator line goes first.
 	//
-	if( fprintf( fp, "BOUNDS\n" ) == EOF )
-		return False;
+	Out.Text( "BOUNDS\n" );
 
 	//--------------------------------------------------------------------------
 	//	Then the bounds for the consecutive columns.
@@ -1613,32 +1588,20 @@ const
 				//	Detect FREE variables.
 				//
 				if( !( vt & ( VT_LO | VT_UP ) ) )
-				{
-					if( fprintf( fp, " %2s %-8s  %-8s\n", "FR", "BND", lab )
-						== EOF )
-						return False;
-				}
+					Out.Entry( " FR ", "BND", lab );
 				//
 				//	Detect FIXED variables.
 				//
 				else if( vt == VT_FIXED )
-				{
-					if( fprintf( fp, " %2s %-8s  %-8s  %12G\n", "FX", "BND",
-						lab, lp.GetL( j ) ) == EOF )
-						return False;
-				}
+					Out.Entry( " FX ", "BND", lab, lp.GetL( j ) );
 				//
 				//	Detect non-positive (MI) variables.
 				//
 				else if( ( vt & VT_UP ) && !( vt & VT_LO ) )
 				{
-					if( fprintf( fp, " %2s %-8s  %-8s\n", "MI", "BND", lab )
-						== EOF )
-						return False;
+					Out.Entry( " MI ", "BND", lab );
 					if( IsNonZero( lp.GetU( j ) ) )
-						if( fprintf( fp, " %2s %-8s  %-8s  %12G\n", "UP", "BND",
-							lab, lp.GetU( j ) ) == EOF )
-							return False;
+						Out.Entry( " UP ", "BND", lab, lp.GetU( j ) );
 				}
 				//--------------------------------------------------------------
 				//	For all other variables print out non-zero lower bounds and
@@ -1647,26 +1610,20 @@ const
 				else
 				{
 					if( vt & VT_LO && IsNonZero( lp.GetL( j ) ) )
-						if( fprintf( fp, " %2s %-8s  %-8s  %12G\n", "LO", "BND",
-							lab, lp.GetL( j ) ) == EOF )
-							return False;
+						Out.Entry( " LO ", "BND", lab, lp.GetL( j ) );
 
 					if( vt & VT_UP )
-						if( fprintf( fp, " %2s %-8s  %-8s  %12G\n", "UP", "BND",
-							lab, lp.GetU( j ) ) == EOF )
-							return False;
+						Out.Entry( " UP ", "BND", lab, lp.GetU( j ) );
 				}
 			} // End of loop on columns in the given scenario/period pair.
 
 		} // End of loop on scenarios.
 	} // End of loop on periods
-
-	return True;
 }
 
 
-Bool_T ScenarioTree::OutputStochVectors( FILE *fp, Int_T p0, Int_T s0, // )
-	Int_T s1 )
+void ScenarioTree::OutputStochVectors( MPS_Output &Out, Int_T p0, // )
+	Int_T s0, Int_T s1 )
 const
 {
 	const Int_T mod = s1 - s0;
@@ -1691,11 +1648,11 @@ const
 				switch( (*clp)[j]->GetType() )
 				{
 				case ChangeLP::RHS:
-					(*clp)[j]->Write( fp, scen % mod, prob );
+					(*clp)[j]->Write( Out, scen % mod, prob );
 					break;
 
 				case ChangeLP::COST:
-					(*clp)[j]->Write( fp, scen % mod, prob );
+					(*clp)[j]->Write( Out, scen % mod, prob );
 					break;
 
 				case ChangeLP::MATRIX:
@@ -1705,12 +1662,10 @@ const
 					abort();
 				}
 		}
-
-	return True;
 }
 
 
-Bool_T ScenarioTree::OutputStochMatrix( FILE *fp, SolvableLP &lp, // )
+void ScenarioTree::OutputStochMatrix( MPS_Output &Out, SolvableLP &lp, // )
 	const Periods &periods, Int_T p0, Int_T s0, Int_T s1 )
 const
 {
@@ -1740,13 +1695,10 @@ const
 				lp.MPS_LP::GetColumn( j, a, row, len );
 				for( ; len; --len, ++a, ++row )
 					if( *row >= RowStart )
-						if( fprintf( fp, "    %-8s  %-8s  %12G\n", lab,
-							MakeLabel( *row, scen % mod ), *a ) == EOF )
-							return False;
+						Out.Entry( "    ", lab, MakeLabel( *row, scen % mod ),
+							*a );
 			}
 		}
-
-	return True;
 }
 
 
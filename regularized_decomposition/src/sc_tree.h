@@ -15,7 +15,8 @@ CREATED:			1996.01.20
 LAST MODIFIED:		1996.04.06
 
 DEPENDENCIES:		extendar.h, error.h, smartptr.h, smartdcl.h, sptr_ndb.h,
-					myalloc.h, std_tmpl.h, sort_lab.h, stdtype.h, simplex.h
+					myalloc.h, std_tmpl.h, sort_lab.h, stdtype.h, simplex.h,
+					lexer.h
 					<stdio.h>, <assert.h>
 
 --------------------------------------------------------------------------------
@@ -37,11 +38,15 @@ HEADER CONTENTS:
 #ifndef __SORT_LAB_H__
 #	include "sort_lab.h"
 #endif
+#ifndef __LEXER_H__
+#	include "lexer.h"
+#endif
 
 
 class Periods;
 class ChangeLP;
 class SolvableLP;
+class MPS_Output;
 
 
 class ScenarioTree
@@ -59,6 +64,8 @@ private:
 
 	ExtendArray<ExtendArray<ChangeLP *> *> StochasticData;
 
+	Lexer Lex;					// Lexical analyser for scenario file reading.
+
 private:
 	void Clean( void );
 	void PrintInfo( void );
@@ -81,28 +88,29 @@ private:
 	//--------------------------------------------------------------------------
 	//	Functions for problem output.
 	//
-	Bool_T OutputCORE( FILE *fp, SolvableLP &lp, const Periods &periods,
+	void OutputCORE( MPS_Output &Out, SolvableLP &lp, const Periods &periods,
 		Int_T CutAt, VerbLevel Verbosity ) const;
-	Bool_T OutputTIME( FILE *fp, SolvableLP &lp, const Periods &periods,
+	void OutputTIME( MPS_Output &Out, SolvableLP &lp, const Periods &periods,
 		Int_T CutAt, VerbLevel Verbosity ) const;
-	Bool_T OutputSTOCH( FILE *fp, SolvableLP &lp, const Periods &periods,
+	void OutputSTOCH( MPS_Output &Out, SolvableLP &lp, const Periods &periods,
 		Int_T CutAt, VerbLevel Verbosity ) const;
 
-	Bool_T OutputROWS( FILE *fp, SolvableLP &lp, const Periods &periods,
+	void OutputROWS( MPS_Output &Out, SolvableLP &lp, const Periods &periods,
 		Int_T ScenMax ) const;
-	Bool_T OutputCOLUMNS( FILE *fp, SolvableLP &lp, const Periods &periods,
-		Int_T ScenMax ) const;
-	Bool_T OutputCOLUMNSFromSubTree( FILE *fp, SolvableLP &lp,
+	void OutputCOLUMNS( MPS_Output &Out, SolvableLP &lp,
+		const Periods &periods, Int_T ScenMax ) const;
+	void OutputCOLUMNSFromSubTree( MPS_Output &Out, SolvableLP &lp,
 		const Periods &periods, Int_T p0, Int_T p1, Int_T s0, Int_T s1,
 		Int_T CutAt ) const;
-	Bool_T OutputRHS( FILE *fp, SolvableLP &lp, const Periods &periods,
-		Int_T ScenMax ) const;
-	Bool_T OutputBOUNDS( FILE *fp, SolvableLP &lp, const Periods &periods,
+	void OutputRHS( MPS_Output &Out, SolvableLP &lp, const Periods &periods,
 		Int_T ScenMax ) const;
+	void OutputBOUNDS( MPS_Output &Out, SolvableLP &lp,
+		const Periods &periods, Int_T ScenMax ) const;
 
-	Bool_T OutputStochVectors( FILE *fp, Int_T p0, Int_T s0, Int_T s1 ) const;
-	Bool_T OutputStochMatrix( FILE *fp, SolvableLP &lp, const Periods &periods,
-		Int_T p0, Int_T s0, Int_T s1 ) const;
+	void OutputStochVectors( MPS_Output &Out, Int_T p0, Int_T s0,
+		Int_T s1 ) const;
+	void OutputStochMatrix( MPS_Output &Out, SolvableLP &lp,
+		const Periods &periods, Int_T p0, Int_T s0, Int_T s1 ) const;
 
 	Real_T TotalProbability( Int_T scen, Int_T period, Int_T CutAt ) const;
 	Int_T HowManyNodeDuplicates( Int_T period ) const;
@@ -15,7 +15,7 @@ CREATED:			1994.07.27
 LAST MODIFIED:		1996.02.22
 
 DEPENDENCIES:		stdtype.h, smartptr.h, scenario.h, error.h, std_math.h,
-					lexer.h
+					lexer.h, sampler.h
 					<assert.h>, <stdlib.h>
 
 --------------------------------------------------------------------------------
@@ -166,48 +166,917 @@ SIDE EFFECTS:
 
 Distribution::~Distribution( void )
 {
+	for( Int_T c = 0; c < SampleChunks; c++ )
+		delete [] Samples[c];
+	if( Law != NULL )
+		delete Law;
+
+	if( Store != NULL )
+	{
+		delete Store;
+		return;
+	}
+
 	for( Int_T i = 0; i < len; i++ )
 	{
-		assert( block[i] != NULL );
-		delete block[i];
+		assert( block[i] != NULL );
+		delete block[i];
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void Distribution::Append( StochasticDataBlock *bl )
+
+PURPOSE:
+	Adds a new block to a stochastic data distribution stucture.
+
+PARAMETERS:
+	StochasticDataBlock *bl
+		A block to be appended to the distribution.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Distribution::Append( StochasticDataBlock *bl )
+{
+	assert( bl != NULL );
+	assert( len <= maxLen );
+
+	if( len == maxLen )
+	{
+		Int_T NewMaxLen = Max( Int_T( 3 * maxLen / 2 ), Int_T( maxLen + 10 ) );
+
+		block.Resize( NewMaxLen );
+		block.Fill( (StochasticDataBlock *)NULL, NewMaxLen, maxLen );
+		maxLen = NewMaxLen;
+	}
+
+	block[len++] = bl;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void Distribution::Attach( ScenarioStore *store )
+
+PURPOSE:
+	Makes the scenarios kept in a scenario store the blocks of the (so far
+empty) distribution. The distribution becomes the owner of the store.
+
+PARAMETERS:
+	ScenarioStore *store
+		A (normalized) store of scenarios.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Distribution::Attach( ScenarioStore *store )
+{
+	assert( store != NULL );
+	assert( len == 0 && Store == NULL );
+
+	Store = store;
+
+	PackedScenarioBlock *Blocks = Store->CreateBlocks();
+	Int_T n = Store->GetNumberOfScenarios();
+
+	block.Resize( maxLen = Max( n, Int_T( 1 ) ) );
+	for( len = 0; len < n; len++ )
+		block[len] = Blocks + len;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Int_T Distribution::Draw( Real_T prob ) const
+
+PURPOSE:
+	Chooses the block of the distribution which corresponds to a random number
+from the [0,1) range. The block probabilities have to be accumulated (see
+"Scenarios::CalculateAccumulatedProbabilities()"). Bisection is used, so even
+the distributions of millions of scenarios are sampled quickly.
+
+PARAMETERS:
+	Real_T prob
+		A random number.
+
+RETURN VALUE:
+	The number of the first block with accumulated probability greater than
+"prob" (or the length of the distribution, if there is none).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Int_T Distribution::Draw( Real_T prob )
+	const
+{
+	Int_T lo = 0, hi = len;
+
+	while( lo < hi )
+	{
+		Int_T mid = ( lo + hi ) / 2;
+
+		if( block[mid]->GetProbability() > prob )
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+
+	return lo;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void Distribution::SetLaw( ParametricLaw *law, Delta::DeltaType t,
+		Int_T r, Int_T c )
+
+PURPOSE:
+	Makes the (so far empty) distribution a continuous one. Its only block
+holds the expected value of the random datum. It is used as a template for the
+realizations (and by all functions which transform the distributions, e.g.
+"Scenarios::RenumberIndiceInScenarios()"). The distribution becomes the owner of
+the law.
+
+PARAMETERS:
+	ParametricLaw *law
+		The law of the random variable.
+
+	Delta::DeltaType t, Int_T r, Int_T c
+		The random datum.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Distribution::SetLaw( ParametricLaw *law, Delta::DeltaType t, Int_T r,
+	Int_T c )
+{
+	assert( law != NULL );
+	assert( len == 0 && Store == NULL && Law == NULL );
+
+	IndepStochVar *isv = new IndepStochVar( 1.0, t, r, c, law->Mean() );
+	if( isv == NULL ) FatalError( "Out of memory." );
+
+	Law = law;
+	Append( isv );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Int_T Distribution::Realize( Int_T s, Real_T u )
+	StochasticDataBlock &Distribution::GetBlock( Int_T s, Int_T j )
+	void Distribution::CopyRealization( Int_T s, Distribution &Src,
+		Int_T SrcScen )
+	IndepStochVar &Distribution::Realization( Int_T s )
+
+PURPOSE:
+	The first function chooses a realization of the random data for scenario
+number "s", given one random number "u" from the (0,1) range. A block of a
+discrete distribution is chosen (see "Draw()") and its number is returned. For
+a continuous distribution a value is computed and stored in the realization
+buffer (the previous value held there for scenario "s" is overwritten). Zero is
+returned then.
+	The second function returns the block chosen for scenario "s": block "j"
+of a discrete distribution or the realization of a continuous one. The third
+one copies a realization of scenario "SrcScen" of another (identical)
+distribution.
+	The last one gives access to the buffer slot for scenario "s". The buffer
+is extended as needed, in chunks which are never moved (the scenarios point to
+them).
+
+PARAMETERS:
+	Int_T s
+		Scenario number.
+
+	Real_T u
+		A random number.
+
+	Int_T j
+		Block number (returned earlier by "Realize()").
+
+	Distribution &Src, Int_T SrcScen
+		Source distribution and scenario number.
+
+RETURN VALUE:
+	See above.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Int_T Distribution::Realize( Int_T s, Real_T u )
+{
+	if( Law == NULL )
+	{
+		Int_T j = Draw( u );
+
+		assert( j < len );
+		return j;
+	}
+
+	assert( len == 1 );
+
+	IndepStochVar &isv		= Realization( s );
+	const Delta &Template	= (*block[0])[0];
+
+	isv.type	= Template.type;
+	isv.row		= Template.row;
+	isv.col		= Template.col;
+	isv.value	= Law->Quantile( u );
+
+	return 0;
+}
+
+
+StochasticDataBlock &Distribution::GetBlock( Int_T s, Int_T j )
+{
+	if( Law == NULL )
+	{
+		assert( j >= 0 && j < len );
+		return *block[j];
+	}
+
+	assert( s >= 0 && s / SAMPLE_CHUNK_LEN < SampleChunks );
+	return Realization( s );
+}
+
+
+void Distribution::CopyRealization( Int_T s, Distribution &Src, // )
+	Int_T SrcScen )
+{
+	if( Law == NULL ) return;
+
+	assert( Src.Law != NULL );
+
+	const IndepStochVar &src	= Src.Realization( SrcScen );
+	IndepStochVar &dst			= Realization( s );
+
+	dst.type	= src.type;
+	dst.row		= src.row;
+	dst.col		= src.col;
+	dst.value	= src.value;
+}
+
+
+IndepStochVar &Distribution::Realization( Int_T s )
+{
+	assert( s >= 0 );
+
+	Int_T c = s / SAMPLE_CHUNK_LEN;
+
+	if( c >= SampleChunks )
+	{
+		Samples.Resize( c + 1 );
+
+		for( ; SampleChunks <= c; SampleChunks++ )
+		{
+			Samples[SampleChunks] = new IndepStochVar[ SAMPLE_CHUNK_LEN ];
+			if( Samples[SampleChunks] == NULL ) FatalError( "Out of memory." );
+		}
+	}
+
+	return Samples[c][ s % SAMPLE_CHUNK_LEN ];
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void Distribution::UpdateRealizations( void )
+	void Distribution::ScaleRealizations( Real_T div )
+
+PURPOSE:
+	Keep the realizations of a continuous distribution which were already drawn
+consistent with its template block. The first function copies the (renumbered)
+indice from the template. The second one scales the law and the realizations of
+a random cost by a positive factor (the template is scaled by the caller).
+
+PARAMETERS:
+	Real_T div
+		Scaling factor.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Distribution::UpdateRealizations( void )
+{
+	if( Law == NULL ) return;
+
+	const Delta &Template = (*block[0])[0];
+
+	for( Int_T c = 0; c < SampleChunks; c++ )
+		for( Int_T i = 0; i < SAMPLE_CHUNK_LEN; i++ )
+		{
+			IndepStochVar &isv = Samples[c][i];
+
+			isv.type	= Template.type;
+			isv.row		= Template.row;
+			isv.col		= Template.col;
+		}
+}
+
+
+void Distribution::ScaleRealizations( Real_T div )
+{
+	if( Law == NULL || (*block[0])[0].type != Delta::COST ) return;
+
+	Law->Scale( div );
+
+	for( Int_T c = 0; c < SampleChunks; c++ )
+		for( Int_T i = 0; i < SAMPLE_CHUNK_LEN; i++ )
+			Samples[c][i].value *= div;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	ParametricLaw::ParametricLaw( LawType t, Real_T p1, Real_T p2 )
+
+PURPOSE:
+	Constructs a continuous law. The parameters follow the SMPS convention:
+	UNIFORM		- the lower and the upper end of the interval,
+	NORMAL		- the mean and the variance,
+	LOGNORMAL	- the mean and the variance of the logarithm of the variable.
+The caller is responsible for checking that the parameters make sense.
+
+PARAMETERS:
+	LawType t
+		Type of the law.
+
+	Real_T p1, Real_T p2
+		Parameters (see above).
+
+RETURN VALUE:
+	Not applicable.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+ParametricLaw::ParametricLaw( LawType t, Real_T p1, Real_T p2 )
+	: Type( t ), P1( p1 ), P2( p2 )
+{
+	assert( t != DISCRETE );
+	assert( t != UNIFORM || p1 <= p2 );
+	assert( t == UNIFORM || p2 >= 0.0 );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Real_T ParametricLaw::Quantile( Real_T u ) const
+	Real_T ParametricLaw::Mean( void ) const
+	void ParametricLaw::Scale( Real_T div )
+	void ParametricLaw::GetParameters( LawType &t, Real_T &p1, Real_T &p2 )
+		const
+
+PURPOSE:
+	The first function computes the value of the inverse distribution function
+at "u" (so that a uniformly distributed "u" gives a realization of the random
+variable). The second one computes the expected value. The third one changes
+the parameters so that the law describes the variable multiplied by a positive
+factor "div". The last one reveals the type and the parameters of the law.
+
+PARAMETERS:
+	Real_T u
+		A number from the (0,1) range.
+
+	Real_T div
+		Scaling factor.
+
+RETURN VALUE:
+	See above.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Real_T ParametricLaw::Quantile( Real_T u )
+	const
+{
+	switch( Type )
+	{
+	case UNIFORM:
+		return P1 + u * ( P2 - P1 );
+
+	case NORMAL:
+		return P1 + sqrt( P2 ) * NormalQuantile( u );
+
+	case LOGNORMAL:
+		return exp( P1 + sqrt( P2 ) * NormalQuantile( u ) );
+
+	default:
+#ifndef NDEBUG
+		abort();
+#endif
+		break;
+	}
+
+	return 0.0;
+}
+
+
+Real_T ParametricLaw::Mean( void )
+	const
+{
+	switch( Type )
+	{
+	case UNIFORM:
+		return 0.5 * ( P1 + P2 );
+
+	case NORMAL:
+		return P1;
+
+	case LOGNORMAL:
+		return exp( P1 + 0.5 * P2 );
+
+	default:
+#ifndef NDEBUG
+		abort();
+#endif
+		break;
+	}
+
+	return 0.0;
+}
+
+
+void ParametricLaw::Scale( Real_T div )
+{
+	assert( div > 0.0 );
+
+	switch( Type )
+	{
+	case UNIFORM:
+		P1 *= div;
+		P2 *= div;
+		break;
+
+	case NORMAL:
+		P1 *= div;
+		P2 *= div * div;
+		break;
+
+	case LOGNORMAL:
+		P1 += log( div );
+		break;
+
+	default:
+#ifndef NDEBUG
+		abort();
+#endif
+		break;
+	}
+}
+
+
+void ParametricLaw::GetParameters( LawType &t, Real_T &p1, Real_T &p2 )
+	const
+{
+	t	= Type;
+	p1	= P1;
+	p2	= P2;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Real_T ParametricLaw::NormalQuantile( Real_T u )
+
+PURPOSE:
+	Computes the inverse of the standard normal distribution function. The
+rational approximation of P. J. Acklam is used (relative error below 1.2e-9):
+one function for the central region and another one for the tails.
+
+PARAMETERS:
+	Real_T u
+		A number from the (0,1) range.
+
+RETURN VALUE:
+	The quantile (plus or minus INFINITY at the ends of the range).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Real_T ParametricLaw::NormalQuantile( Real_T u )
+{
+	static const double
+		a[6] = {	-3.969683028665376e+01,	 2.209460984245205e+02,
+					-2.759285104469687e+02,	 1.383577518672690e+02,
+					-3.066479806614716e+01,	 2.506628277459239e+00 },
+		b[5] = {	-5.447609879822406e+01,	 1.615858368580409e+02,
+					-1.556989798598866e+02,	 6.680131188771972e+01,
+					-1.328068155288572e+01 },
+		c[6] = {	-7.784894002430293e-03,	-3.223964580411365e-01,
+					-2.400758277161838e+00,	-2.549732539343734e+00,
+					 4.374664141464968e+00,	 2.938163982698783e+00 },
+		d[4] = {	 7.784695709041462e-03,	 3.224671290700398e-01,
+					 2.445134137142996e+00,	 3.754408661907416e+00 };
+	static const double Low = 0.02425;
+
+	if( u <= 0.0 ) return -INFINITY;
+	if( u >= 1.0 ) return +INFINITY;
+
+	if( u < Low || u > 1.0 - Low )
+	{
+		//
+		//	Tails.
+		//
+		double q = sqrt( -2.0 * log( ( u < Low ) ? u : 1.0 - u ) ),
+			x = ( ( ( ( ( c[0] * q + c[1] ) * q + c[2] ) * q + c[3] ) * q +
+				c[4] ) * q + c[5] ) /
+				( ( ( ( d[0] * q + d[1] ) * q + d[2] ) * q + d[3] ) * q + 1.0 );
+
+		return ( u < Low ) ? x : -x;
+	}
+	else
+	{
+		//
+		//	Central region.
+		//
+		double q = u - 0.5,
+			r = q * q;
+
+		return ( ( ( ( ( a[0] * r + a[1] ) * r + a[2] ) * r + a[3] ) * r +
+			a[4] ) * r + a[5] ) * q /
+			( ( ( ( ( b[0] * r + b[1] ) * r + b[2] ) * r + b[3] ) * r +
+			b[4] ) * r + 1.0 );
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	ScenarioStore::ScenarioStore( void )
+	ScenarioStore::~ScenarioStore( void )
+
+PURPOSE:
+	Constructor and destructor of the scenario store.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	Not applicable.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+ScenarioStore::ScenarioStore( void )
+	: ScenNum( 0 ), MaxScenNum( INIT_SCEN_NUM ),
+	Start( INIT_SCEN_NUM + 1, 0 ), Prob( INIT_SCEN_NUM, 0.0 ),
+	DeltaNum( 0 ), MaxDeltaNum( INIT_DELTA_NUM ), Deltas( INIT_DELTA_NUM ),
+	Names( new SortedArrayOfLabels( INIT_SCEN_NUM ) ), Inherited( 0 ),
+	Blocks( NULL )
+{
+	if( Names == NULL ) FatalError( "Out of memory." );
+}
+
+
+ScenarioStore::~ScenarioStore( void )
+{
+	if( Names != NULL ) delete Names;
+	if( Blocks != NULL ) delete [] Blocks;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T ScenarioStore::NewScenario( const char *Name, const char *Parent,
+		Real_T prob )
+	void ScenarioStore::Append( const Delta &d )
+
+PURPOSE:
+	The first function starts a new scenario. Unless the parent is "ROOT", the
+scenario begins as a copy of its parent scenario. The other function adds a
+delta to the current scenario. A delta of the same entry copied from the parent
+is overwritten instead.
+
+PARAMETERS:
+	const char *Name, const char *Parent
+		Scenario name and the name of its parent scenario.
+
+	Real_T prob
+		Scenario probability.
+
+	const Delta &d
+		A delta (random datum).
+
+RETURN VALUE:
+	The first function returns "False" if the parent scenario is unknown (the
+scenario is started anyway, as if the parent were "ROOT").
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Bool_T ScenarioStore::NewScenario( const char *Name, const char *Parent, // )
+	Real_T prob )
+{
+	assert( Names != NULL && Blocks == NULL );
+
+	if( ScenNum == MaxScenNum )
+	{
+		MaxScenNum = Max( Int_T( 2 * MaxScenNum ), Int_T( INIT_SCEN_NUM ) );
+		Start.Resize( MaxScenNum + 1 );
+		Prob.Resize( MaxScenNum );
+	}
+
+	Int_T p = ( strcmp( Parent, "ROOT" ) == 0 ) ? -1 :
+		Names->FindLabel( Parent );
+
+	Names->AddLabel( Name );
+	Prob[ScenNum]		= prob;
+	Start[ScenNum]		= DeltaNum;
+	Start[++ScenNum]	= DeltaNum;
+	Inherited			= 0;
+
+	if( p < 0 )
+		return Bool_T( strcmp( Parent, "ROOT" ) == 0 );
+
+	//--------------------------------------------------------------------------
+	//	Copy the parent's deltas.
+	//
+	Inherited = Len( p );
+	ExtendDeltas( DeltaNum + Inherited );
+
+	for( Int_T k = Start[p], e = Start[p+1]; k < e; k++ )
+		Deltas[DeltaNum++] = Deltas[k];
+	Start[ScenNum] = DeltaNum;
+
+	return True;
+}
+
+
+void ScenarioStore::Append( const Delta &d )
+{
+	assert( ScenNum > 0 && Blocks == NULL );
+
+	for( Int_T k = Start[ScenNum-1], e = k + Inherited; k < e; k++ )
+		if( CmpKeys( Deltas[k], d ) == 0 )
+		{
+			Deltas[k].value = d.value;
+			return;
+		}
+
+	ExtendDeltas( DeltaNum + 1 );
+	Deltas[DeltaNum++]	= d;
+	Start[ScenNum]		= DeltaNum;
+}
+
+
+void ScenarioStore::ExtendDeltas( Int_T MinLen )
+{
+	if( MinLen <= MaxDeltaNum ) return;
+
+	while( MaxDeltaNum < MinLen )
+		MaxDeltaNum *= 2;
+	Deltas.Resize( MaxDeltaNum );
+}
+
+
+int ScenarioStore::CmpKeys( const Delta &d1, const Delta &d2 )
+{
+	if( d1.type != d2.type )	return ( d1.type < d2.type ) ? -1 : 1;
+	if( d1.row != d2.row )		return ( d1.row < d2.row ) ? -1 : 1;
+	if( d1.col != d2.col )		return ( d1.col < d2.col ) ? -1 : 1;
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void ScenarioStore::Normalize( const DeterministicLP &LP )
+
+PURPOSE:
+	All blocks of a distribution have to hold the same deltas in the same
+order (see e.g. "Distribution::CalculateExpectedValue()"). This is usually so
+in a SCENARIOS section: every scenario lists all random data. When it is not,
+the scenarios are rewritten so that each of them holds every datum which is
+random in any of them. The missing values are taken from the core problem.
+
+PARAMETERS:
+	const DeterministicLP &LP
+		The core (deterministic) problem.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	Scenario names are discarded.
+
+------------------------------------------------------------------------------*/
+
+void ScenarioStore::Normalize( const DeterministicLP &LP )
+{
+	assert( Blocks == NULL );
+
+	if( Names != NULL )
+	{
+		delete Names;
+		Names = NULL;
+	}
+
+	if( ScenNum == 0 ) return;
+
+	//--------------------------------------------------------------------------
+	//	The usual case: all scenarios look like the first one.
+	//
+	Int_T s, k, K = Len( 0 );
+	Bool_T Uniform = True;
+
+	for( s = 1; s < ScenNum && Uniform; s++ )
+		if( Len( s ) != K )
+			Uniform = False;
+		else
+			for( k = 0; k < K && Uniform; k++ )
+				if( CmpKeys( Entry( s, k ), Entry( 0, k ) ) != 0 )
+					Uniform = False;
+
+	if( Uniform )
+	{
+		Deltas.Resize( MaxDeltaNum = Max( DeltaNum, Int_T( 1 ) ) );
+		return;
+	}
+
+	//--------------------------------------------------------------------------
+	//	Collect the union of the data in the order of appearance. "Order"
+	//	keeps them sorted (for bisection).
+	//
+	Int_T KeyNum = 0, MaxKeyNum = Max( K, Int_T( 16 ) );
+	Array<Delta> Keys( MaxKeyNum );
+	Array<Int_T> Order( MaxKeyNum );
+
+	for( k = 0; k < DeltaNum; k++ )
+	{
+		const Delta &d = Deltas[k];
+		Int_T lo = 0, hi = KeyNum;
+
+		while( lo < hi )
+		{
+			Int_T mid	= ( lo + hi ) / 2;
+			int cmp		= CmpKeys( Keys[ Order[mid] ], d );
+
+			if( cmp == 0 )		lo = hi = -1;
+			else if( cmp < 0 )	lo = mid + 1;
+			else				hi = mid;
+		}
+		if( lo < 0 ) continue;
+
+		if( KeyNum == MaxKeyNum )
+		{
+			MaxKeyNum *= 2;
+			Keys.Resize( MaxKeyNum );
+			Order.Resize( MaxKeyNum );
+		}
+
+		for( Int_T j = KeyNum; j > lo; j-- )
+			Order[j] = Order[j-1];
+		Order[lo]		= KeyNum;
+		Keys[KeyNum]	= d;
+		Keys[KeyNum++].value = CoreValue( LP, d );
+	}
+
+	//--------------------------------------------------------------------------
+	//	Rewrite the scenarios: start with the core values, overwrite those
+	//	given in the scenario.
+	//
+	Array<Delta> Packed( ScenNum * KeyNum );
+
+	for( s = 0; s < ScenNum; s++ )
+	{
+		Int_T Base = s * KeyNum;
+
+		for( k = 0; k < KeyNum; k++ )
+			Packed[ Base + k ] = Keys[k];
+
+		for( k = 0; k < Len( s ); k++ )
+		{
+			const Delta &d = Entry( s, k );
+			Int_T lo = 0, hi = KeyNum - 1;
+
+			while( lo < hi )
+			{
+				Int_T mid = ( lo + hi ) / 2;
+
+				if( CmpKeys( Keys[ Order[mid] ], d ) < 0 )
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			assert( CmpKeys( Keys[ Order[lo] ], d ) == 0 );
+			Packed[ Base + Order[lo] ].value = d.value;
+		}
+	}
+
+	DeltaNum = MaxDeltaNum = ScenNum * KeyNum;
+	Deltas.Resize( DeltaNum );
+	for( k = 0; k < DeltaNum; k++ )
+		Deltas[k] = Packed[k];
+
+	for( s = 0; s <= ScenNum; s++ )
+		Start[s] = s * KeyNum;
+}
+
+
+Real_T ScenarioStore::CoreValue( const DeterministicLP &LP, const Delta &d )
+{
+	Int_T row = -1;
+
+	switch( d.type )
+	{
+	case Delta::RHS:	return LP.GetB( d.row );
+	case Delta::COST:	row = LP.GetCostRow();	break;
+	case Delta::MATRIX:	row = d.row;			break;
+	default:
+#ifndef NDEBUG
+		abort();
+#endif
+		return 0.0;
 	}
+
+	Ptr<Real_T> a;
+	Ptr<Int_T> ind;
+	Int_T l;
+
+	LP.GetColumn( d.col, a, ind, l );
+	for( Int_T i = 0; i < l; i++, ++a, ++ind )
+		if( *ind == row )
+			return *a;
+
+	return 0.0;
 }
 
 
 /*------------------------------------------------------------------------------
 
-	void Distribution::Append( StochasticDataBlock *bl )
+	PackedScenarioBlock *ScenarioStore::CreateBlocks( void )
 
 PURPOSE:
-	Adds a new block to a stochastic data distribution stucture.
+	Creates the views of all scenarios (to be put in a distribution). Each
+view carries the probability of its scenario.
 
 PARAMETERS:
-	StochasticDataBlock *bl
-		A block to be appended to the distribution.
+	None.
 
 RETURN VALUE:
-	None.
+	An array of "GetNumberOfScenarios()" blocks (owned by the store), or NULL
+if the store is empty.
 
 SIDE EFFECTS:
 	None.
 
 ------------------------------------------------------------------------------*/
 
-void Distribution::Append( StochasticDataBlock *bl )
+PackedScenarioBlock *ScenarioStore::CreateBlocks( void )
 {
-	assert( bl != NULL );
-	assert( len <= maxLen );
+	assert( Blocks == NULL );
 
-	if( len == maxLen )
-	{
-		Int_T NewMaxLen = Max( Int_T( 3 * maxLen / 2 ), Int_T( maxLen + 10 ) );
+	if( ScenNum == 0 ) return NULL;
 
-		block.Resize( NewMaxLen );
-		block.Fill( (StochasticDataBlock *)NULL, NewMaxLen, maxLen );
-		maxLen = NewMaxLen;
+	Blocks = new PackedScenarioBlock[ ScenNum ];
+	if( Blocks == NULL ) FatalError( "Out of memory." );
+
+	for( Int_T s = 0; s < ScenNum; s++ )
+	{
+		Blocks[s].Attach( this, s );
+		Blocks[s].SetProbability( Prob[s] );
 	}
+	Prob.Resize( 0 );
 
-	block[len++] = bl;
+	return Blocks;
 }
 
 
@@ -230,8 +1099,12 @@ SIDE EFFECTS:
 ------------------------------------------------------------------------------*/
 
 Scenarios::Scenarios( void )
-	: ScenNum( 0 ), ArrayOfScenarios(), status( EMPTY ),
+	: ScenNum( 0 ), IndexWidth( 1 ), Indices(), ScenProb(),
+	ArrayOfScenarios( CACHED_SCEN_NUM + SPARE_SCEN_NUM, (Scenario *)NULL ),
+	CachedScen( CACHED_SCEN_NUM + SPARE_SCEN_NUM, -1 ), NextSpare( 0 ),
+	status( EMPTY ),
 
+	CoreLP( NULL ),
 	RowLabels( NULL ),		ColumnLabels( NULL ),
 	ProblemName( NULL ),	RHS_Name( NULL ),
 	ObjName( NULL ),		BoundsName( NULL ),
@@ -239,14 +1112,14 @@ Scenarios::Scenarios( void )
 	ProblemNameLen( -1 ),	RHS_NameLen( -1 ),
 	ObjNameLen( -1 ),		BoundsNameLen( -1 ),
 	RangesNameLen( -1 ),
-	SemanticError( False ),
+	SemanticError( False ),	StochLex( NULL ),
 
 	len( 0 ), maxLen( INIT_DIST_NUM ),
 	dist( maxLen, (Distribution *)NULL ),
-	MaxScen( 0.0 ),
+	MaxScen( 0.0 ), Accumulated( False ),
 
 	LastStochBlockType( NONE ), LastIndepDiscrete(),
-	LastBlock( NULL )
+	LastBlock( NULL ), LastStore( NULL )
 {
 	LastBlockName[0] = '\0';
 }
@@ -281,6 +1154,7 @@ void Scenarios::Cleanup( void )
 	//--------------------------------------------------------------------------
 	//	Clear all data regarding the deterministic linear problem.
 	//
+	CoreLP			= NULL;
 	RowLabels		= ColumnLabels	= NULL;
 	ProblemName		= RHS_Name		= ObjName		= BoundsName	=
 		RangesName		= NULL;
@@ -288,12 +1162,24 @@ void Scenarios::Cleanup( void )
 		RangesNameLen	= -1;
 	SemanticError	= False;
 
+	if( LastStore != NULL )
+	{
+		delete LastStore;
+		LastStore = NULL;
+	}
+
 	//--------------------------------------------------------------------------
-	//	Free the array of scenarios.
+	//	Free the scenarios (and the scenario objects).
 	//
-	for( Int_T i = 0; i < ScenNum; i++ )
-		if( ArrayOfScenarios[i] != NULL ) delete ArrayOfScenarios[i];
-	ArrayOfScenarios.Resize( 0 );
+	for( Int_T i = 0; i < CACHED_SCEN_NUM + SPARE_SCEN_NUM; i++ )
+		if( ArrayOfScenarios[i] != NULL )
+		{
+			delete ArrayOfScenarios[i];
+			ArrayOfScenarios[i] = NULL;
+		}
+	CachedScen.Fill( -1, CACHED_SCEN_NUM + SPARE_SCEN_NUM );
+	Indices.Resize( 0 );
+	ScenProb.Resize( 0 );
 
 	//--------------------------------------------------------------------------
 	//	Re-initialize data describing the dimension of scenario space.
@@ -388,6 +1274,39 @@ void Scenarios::AppendLastBlock( void )
 }
 
 
+/*------------------------------------------------------------------------------
+
+	void Scenarios::AppendLastStore( void )
+
+PURPOSE:
+	This function completes the distribution read from the last SCENARIOS
+DISCRETE section: the scenario store is normalized and attached to the current
+distribution.
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Scenarios::AppendLastStore( void )
+{
+	if( LastStore == NULL ) return;
+
+	assert( dist[len-1] != NULL );
+	assert( CoreLP != NULL );
+
+	LastStore->Normalize( *CoreLP );
+	dist[len-1]->Attach( LastStore );
+	LastStore = NULL;
+}
+
+
 /*------------------------------------------------------------------------------
 
 	Bool_T Scenarios::ReadScenarioFile( const char *StochFileName,
@@ -422,6 +1341,7 @@ Bool_T Scenarios::ReadScenarioFile( const char *StochFileName, // )
 	//--------------------------------------------------------------------------
 	//	Initialize object data concerning the deterministic linear problem.
 	//
+	CoreLP = &DeterministicMatrix;
 	RowLabels = &( DeterministicMatrix.RevealRowLabels() );
 	ColumnLabels = &( DeterministicMatrix.RevealColumnLabels() );
 
@@ -454,7 +1374,17 @@ Bool_T Scenarios::ReadScenarioFile( const char *StochFileName, // )
 	//--------------------------------------------------------------------------
 	//	Read in the stoch file.
 	//
-	if( !GetStochFile( StochFileName, StochFilePtr, this ) || SemanticError )
+	Lexer Lex;
+
+	Lex.SetInputStream( StochFileName, StochFilePtr );
+	StochLex = &Lex;
+
+	Bool_T Read = GetStochFile( Lex, this );
+
+	StochLex	= NULL;
+	CoreLP		= NULL;
+
+	if( !Read || SemanticError )
 	{
 #ifndef NDEBUG
 		CheckArrayOfDistributions();
@@ -488,6 +1418,9 @@ Bool_T Scenarios::ReadScenarioFile( const char *StochFileName, // )
 
 	void Scenarios::NewIndepDiscreteEntry( const char *Row, const char *Col,
 		const char *PeriodLabel, double Val, double Prob )
+	void Scenarios::NewIndepParametricEntry( const char *Row,
+		const char *Col, const char *PeriodLabel, ParametricLaw::LawType Type,
+		double P1, double P2 )
 	void Scenarios::NewBlocksDiscrete( const char *BlockName,
 		const char *PeriodLabel, Real_T Prob )
 	void Scenarios::NewBlocksDiscreteEntry( const char *Row, const char *Col,
@@ -499,8 +1432,10 @@ Bool_T Scenarios::ReadScenarioFile( const char *StochFileName, // )
 PURPOSE:
 	The first function processes data from a single line of the "INDEP DISCRETE"
 section of the stochastic data file at a time. It produces a probability
-distribution for one stochastic datum.
-	The second one is called when the begining of a new block is encountered in
+distribution for one stochastic datum. The second one does the same for the
+"INDEP UNIFORM", "INDEP NORMAL" and "INDEP LOGNORM" sections; only the
+parameters of the distribution are stored.
+	The next one is called when the begining of a new block is encountered in
 while reading the BLOCKS DISCRETE section of the stochastic data file. The third
 one processes one entry of one block at a time.
 	The fourth one is used by two of the wprevoiusly mentioned ones to convert
@@ -522,6 +1457,9 @@ PARAMETERS:
 	double Val, double Prob
 		Value its probability.
 
+	ParametricLaw::LawType Type, double P1, double P2
+		Type of a continuous distribution and its parameters.
+
 	Delta::DeltaType &type, Int_T &row, Int_T &col
 		Reference arguments used to pass back the indice.
 
@@ -557,7 +1495,7 @@ void Scenarios::DeltaEntry( const char *Row, const char *Col, // )
 		if( ( row = (Int_T) RowLabels->FindLabel( Row ) ) < 0 )
 		{
 			Error( "File %s, line %d: Row label %s not found in the 2nd stage "
-				"problem.", Lexer::FileName, Lexer::LineNumber, Row );
+				"problem.", StochLex->FileName, StochLex->LineNumber, Row );
 			SemanticError = True;
 		}
 
@@ -565,7 +1503,7 @@ void Scenarios::DeltaEntry( const char *Row, const char *Col, // )
 		if( ( col = (Int_T) ColumnLabels->FindLabel( Col ) ) < 0 )
 		{
 			Error( "File %s, line %d: Column label %s not found in the "
-				"2nd stage problem.", Lexer::FileName, Lexer::LineNumber,
+				"2nd stage problem.", StochLex->FileName, StochLex->LineNumber,
 				Col );
 			SemanticError = True;
 		}
@@ -580,6 +1518,7 @@ void Scenarios::NewIndepDiscreteEntry( const char *Row, const char *Col, // )
 	//	is stored on the distribution list.
 	//
 	if( LastBlock != NULL ) AppendLastBlock();
+	if( LastStore != NULL ) AppendLastStore();
 
 	Int_T row, col;
 	Delta::DeltaType type;
@@ -591,7 +1530,7 @@ void Scenarios::NewIndepDiscreteEntry( const char *Row, const char *Col, // )
 	if( Prob < 0.0 || Prob > 1.0 )
 	{
 		Error( "File %s, line %d: Invalid value %f for a probability.",
-				Lexer::FileName, Lexer::LineNumber, Prob );
+				StochLex->FileName, StochLex->LineNumber, Prob );
 		SemanticError = True;
 		Prob = 0.0;
 	}
@@ -630,10 +1569,53 @@ void Scenarios::NewIndepDiscreteEntry( const char *Row, const char *Col, // )
 }
 
 
+void Scenarios::NewIndepParametricEntry( const char *Row, // )
+	const char *Col, const char *, ParametricLaw::LawType Type, double P1,
+	double P2 )
+{
+	AppendLastBlock();
+	AppendLastStore();
+	LastStochBlockType = INDEP_PARAMETRIC;
+
+	Int_T row, col;
+	Delta::DeltaType type;
+	DeltaEntry( Row, Col, type, row, col );
+
+	//--------------------------------------------------------------------------
+	//	See if the parameters make sense.
+	//
+	if( Type == ParametricLaw::UNIFORM && P1 > P2 )
+	{
+		Error( "File %s, line %d: Empty interval [%G,%G] of a uniform "
+			"distribution.", StochLex->FileName, StochLex->LineNumber, P1, P2 );
+		SemanticError = True;
+		P2 = P1;
+	}
+	else if( Type != ParametricLaw::UNIFORM && P2 < 0.0 )
+	{
+		Error( "File %s, line %d: Invalid value %G for a variance.",
+				StochLex->FileName, StochLex->LineNumber, P2 );
+		SemanticError = True;
+		P2 = 0.0;
+	}
+
+	//--------------------------------------------------------------------------
+	//	Every entry is a separate random variable with a distribution of its
+	//	own. Only the parameters are stored.
+	//
+	ParametricLaw *Law = new ParametricLaw( Type, P1, P2 );
+	if( Law == NULL ) FatalError( "Out of memory." );
+
+	AppendNewDistribution();
+	dist[len-1]->SetLaw( Law, type, row, col );
+}
+
+
 void Scenarios::NewBlocksDiscrete( const char *BlockName, // )
 	const char * /* PeriodLabel */, Real_T Prob )
 {
 	AppendLastBlock();
+	AppendLastStore();
 	LastStochBlockType = BLOCKS_DISCRETE;
 
 	//--------------------------------------------------------------------------
@@ -642,7 +1624,7 @@ void Scenarios::NewBlocksDiscrete( const char *BlockName, // )
 	if( Prob < 0.0 || Prob > 1.0 )
 	{
 		Error( "File %s, line %d: Invalid value %f for a probability.",
-				Lexer::FileName, Lexer::LineNumber, Prob );
+				StochLex->FileName, StochLex->LineNumber, Prob );
 		SemanticError = True;
 		Prob = 0.0;
 	}
@@ -679,6 +1661,58 @@ void Scenarios::NewBlocksDiscreteEntry( const char *Row, const char *Col, // )
 }
 
 
+void Scenarios::NewScenariosDiscrete( const char *ScenName, // )
+	const char *Parent, const char * /* PeriodLabel */, Real_T Prob )
+{
+	AppendLastBlock();
+
+	//--------------------------------------------------------------------------
+	//	See if the probability makes (some) sense.
+	//
+	if( Prob < 0.0 || Prob > 1.0 )
+	{
+		Error( "File %s, line %d: Invalid value %f for a probability.",
+				StochLex->FileName, StochLex->LineNumber, Prob );
+		SemanticError = True;
+		Prob = 0.0;
+	}
+
+	//--------------------------------------------------------------------------
+	//	The scenarios of one section form one distribution. They are stored
+	//	in a scenario store, which is attached to the distribution when the
+	//	section ends.
+	//
+	if( LastStore == NULL )
+	{
+		AppendNewDistribution();
+
+		LastStore = new ScenarioStore;
+		if( LastStore == NULL ) FatalError( "Out of memory." );
+	}
+	LastStochBlockType = SCENARIOS_DISCRETE;
+
+	if( !LastStore->NewScenario( ScenName, Parent, Prob ) )
+	{
+		Error( "File %s, line %d: Parent scenario %s of scenario %s not "
+			"found.", StochLex->FileName, StochLex->LineNumber, Parent,
+			ScenName );
+		SemanticError = True;
+	}
+}
+
+
+void Scenarios::NewScenariosDiscreteEntry( const char *Row, // )
+	const char *Col, Real_T Val )
+{
+	Int_T row, col;
+	Delta::DeltaType type;
+	DeltaEntry( Row, Col, type, row, col );
+
+	assert( LastStore != NULL );
+	LastStore->Append( Delta( type, row, col, Val ) );
+}
+
+
 void Scenarios::EndData( void )
 {
 	switch( LastStochBlockType )
@@ -693,6 +1727,12 @@ void Scenarios::EndData( void )
 		LastIndepDiscrete.value	= 0.0;
 		break;
 
+	case INDEP_PARAMETRIC:
+		//
+		//	Nothing to do either (one distribution per entry).
+		//
+		break;
+
 	case BLOCKS_DISCRETE:
 		//
 		//	The last block has to be added to the array of distributions as
@@ -702,6 +1742,13 @@ void Scenarios::EndData( void )
 		LastBlockName[0] = '\0';
 		break;
 
+	case SCENARIOS_DISCRETE:
+		//
+		//	The scenarios collected so far form the last distribution.
+		//
+		AppendLastStore();
+		break;
+
 	case NONE:
 		break;
 	}
@@ -722,6 +1769,113 @@ void Scenarios::EndData( void )
 //==============================================================================
 
 
+/*------------------------------------------------------------------------------
+
+	void Scenario::Flatten( void ) const
+
+PURPOSE:
+	Copies the deltas of all blocks of the scenario into two arrays, so that
+they may be applied to the subproblem without visiting the blocks and testing
+the type of every delta. The arrays are laid out as follows:
+
+	FlatIndex:	RHS rows | matrix rows | matrix columns | cost columns
+	FlatValue:	RHS values | matrix values | cost values
+
+	The order of the deltas of each kind is preserved (it matters for the cost
+coefficients, which are assigned rather than added).
+
+PARAMETERS:
+	None.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	Modifies the object, even though it is "const" (the flattened data are only
+a copy of what the scenario points to).
+
+------------------------------------------------------------------------------*/
+
+void Scenario::Flatten( void )
+const
+{
+	//
+	//	Explicit cast overrides "const".
+	//
+	Scenario &sc = *( (Scenario *) this );
+	Int_T j, i, bl;
+
+	//--------------------------------------------------------------------------
+	//	Count the deltas of each kind.
+	//
+	Int_T nr = 0, nm = 0, nc = 0;
+
+	for( j = 0; j < ScenLen; j++ )
+	{
+		const StochasticDataBlock &b = *Scen[j];
+
+		for( i = 0, bl = b.Len(); i < bl; i++ )
+			switch( b[i].type )
+			{
+			case Delta::RHS:	nr++;	break;
+			case Delta::MATRIX:	nm++;	break;
+			case Delta::COST:	nc++;	break;
+			default:
+#ifndef NDEBUG
+				abort();
+#endif
+				break;
+			}
+	}
+
+	sc.FlatIndex.Resize( Max( nr + 2 * nm + nc, Int_T( 1 ) ) );
+	sc.FlatValue.Resize( Max( nr + nm + nc, Int_T( 1 ) ) );
+
+	//--------------------------------------------------------------------------
+	//	Copy them.
+	//
+	Int_T r = 0, m = nr, c = nr + nm;
+
+	for( j = 0; j < ScenLen; j++ )
+	{
+		const StochasticDataBlock &b = *Scen[j];
+
+		for( i = 0, bl = b.Len(); i < bl; i++ )
+		{
+			const Delta &d = b[i];
+
+			switch( d.type )
+			{
+			case Delta::RHS:
+				sc.FlatIndex[r]			= d.row;
+				sc.FlatValue[r++]		= d.value;
+				break;
+
+			case Delta::MATRIX:
+				sc.FlatIndex[m]			= d.row;
+				sc.FlatIndex[m + nm]	= d.col;
+				sc.FlatValue[m++]		= d.value;
+				break;
+
+			case Delta::COST:
+				sc.FlatIndex[c + nm]	= d.col;
+				sc.FlatValue[c++]		= d.value;
+				break;
+
+			default:
+				break;
+			}
+		}
+	}
+
+	assert( r == nr && m == nr + nm && c == nr + nm + nc );
+
+	sc.RHS_Num		= nr;
+	sc.MatrixNum	= nm;
+	sc.CostNum		= nc;
+}
+
+
 #ifdef COMPILE_DISTANCE_MEASUREMENT
 
 /*------------------------------------------------------------------------------
@@ -904,31 +2058,107 @@ PARAMETERS:
 	Int_T s1, Int_T s2
 		Numbers of scenarios to be compared.
 
-RETURN VALUE:
-	The distance (see the description of "Scenario::GetDistance()" for details.
+RETURN VALUE:
+	The distance (see the description of "Scenario::GetDistance()" for details.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Real_T Scenarios::GetDistance( Int_T s1, Int_T s2 )
+{
+	assert( s1 >= 0 && s1 < ScenNum );
+	assert( s2 >= 0 && s2 < ScenNum );
+
+	//--------------------------------------------------------------------------
+	//	A distance between a scenario and the same scenario is always zero.
+	//	Non-trivial distance computation may be performed.
+	//
+	return ( s1 == s2 ) ? 0.0 : Scenario::GetDistance( Materialize( s1 ),
+		Materialize( s2 ) );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Int_T Scenarios::GetScenarioData( Array<Real_T> &X,
+		Scenario::DistanceMode Mode ) const
+
+PURPOSE:
+	Copies the random data of all scenarios (in the flattened form, see
+"Scenario::GetRHS()" etc.) into the rows of a dense matrix. The flattened data
+of all scenarios have the same layout, so that the "STD_NORM" or
+"WEIGHTED_NORM" distance of two scenarios is the sum of absolute differences
+of their rows (see "L1_Distance()"). In the latter mode the non-cost data are
+multiplied by the weight used by "Scenario::GetWeightedNormDistance()".
+
+PARAMETERS:
+	Array<Real_T> &X
+		On return: the "ScenNum" by "d" matrix stored by rows ("d" is the
+		return value).
+
+	Scenario::DistanceMode Mode
+		"STD_NORM" or "WEIGHTED_NORM".
+
+RETURN VALUE:
+	The length "d" of a row.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Int_T Scenarios::GetScenarioData( Array<Real_T> &X, // )
+	Scenario::DistanceMode Mode )
+	const
+{
+	assert( status == SCENARIOS_READY && ScenNum > 0 );
+	assert( Mode == Scenario::STD_NORM || Mode == Scenario::WEIGHTED_NORM );
+
+	const Int_T *Ind, *Ind2;
+	const Real_T *Val;
+	Int_T nr, nm, nc, i, s;
+
+	{
+		const Scenario &sc = Materialize( 0 );
+
+		sc.GetRHS( Ind, Val, nr );
+		sc.GetMatrix( Ind, Ind2, Val, nm );
+		sc.GetCost( Ind, Val, nc );
+	}
+
+	const Int_T d = nr + nm + nc;
+	const Real_T w = ( Mode == Scenario::WEIGHTED_NORM ) ? 2.0 : 1.0;
+
+	X.Resize( (size_t) ScenNum * d + 1 );
+
+	for( s = 0; s < ScenNum; s++ )
+	{
+		const Scenario &sc = Materialize( s );
+		Real_T *x = &X[0] + (size_t) s * d;
+		Int_T len;
 
-SIDE EFFECTS:
-	None.
+		sc.GetRHS( Ind, Val, len );
+		assert( len == nr );
+		for( i = 0; i < nr; i++ ) *x++ = w * Val[i];
 
-------------------------------------------------------------------------------*/
+		sc.GetMatrix( Ind, Ind2, Val, len );
+		assert( len == nm );
+		for( i = 0; i < nm; i++ ) *x++ = w * Val[i];
 
-Real_T Scenarios::GetDistance( Int_T s1, Int_T s2 )
-{
-	assert( s1 >= 0 && s1 < ScenNum );
-	assert( s2 >= 0 && s2 < ScenNum );
+		sc.GetCost( Ind, Val, len );
+		assert( len == nc );
+		for( i = 0; i < nc; i++ ) *x++ = Val[i];
+	}
 
-	//--------------------------------------------------------------------------
-	//	A distance between a scenario and the same scenario is always zero.
-	//	Non-trivial distance computation may be performed.
-	//
-	return ( s1 == s2 ) ? 0.0 : Scenario::GetDistance( *ArrayOfScenarios[s1],
-		*ArrayOfScenarios[s2] );
+	return d;
 }
 
 // @BEGIN Rebecca's code to get sample data
 Real_T Scenarios::GetScenarioComponents( Int_T s1 )
 {
-	return Scenario::GetScenarioComponents( *ArrayOfScenarios[s1] );
+	return Scenario::GetScenarioComponents( Materialize( s1 ) );
 
 }
 // @END Rebecca's code
@@ -1082,6 +2312,8 @@ Bool_T Scenarios::GenerateScenarios( Int_T &num )
 		AdjustedProbabilities = CalculateAccumulatedProbabilities(
 		GenerateAll ? False : True );
 
+	Accumulated = ( sadsam || GenerateAll ) ? False : True;
+
 	if( AdjustedProbabilities )
 	{
 		Error( "%d probabilities had to be adjusted! Check the "
@@ -1097,8 +2329,20 @@ Bool_T Scenarios::GenerateScenarios( Int_T &num )
 	//
 	Print( "\tGenerating %d scenarios now...\n", num );
 
-	ArrayOfScenarios.Resize( num );
-	ArrayOfScenarios.Fill( NULL, num );
+	//
+	//	Choose the size of the realization numbers (the longest discrete
+	//	distribution decides).
+	//
+	Int_T MaxLen = 1;
+
+	for( Int_T d = 0; d < len; d++ )
+		if( !dist[d]->IsContinuous() )
+			MaxLen = Max( MaxLen, dist[d]->Len() );
+
+	IndexWidth = ( MaxLen <= 256 ) ? 1 : ( MaxLen <= 65536 ) ? 2 :
+		Int_T( sizeof( Int_T ) );
+
+	ResizeScenarios( num );
 
 	if( GenerateAll )
 		GenerateAllScenarios( num );
@@ -1115,7 +2359,9 @@ Bool_T Scenarios::GenerateScenarios( Int_T &num )
 	Real_T Scenarios::GetNumberOfPossibleScenarios( void ) const
 
 PURPOSE:
-	Calculates the total number of all possible distinct scenarios.
+	Calculates the total number of all possible distinct scenarios. If any of
+the distributions is continuous, the number is INFINITY (so the scenarios are
+always sampled).
 
 PARAMETERS:
 	None.
@@ -1138,7 +2384,10 @@ Real_T Scenarios::GetNumberOfPossibleScenarios( void )
 	//	Compute the total number of all possible scenarios.
 	//
 	for( Int_T d = 0; d < len; d++ )
+	{
+		if( dist[d]->IsContinuous() ) return INFINITY;
 		max *= dist[d]->Len();
+	}
 	return max;
 }
 
@@ -1177,37 +2426,29 @@ void Scenarios::GenerateAllScenarios( Int_T num )
 	{
 		seclen = num;		//	Section length (interval [0,...,num-1] is
 							//	divided into sections).
-
-		//------------------------------------------------------------------
-		//	Allocate a new scenario and put it on the scenario list.
-		//
-		Scenario *scen = new Scenario( len, 0.0 );
 		Real_T prob = 1.0;
 
-		if( !scen ) FatalError( "Out of memory." );
-		ArrayOfScenarios[i] = scen;
-
 		for( Int_T j = 0; j < len; j++ )	// "len" denotes scenario legth.
 		{
 			//------------------------------------------------------------------
-			//	Add a new stochastic data block to the scenario.
+			//	Choose a stochastic data block for the scenario.
 			//
 			Int_T distlen = dist[j]->Len();		//	Distribution length.
 
 			seclen /= distlen;
 			assert( ( j < Int_T( len - 1 ) && seclen > 1 ) || seclen == 1 );
 
-			StochasticDataBlock *sdb = &( (*dist[j])[ i/seclen%distlen ] );
+			Int_T k = i / seclen % distlen;
 
-			scen->Set( j, sdb );
+			SetIndex( i, j, k );
 
 			//------------------------------------------------------------------
 			//	Update the probability of the scenario.
 			//
-			prob *= sdb->GetProbability();
+			prob *= (*dist[j])[k].GetProbability();
 		}
 
-		scen->SetProbability( prob );
+		ScenProb[i] = prob;
 	}
 
 	//--------------------------------------------------------------------------
@@ -1216,10 +2457,7 @@ void Scenarios::GenerateAllScenarios( Int_T num )
 	Real_T TotalProbability = 0.0;
 
 	for( i = 0; i < ScenNum; i++ )
-	{
-		assert( ArrayOfScenarios[i] != NULL );
-		TotalProbability += ArrayOfScenarios[i]->GetProbability();
-	}
+		TotalProbability += ScenProb[i];
 
 	if( TotalProbability - 1.0 > PROBABILITY_TOL )
 		Warning( "Scenario generation problem: total probability = %G.\n",
@@ -1233,7 +2471,9 @@ void Scenarios::GenerateAllScenarios( Int_T num )
 
 PURPOSE:
 	When it is impossible or undesireable to generate all possible scenarios,
-then this procedure produces a random sample of "num" scenarios.
+then this procedure produces a random sample of "num" scenarios. The uniform
+numbers come from "Sampler" (the whole sample is one block, e.g. one Latin
+hypercube).
 
 PARAMETERS:
 	Int_T num
@@ -1254,40 +2494,146 @@ void Scenarios::GenerateScenarioSample( Int_T num )
 	//--------------------------------------------------------------------------
 	//	Loop on all scenarios. Create one at a time.
 	//
+	Sampler.NewBlock( num, len );
+
 	for( Int_T s = 0; s < num; s++ )
 	{
-		Scenario *scen = new Scenario( len, 1.0/(double)num );
-
-		if( !scen ) FatalError( "Out of memory." );
-		ArrayOfScenarios[s] = scen;
+		ScenProb[s] = 1.0 / (double) num;
 
 		//----------------------------------------------------------------------
 		//	Loop on distributions. Choose one block from each distribution and
 		//	put it in the scenario.
 		//
 		for( Int_T i = 0; i < len; i++ )
-		{
-			Real_T prob = Random01::Next();
+			SetIndex( s, i, dist[i]->Realize( s, Sampler.Next( s, i ) ) );
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void Scenarios::ResizeScenarios( Int_T num )
+	void Scenarios::InvalidateScenarios( void )
+
+PURPOSE:
+	The first function resizes the matrix of realization numbers and the array
+of scenario probabilities to "num" scenarios (the numbers of the first
+scenarios are preserved). The second one detaches all scenario objects from the
+scenarios they held, so that they are rebuilt on the next access. It has to be
+called whenever the realization numbers or the blocks themselves change.
+
+PARAMETERS:
+	Int_T num
+		The new number of scenarios.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Scenarios::ResizeScenarios( Int_T num )
+{
+	assert( num >= 0 && len > 0 );
+
+	size_t size = (size_t) num * len * IndexWidth;
+
+	Indices.Resize( size > 0 ? size : 1 );
+	ScenProb.Resize( num > 0 ? num : 1 );
+
+	InvalidateScenarios();
+}
+
+
+void Scenarios::InvalidateScenarios( void )
+{
+	CachedScen.Fill( -1, CACHED_SCEN_NUM + SPARE_SCEN_NUM );
+	NextSpare = 0;
+}
+
 
-			Int_T j, l = dist[i]->Len();
-			for( j = 0; j < l; j++ )
-				if( (*dist[i])[j].GetProbability() > prob ) break;
+/*------------------------------------------------------------------------------
+
+	Scenario &Scenarios::Materialize( Int_T s ) const
+
+PURPOSE:
+	Returns a scenario object for scenario number "s". The object is built from
+the realization numbers (and the scenario probability) if needed. Scenarios
+with numbers below "CACHED_SCEN_NUM" have objects of their own, which are kept
+until the scenarios change. The remaining scenarios are given one of the
+"SPARE_SCEN_NUM" spare objects in turn, so a reference to such an object
+remains valid only until a few other scenarios are accessed.
+
+PARAMETERS:
+	Int_T s
+		Scenario number.
+
+RETURN VALUE:
+	The scenario object.
+
+SIDE EFFECTS:
+	May create, or rebuild a scenario object.
+
+------------------------------------------------------------------------------*/
+
+Scenario &Scenarios::Materialize( Int_T s )
+const
+{
+	assert( s >= 0 && s < ScenNum );
+
+	//
+	//	The scenario objects are only a cache. The scenarios are not changed
+	//	here.
+	//
+	Scenarios *This = (Scenarios *) this;
+
+	//--------------------------------------------------------------------------
+	//	Find the object for the scenario.
+	//
+	Int_T slot;
 
-			assert( j < l );
+	if( s < CACHED_SCEN_NUM )
+		slot = s;
+	else
+	{
+		for( slot = CACHED_SCEN_NUM;
+			slot < CACHED_SCEN_NUM + SPARE_SCEN_NUM && CachedScen[slot] != s;
+			slot++ )
+			;
 
-			scen->Set( i, &( (*dist[i])[j] ) );
+		if( slot == CACHED_SCEN_NUM + SPARE_SCEN_NUM )
+		{
+			slot = CACHED_SCEN_NUM + This->NextSpare;
+			This->NextSpare = ( NextSpare + 1 ) % SPARE_SCEN_NUM;
 		}
 	}
 
+	Scenario *&scen = This->ArrayOfScenarios[slot];
+
+	if( CachedScen[slot] == s )
+	{
+		assert( scen != NULL );
+		return *scen;
+	}
+
 	//--------------------------------------------------------------------------
-	//	Check if all scenarios have been created.
+	//	(Re)build the scenario object.
 	//
-#ifndef NDEBUG
+	if( scen == NULL )
 	{
-		for( Int_T s = 0; s < ScenNum; s++ )
-			assert( ArrayOfScenarios[s] != NULL );
+		scen = new Scenario( len );
+		if( !scen ) FatalError( "Out of memory." );
 	}
-#endif
+
+	for( Int_T i = 0; i < len; i++ )
+		scen->SetAgain( i, &dist[i]->GetBlock( s, GetIndex( s, i ) ) );
+	scen->SetProbability( ScenProb[s] );
+
+	This->CachedScen[slot] = s;
+
+	return *scen;
 }
 
 
@@ -1470,7 +2816,11 @@ void Scenarios::RenumberIndiceInScenarios( Array<Int_T> &NewRowNumber,
 				}
 			} // End of loop on deltas.
 		} // End of loop on stoch. data blocks.
+
+		dist[d]->UpdateRealizations();
 	} // End of loop on all distributions.
+
+	InvalidateScenarios();
 }
 
 void Scenarios::ScaleObjective( Real_T div )
@@ -1479,6 +2829,7 @@ void Scenarios::ScaleObjective( Real_T div )
 	//	Loop on all distributions.
 	//
 	for( Int_T d = 0; d < len; d++ )
+	{
 		//	Loop on blocks in distribution "*dist[d]".
 		//
 		for( Int_T i = 0, l = dist[d]->Len(); i < l; i++ )
@@ -1491,6 +2842,143 @@ void Scenarios::ScaleObjective( Real_T div )
 				if( delta.type == Delta::COST )
 					delta.value *= div;
 			}
+
+		dist[d]->ScaleRealizations( div );
+	}
+
+	InvalidateScenarios();
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void Scenarios::MarkRandomData( Array<Bool_T> &Rows, Int_T m,
+		Array<Bool_T> &Cols, Int_T n ) const
+
+PURPOSE:
+	Marks the second stage rows and columns which hold random data in any of
+the realizations of any of the distributions (not only in the scenarios that
+were generated). A row is marked if its right hand side or its technology
+matrix entries are random. A column is marked if its cost is random. The
+indice have to be already renumbered (see "RenumberIndiceInScenarios()").
+
+PARAMETERS:
+	Array<Bool_T> &Rows, Int_T m
+	Array<Bool_T> &Cols, Int_T n
+		Arrays of markers and their lengths (the number of second stage rows
+		and columns, resp.). The markers are only set (never cleared), so
+		that other rows/columns may be marked by the caller.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Scenarios::MarkRandomData( Array<Bool_T> &Rows, // )
+#ifndef NDEBUG
+	Int_T m,
+#else
+	Int_T,
+#endif
+	Array<Bool_T> &Cols,
+#ifndef NDEBUG
+	Int_T n )
+#else
+	Int_T )
+#endif
+const
+{
+	for( Int_T d = 0; d < len; d++ )
+		for( Int_T i = 0, l = dist[d]->Len(); i < l; i++ )
+			for( Int_T j = 0, bl = (*dist[d])[i].Len(); j < bl; j++ )
+			{
+				const Delta &delta = (*dist[d])[i][j];
+
+				switch( delta.type )
+				{
+				case Delta::RHS:
+				case Delta::MATRIX:
+					assert( delta.row >= 0 && delta.row < m );
+					Rows[ delta.row ] = True;
+					break;
+
+				case Delta::COST:
+					assert( delta.col >= 0 && delta.col < n );
+					Cols[ delta.col ] = True;
+					break;
+
+				default:
+#ifndef NDEBUG
+					abort();
+#endif
+					break;
+				}
+			}
+}
+
+
+
+
+/*------------------------------------------------------------------------------
+
+	void Scenarios::SetExpectedValues( DeterministicLP &LP ) const
+
+PURPOSE:
+	Replaces all random data in the deterministic LP by their expected values.
+The LP becomes the expected value problem. Must be called before the indice in
+the scenarios are renumbered (see "RenumberIndiceInScenarios()").
+
+PARAMETERS:
+	DeterministicLP &LP
+		The deterministic LP the scenarios were read for.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Scenarios::SetExpectedValues( DeterministicLP &LP )
+const
+{
+	for( Int_T d = 0; d < len; d++ )
+	{
+		Distribution &Dist = *dist[d];
+
+		if( Dist.Len() <= 0 ) continue;
+
+		for( Int_T j = 0, bl = Dist[0].Len(); j < bl; j++ )
+		{
+			const Delta &delta = Dist[0][j];
+			Real_T ExpVal = Dist.CalculateExpectedValue( j, Accumulated );
+
+			switch( delta.type )
+			{
+			case Delta::RHS:
+				LP.SetRHS_Elem( delta.row, ExpVal );
+				break;
+
+			case Delta::MATRIX:
+				LP.SetMatrixElement( delta.row, delta.col, ExpVal );
+				break;
+
+			case Delta::COST:
+				LP.SetMatrixElement( LP.GetCostRow(), delta.col, ExpVal );
+				break;
+
+			default:
+#ifndef NDEBUG
+				abort();
+#endif
+				break;
+			}
+		}
+	}
 }
 
 
@@ -1503,29 +2991,54 @@ void Scenarios::ScaleObjective( Real_T div )
 //
 
 /*------------------------------------------------------------------------------
-	Real_T Distribution::CalculateExpectedValue( void )
+
+	Real_T Distribution::CalculateExpectedValue( Int_T pos,
+		Bool_T Accumulated )
 
 PURPOSE:
-	To calculate expected value of a distribution
-	(Used in SADSAM implementation)
+	Computes the expected value of one random datum of the distribution. All
+blocks of a distribution hold the same deltas in the same order, so the datum is
+identified by its position in a block.
+
+PARAMETERS:
+	Int_T pos
+		Position of the delta in each of the blocks (zero for independent
+		random variables).
 
-    Works only for Stochastic Independent Variables right now
-	  and only when probabilities are "not" stored as cumulative probabilities
+	Bool_T Accumulated
+		Tells whether the block probabilities have been replaced by the
+		accumulated probabilities (see "CalculateAccumulatedProbabilities()").
+
+RETURN VALUE:
+	The expected value.
+
+SIDE EFFECTS:
+	None.
 
 ------------------------------------------------------------------------------*/
 
-Real_T Distribution::CalculateExpectedValue( void )
+Real_T Distribution::CalculateExpectedValue( Int_T pos, Bool_T Accumulated )
 {
-	assert( sadsam == true );
-	Real_T ExpVal = 0.0; 
-	Int_T i; 
+	Real_T ExpVal = 0.0,
+		PrevProb = 0.0;
+
+	for( Int_T i = 0; i < len; i++ )
+	{
+		const StochasticDataBlock &sdb = *block[i];
+		Real_T prob = sdb.GetProbability();
+
+		if( Accumulated )
+		{
+			Real_T AccProb = prob;
+
+			prob		-= PrevProb;
+			PrevProb	= AccProb;
+		}
 
-	for(i=0; i<len; i++){
-		ExpVal += block[i]->GetProbability() * 5; 
-										//just for the time being
+		ExpVal += prob * sdb[pos].value;
 	}
 
-	return ExpVal; 
+	return ExpVal;
 }
 
 
@@ -1597,43 +3110,22 @@ void Scenarios::AppendScenario( Int_T &num )
 	
 		Print( "\nAPPENDING %d SCENARIO(S)...", NumAppend );
 		
-		this ->ArrayOfScenarios.Resize( ScenNum );
-		
-		#ifndef NDEBUG
-		{
-			for( int s = 0; s < ScenNum; s++ )
-				assert( ArrayOfScenarios[s] != NULL );
-		}
-		#endif
-
+		ResizeScenarios( ScenNum );
 
 		//Adjust probabilities of the scenarios (e.g. 2 scen->0.5, 4 scen->0.25) 
 		int s = 0; 
-		for( s = 0; s < InitScenNum; s++ )
-			ArrayOfScenarios[s]->SetProbability ( 1.0/(double)ScenNum );
+		for( s = 0; s < ScenNum; s++ )
+			ScenProb[s] = 1.0/(double)ScenNum;
 
 
-		//Loop on all scenarios to be appended
+		//Loop on all scenarios to be appended (they form one sampler block)
+		Sampler.NewBlock( NumAppend, len );
 		for( s = 0; s < NumAppend; s++ )
 		{
-			//create a new scenario; resize the array and add the new scenario to the array
-			Scenario *scen_a = new Scenario( len, 1.0/(double)num );
-			if( !scen_a ) FatalError( "Out of memory." );
-		
-			ArrayOfScenarios[InitScenNum + s] = scen_a;
-
-			// Form scen_a:
-			// Loop on distributions. Choose one block from each distribution and put it in scen_a
+			// Loop on distributions. Choose one block from each distribution
 			for( int i = 0; i < len; i++ )
-			{
-				Real_T prob_a = Random01::Next();
-				int j, l = dist[i]->Len();
-			
-				for( j = 0; j < l; j++ )
-					if( (*dist[i])[j].GetProbability() > prob_a ) break;
-			
-				scen_a->Set( i, &( (*dist[i])[j] ) );
-			}
+				SetIndex( InitScenNum + s, i, dist[i]->Realize( InitScenNum + s,
+					Sampler.Next( s, i ) ) );
 		}
 		Print(" DONE.\n"); 
 	}
@@ -1658,8 +3150,7 @@ PARAMETERS:
 		changed.
 
 RETURN VALUE:	None	
-SIDE EFFECTS:	
-	Changes the scenario probabilities of Sc! Be careful!
+SIDE EFFECTS:	None (the realizations of Sc are copied).
 ------------------------------------------------------------------------------*/
 
 
@@ -1714,32 +3205,24 @@ void Scenarios::AppendScenarioRep( const Scenarios *Sc )
 	
 		Print( "\nAPPENDING SCENARIO REPOSITORY... " );
 		
-		this ->ArrayOfScenarios.Resize( TotalScen );
-		
-		#ifndef NDEBUG
-		{
-			for( int s = 0; s < ScenNum; s++ )
-				assert( ArrayOfScenarios[s] != NULL );
-		}
-		#endif
-
+		//The realization numbers are copied, so both repositories must hold
+		//the same distributions.
+		assert( Sc->len == len && Sc->IndexWidth == IndexWidth );
 
-		//Adjust probabilities of the existing scenarios (e.g. 2 scen->0.5, 4 scen->0.25) 
-		for( s = 0; s < InitScenNum; s++ )
-			ArrayOfScenarios[s]->SetProbability ( 1.0/(double)ScenNum );
+		ResizeScenarios( TotalScen );
 
+		//Adjust probabilities of all scenarios (e.g. 2 scen->0.5, 4 scen->0.25) 
+		for( s = 0; s < ScenNum; s++ )
+			ScenProb[s] = 1.0/(double)ScenNum;
 
-		//Loop on all scenarios to be appended and point to Sc's scenarios
-		for( s = 0; s < NumAppend; s++ )
-		{
-			ArrayOfScenarios[InitScenNum + s] = Sc->ArrayOfScenarios[s];			
-		}
 
-		//Adjust probabilities of new scenarios (e.g. 2 scen->0.5, 4 scen->0.25) 
-		//Note that since it points to Sc's scenarios, it changes probabilities of 
-		//Sc's scenarios as well...
+		//Loop on all scenarios to be appended and copy Sc's realizations
 		for( s = 0; s < NumAppend; s++ )
-			ArrayOfScenarios[InitScenNum + s]->SetProbability ( 1.0/(double)ScenNum );
+			for( int i = 0; i < len; i++ )
+			{
+				SetIndex( InitScenNum + s, i, Sc->GetIndex( s, i ) );
+				dist[i]->CopyRealization( InitScenNum + s, *Sc->dist[i], s );
+			}
 
 		Print(" DONE.\n"); 
 	}
@@ -1749,6 +3232,60 @@ void Scenarios::AppendScenarioRep( const Scenarios *Sc )
 
 
 
+//------------------------------------------------------------------------------
+//	The generator state the next batch of "ReGenerateScenarios()" starts from
+//	(saved at the first call).
+//
+static MTRand::uint32 batchState[ MTRand::SAVE ];
+static bool firstTime = true;
+//
+//------------------------------------------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+
+	static void Scenarios::GetBatchState( MTRand::uint32 *State )
+	static void Scenarios::SetBatchState( MTRand::uint32 *State )
+
+PURPOSE:
+	Read and restore the generator state the next call of
+"ReGenerateScenarios()" starts from. Before the first call this is the current
+state of "Random01". Restoring the state (together with that of "Random01")
+makes the following replications of the MRP draw the same scenarios as they
+would have in an uninterrupted run.
+
+PARAMETERS:
+	MTRand::uint32 *State
+		An array of "MTRand::SAVE" words.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Scenarios::GetBatchState( MTRand::uint32 *State )
+{
+	assert( State != NULL );
+
+	if( firstTime )
+		Random01::GetSeed( State );
+	else
+		memcpy( State, batchState, sizeof( batchState ) );
+}
+
+
+void Scenarios::SetBatchState( MTRand::uint32 *State )
+{
+	assert( State != NULL );
+
+	memcpy( batchState, State, sizeof( batchState ) );
+	firstTime = false;
+}
+
+
 /*------------------------------------------------------------------------------
 	  void Scenarios::ReGenerateScenarios( Int_T scennum )
 
@@ -1760,6 +3297,7 @@ USE:
 
 PARAMETERS:
 	Int_T scennum	# of scenarios to generate
+	int gamma		# of scenarios by which the next batch is shifted
 
 RETURN VALUE:	None	
 SIDE EFFECTS:	(Hopefully...) None.
@@ -1767,7 +3305,7 @@ SIDE EFFECTS:	(Hopefully...) None.
 
 void Scenarios::ReGenerateScenarios( Int_T scennum, int gamma )
 {
-	Int_T s, i, j, l; 
+	Int_T s, i; 
 	Real_T prob; 
         // David Love ---  Counts the number of batches that we use.
         // static int batchNumber = 0;
@@ -1780,8 +3318,6 @@ void Scenarios::ReGenerateScenarios( Int_T scennum, int gamma )
 	// David Love -- Sets the same random seed for every set of scenarios
         // Random01::Seed( 7625, 3293, 41);
 
-        static MTRand::uint32 batchState[ MTRand::SAVE ];
-        static bool firstTime = true;
         if( firstTime ) 
         {
            Random01::GetSeed( batchState );
@@ -1792,11 +3328,11 @@ void Scenarios::ReGenerateScenarios( Int_T scennum, int gamma )
 	//
 	if( scennum < ScenNum ){
 		ScenNum = scennum; 
-		this ->ArrayOfScenarios.Resize( scennum );		
+		ResizeScenarios( scennum );
 	}
 
 	for(s = 0; s < scennum; s++ )
-			ArrayOfScenarios[s]->SetProbability ( 1.0/(double)ScenNum );
+			ScenProb[s] = 1.0/(double)ScenNum;
 
 	//(Asumes that the probabilities of distributions have been filled by an  
 	// earlier call of GenerateScenarios...)
@@ -1811,25 +3347,22 @@ void Scenarios::ReGenerateScenarios( Int_T scennum, int gamma )
 
         // David Love -- Print out the distribution locations, check that overlapping is working properly
         // Print( "Batch random variables\n" );
+	//The sampler blocks are "gamma" scenarios long and start at the saved
+	//generator states, so the overlapping part of the next batch is drawn
+	//from the same blocks. (The last block may be cut short.) Antithetic pairs
+	//of scenarios are formed within the blocks.
 	for(s = 0; s < scennum; s++ )
 	{
+		if( s % gamma == 0 )
+			Sampler.NewBlock( gamma, len );
+
 		for(i = 0; i < len; i++ )
 		{
-			prob = Random01::Next();
+			prob = Sampler.Next( s % gamma, i );
                         // David Love -- quick debugging statement for probability
                         // printf( "prob = %lf\n", prob );
 
-			l = dist[i]->Len();
-			for(j = 0; j < l; j++ )
-                        {
-                                // David Love -- more debugging check for probability break for large values
-                                // printf( "j = %d, probability = %lf\n", j ,(*dist[i])[j].GetProbability() );
-				if( (*dist[i])[j].GetProbability() > prob ) break;
-                        }
-
-			assert( j < l );
-
-			ArrayOfScenarios[s]->SetAgain( i, &( (*dist[i])[j] ) );
+			SetIndex( s, i, dist[i]->Realize( s, prob ) );
 
                         // David Love -- Print out the distribution locations, check that overlapping is working properly
                         //Print( "j[%d][%d] = %3d\t", s, i, j );
@@ -1847,7 +3380,7 @@ void Scenarios::ReGenerateScenarios( Int_T scennum, int gamma )
         // batchNumber++;
         // fprintf( stderr, "Batch # %d, len %d\n", batchNumber, len );
 
-
+	InvalidateScenarios();
 }  //end of ReGenerateScenarios
 
 
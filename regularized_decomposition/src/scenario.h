@@ -14,7 +14,7 @@ HEADER FILE NAME:	scenario.h
 CREATED:			1994.07.27
 LAST MODIFIED:		1996.02.07
 
-DEPENDENCIES:		stdtype.h, smartptr.h,
+DEPENDENCIES:		stdtype.h, smartptr.h, sampler.h,
 					<stdio.h>, <assert.h>
 
 --------------------------------------------------------------------------------
@@ -45,6 +45,9 @@ HEADER CONTENTS:
 #ifndef __MY_DEFS_H__
 #	include "my_defs.h"
 #endif
+#ifndef __SAMPLER_H__
+#	include "sampler.h"
+#endif
 
 #define COMPILE_DISTANCE_MEASUREMENT
 #define MAX_SCEN_NUM			(5000000000)
@@ -149,6 +152,7 @@ void StochasticDataBlock::SetProbability( Real_T p )
 class IndepStochVar : public StochasticDataBlock, public Delta
 {
 public:
+	IndepStochVar( void );
 	IndepStochVar( Real_T prob, Delta::DeltaType t, Int_T r, Int_T c,
 		Real_T v );
 	virtual ~IndepStochVar( void );
@@ -159,6 +163,12 @@ public:
 };
 
 
+inline
+IndepStochVar::IndepStochVar( void )
+	: StochasticDataBlock( 1.0 ), Delta()
+{}
+
+
 inline
 IndepStochVar::IndepStochVar( Real_T prob, Delta::DeltaType t, Int_T r, // )
 	Int_T c, Real_T v )
@@ -259,9 +269,158 @@ Delta & IndepStochVarBlock::operator[]( Int_T i )
 //==============================================================================
 
 
+//==============================================================================
+//	Scenarios read from a SCENARIOS DISCRETE section of the stochastic data
+//	file. Together they form a single (joint) distribution. Since there may be
+//	millions of them, they are not stored as separately allocated blocks. The
+//	deltas of all scenarios are packed into one array and a scenario is
+//	described by its offset into that array and its probability. The rest of
+//	the code sees every scenario as a stochastic data block: a light view of
+//	the store ("PackedScenarioBlock").
+//
+class ScenarioStore;
+class DeterministicLP;
+
+class PackedScenarioBlock : public StochasticDataBlock
+{
+private:
+	ScenarioStore *Store;
+	Int_T Scen;
+
+public:
+	PackedScenarioBlock( void );
+	virtual ~PackedScenarioBlock( void );
+
+	void Attach( ScenarioStore *store, Int_T scen );
+
+	virtual Int_T Len( void ) const;
+	virtual const Delta & operator []( Int_T i ) const;
+	virtual Delta & operator []( Int_T i );
+};
+
+
+inline
+PackedScenarioBlock::PackedScenarioBlock( void )
+	: StochasticDataBlock( 0.0 ), Store( NULL ), Scen( -1 )
+{}
+
+
+inline
+PackedScenarioBlock::~PackedScenarioBlock( void )
+{}
+
+
+inline
+void PackedScenarioBlock::Attach( ScenarioStore *store, Int_T scen )
+{
+	assert( store != NULL && scen >= 0 );
+
+	Store	= store;
+	Scen	= scen;
+}
+
+
+class ScenarioStore
+{
+private:
+	enum { INIT_SCEN_NUM = 64, INIT_DELTA_NUM = 1024 };
+
+	Int_T ScenNum, MaxScenNum;
+	Array<Int_T> Start;			// Scenario "s" occupies positions "Start[s]"
+								// up to "Start[s+1]-1" of "Deltas".
+	Array<Real_T> Prob;			// Scenario probabilities.
+
+	Int_T DeltaNum, MaxDeltaNum;
+	Array<Delta> Deltas;		// Packed deltas of all scenarios.
+
+	SortedArrayOfLabels *Names;	// Scenario names (only while reading).
+	Int_T Inherited;			// Number of deltas of the current scenario
+								// copied from its parent.
+
+	PackedScenarioBlock *Blocks;
+
+private:
+	void ExtendDeltas( Int_T MinLen );
+	static int CmpKeys( const Delta &d1, const Delta &d2 );
+	static Real_T CoreValue( const DeterministicLP &LP, const Delta &d );
+
+public:
+	ScenarioStore( void );
+	~ScenarioStore( void );
+
+	Bool_T NewScenario( const char *Name, const char *Parent, Real_T prob );
+	void Append( const Delta &d );
+	void Normalize( const DeterministicLP &LP );
+	PackedScenarioBlock *CreateBlocks( void );
+	Bool_T ReadBin( FILE *fp, Int_T Scens, Int_T DeltaCount );
+
+	Int_T GetNumberOfScenarios( void ) const;
+	Int_T Len( Int_T s ) const;
+	const Delta &Entry( Int_T s, Int_T i ) const;
+	Delta &Entry( Int_T s, Int_T i );
+};
+
+
+inline
+Int_T ScenarioStore::GetNumberOfScenarios( void )
+const
+{ return ScenNum; }
+
+
+inline
+Int_T ScenarioStore::Len( Int_T s )
+const
+{
+	assert( s >= 0 && s < ScenNum );
+	return Start[s+1] - Start[s];
+}
+
+
+inline
+const Delta &ScenarioStore::Entry( Int_T s, Int_T i )
+const
+{
+	assert( i >= 0 && i < Len( s ) );
+	return Deltas[ Start[s] + i ];
+}
+
+
+inline
+Delta &ScenarioStore::Entry( Int_T s, Int_T i )
+{
+	assert( i >= 0 && i < Len( s ) );
+	return Deltas[ Start[s] + i ];
+}
+
+
+inline
+Int_T PackedScenarioBlock::Len( void )
+const
+{ return Store->Len( Scen ); }
+
+
+inline
+const Delta & PackedScenarioBlock::operator[]( Int_T i )
+	const
+{ return ((const ScenarioStore *)Store)->Entry( Scen, i ); }
+
+
+inline
+Delta & PackedScenarioBlock::operator[]( Int_T i )
+{ return Store->Entry( Scen, i ); }
+//
+//	The end of the scenario store.
+//==============================================================================
+
+
 //==============================================================================
 //	A class representing a single scenario.
 //
+//	Apart from the pointers to the blocks, a scenario keeps a flattened copy of
+//	their deltas: the right hand side, technology matrix and cost entries, each
+//	kind stored contiguously (see "Flatten()"). It is made on the first request
+//	and discarded whenever the scenario (or the data it points to) changes.
+//
 class Scenario
 {
 private:
@@ -269,6 +428,12 @@ private:
 	Array<StochasticDataBlock *> Scen;
 	Real_T Probability;
 
+	Int_T RHS_Num, MatrixNum, CostNum;	// RHS_Num < 0 - not flattened yet.
+	Array<Int_T> FlatIndex;		// RHS rows, matrix rows and columns, cost cols.
+	Array<Real_T> FlatValue;	// RHS, matrix and cost values.
+
+	void Flatten( void ) const;
+
 #ifdef COMPILE_DISTANCE_MEASUREMENT
 
 public:
@@ -297,6 +462,12 @@ public:
 	void SetProbability( Real_T Prob );
 	Real_T GetProbability( void ) const;
 
+	void Invalidate( void );
+	void GetRHS( const Int_T *&row, const Real_T *&val, Int_T &len ) const;
+	void GetMatrix( const Int_T *&row, const Int_T *&col, const Real_T *&val,
+		Int_T &len ) const;
+	void GetCost( const Int_T *&col, const Real_T *&val, Int_T &len ) const;
+
 #ifdef COMPILE_DISTANCE_MEASUREMENT
 	//--------------------------------------------------------------------------
 	//	Data and functions used for computing distances between the scenarios.
@@ -324,15 +495,56 @@ private:
 //==============================================================================
 
 //==============================================================================
-//	A class reprsenting a single (discrete) distribution of a random variable.
+//	The law of a continuous (parametric) distribution of an independent random
+//	variable (INDEP UNIFORM, NORMAL or LOGNORM section of the stochastic data
+//	file). Only the two parameters are kept. A realization is computed from
+//	one random number by inverting the distribution function.
+//
+class ParametricLaw
+{
+public:
+	enum LawType { DISCRETE, UNIFORM, NORMAL, LOGNORMAL };
+
+private:
+	LawType Type;
+	Real_T P1, P2;				// (low, high) or (mean, variance).
+
+public:
+	ParametricLaw( LawType t, Real_T p1, Real_T p2 );
+
+	Real_T Quantile( Real_T u ) const;
+	Real_T Mean( void ) const;
+	void Scale( Real_T div );
+	void GetParameters( LawType &t, Real_T &p1, Real_T &p2 ) const;
+
+	static Real_T NormalQuantile( Real_T u );
+};
+//
+//	End of the class representing a continuous law.
+//==============================================================================
+
+//==============================================================================
+//	A class reprsenting a single distribution of a random variable.
+//
+//	A discrete distribution is a list of blocks. A continuous one has only one
+//	block (holding the expected value), which serves as a template for the
+//	realizations. These are drawn into a buffer of one block per scenario, which
+//	is reused whenever the scenarios are sampled again.
 //
 class Distribution
 {
 private:
-	enum { INIT_DIST_LEN = 10 };
+	enum { INIT_DIST_LEN = 10, SAMPLE_CHUNK_LEN = 1024 };
 
 	Int_T len, maxLen;
 	Array<StochasticDataBlock *> block;
+	ScenarioStore *Store;		// Owner of the blocks (when they are packed).
+
+	ParametricLaw *Law;			// Law of a continuous distribution (or NULL).
+	Int_T SampleChunks;			// Realizations of a continuous distribution
+	Array<IndepStochVar *> Samples;	// (in chunks, which never move).
+
+	IndepStochVar &Realization( Int_T s );
 
 public:
 	Distribution( void );
@@ -343,17 +555,29 @@ public:
 	StochasticDataBlock &operator []( Int_T i );
 
 	void Append( StochasticDataBlock *bl );
+	void Attach( ScenarioStore *store );
+	void SetLaw( ParametricLaw *law, Delta::DeltaType t, Int_T r, Int_T c );
+
+	Bool_T IsContinuous( void ) const;
+
+	Int_T Draw( Real_T prob ) const;
+	Int_T Realize( Int_T s, Real_T u );
+	StochasticDataBlock &GetBlock( Int_T s, Int_T j );
+	void CopyRealization( Int_T s, Distribution &Src, Int_T SrcScen );
+	void UpdateRealizations( void );
+	void ScaleRealizations( Real_T div );
 
-	//@BEGIN-------------------------------------------------
-	Real_T CalculateExpectedValue ( void ); 
-	//@END---------------------------------------------------
+	Bool_T WriteBin( FILE *fp ) const;
+	Bool_T ReadBin( FILE *fp );
+
+	Real_T CalculateExpectedValue( Int_T pos, Bool_T Accumulated );
 
 };
 //
 //	End of the class representing a single random distribution.
 //==============================================================================
 
-class DeterministicLP;
+class Lexer;
 
 //==============================================================================
 //	A class representing a scenario repository.
@@ -362,10 +586,28 @@ class Scenarios
 {
 protected:
 	//--------------------------------------------------------------------------
-	//	Scenarios as an array of arrays of simple LP changes (Deltas).
+	//	Scenarios as a matrix of realization numbers: scenario "s" consists of
+	//	block "GetIndex( s, i )" of every distribution "i". The numbers are
+	//	packed in "IndexWidth" bytes each (1, 2 or 4, depending on the length of
+	//	the longest discrete distribution). A continuous distribution has a
+	//	realization of its own for every scenario, so its number is not used.
 	//
 	Int_T ScenNum;
+	Int_T IndexWidth;
+	Array<unsigned char> Indices;
+	Array<Real_T> ScenProb;
+
+	//
+	//	Scenario objects (arrays of pointers to the blocks) are only created
+	//	when the scenarios are accessed. The first "CACHED_SCEN_NUM" of them are
+	//	kept, the remaining scenarios share "SPARE_SCEN_NUM" objects used in
+	//	turn (see "Materialize()").
+	//
+	enum { CACHED_SCEN_NUM = 4096, SPARE_SCEN_NUM = 4 };
+
 	Array<Scenario *> ArrayOfScenarios;
+	Array<Int_T> CachedScen;	// Scenario held by each object (-1 if none).
+	Int_T NextSpare;
 
 	enum Status { EMPTY, READING_FILE, DISTRIBUTIONS_READY, SCENARIOS_READY };
 	Status status;
@@ -374,11 +616,13 @@ protected:
 	//	Data used for scenario file parsing (and only during parsing!).
 	//
 private:
+	const DeterministicLP *CoreLP;
 	SortedArrayOfLabels *RowLabels, *ColumnLabels;
 	const char *ProblemName, *RHS_Name, *ObjName, *BoundsName, *RangesName;
 	int ProblemNameLen, RHS_NameLen, ObjNameLen, BoundsNameLen, RangesNameLen;
 
 	Bool_T SemanticError;
+	const Lexer *StochLex;	// For locating semantic errors in the file.
 
 	//--------------------------------------------------------------------------
 	//	More data used by semantic actions.
@@ -391,16 +635,21 @@ private:
 	Int_T len, maxLen;
 	Array<Distribution *> dist;
 	Real_T MaxScen;				// The total number of possible scenarios.
+	Bool_T Accumulated;			// Are the block probabilities accumulated?
+	UniformSampler Sampler;		// Source of the uniform numbers the scenarios
+								// are sampled from (see "SetSampling()").
 
 	//
 	//	What was the last item that was processed?
 	//
-	enum StochBlockType { NONE, INDEP_DISCRETE, BLOCKS_DISCRETE };
+	enum StochBlockType { NONE, INDEP_DISCRETE, INDEP_PARAMETRIC,
+		BLOCKS_DISCRETE, SCENARIOS_DISCRETE };
 
 	StochBlockType LastStochBlockType;
 	Delta LastIndepDiscrete;
 	char LastBlockName[20];
 	IndepStochVarBlock *LastBlock;
+	ScenarioStore *LastStore;
 	//
 	//  End of data used by the semantic actions.
 	//--------------------------------------------------------------------------
@@ -418,6 +667,7 @@ private:
 
 	void AppendNewDistribution( void );
 	void AppendLastBlock( void );
+	void AppendLastStore( void );
 
 	//--------------------------------------------------------------------------
 	//	Procedure for reading a scenario file and generating all scenarios.
@@ -426,25 +676,40 @@ public:
 	virtual Bool_T ReadScenarioFile( const char *StochFileName,
 		FILE *StochFilePtr, DeterministicLP &DeterministicMatrix );
 	virtual Bool_T GenerateScenarios( Int_T &num );
+	void SetSampling( UniformSampler::Method m, Bool_T Antithetic );
+	Bool_T WriteDistributions( FILE *fp ) const;
+	Bool_T ReadDistributions( FILE *fp );
 	void RenumberIndiceInScenarios( Array<Int_T> &NewRowNumber, Int_T rLen,
 		Array<Int_T> &NewColNumber, Int_T cLen, Int_T ActualStage2Rows,
 		Int_T Stage2Col );
 	void ScaleObjective( Real_T div );
+	void MarkRandomData( Array<Bool_T> &Rows, Int_T m, Array<Bool_T> &Cols,
+		Int_T n ) const;
+	void SetExpectedValues( DeterministicLP &LP ) const;
 
 	//@BEGIN-----------------------------------
 	
 	void AppendScenario( Int_T &num );
 	void AppendScenarioRep( const Scenarios *Sc );
 	void ReGenerateScenarios( Int_T scennum, int gamma ); 
+	static void GetBatchState( MTRand::uint32 *State );
+	static void SetBatchState( MTRand::uint32 *State );
 
 	//@END-------------------------------------
 
 private:
 	void GenerateAllScenarios( Int_T num );
 	void GenerateScenarioSample( Int_T num );
+	void ResizeScenarios( Int_T num );
+	Int_T GetIndex( Int_T s, Int_T i ) const;
+	void SetIndex( Int_T s, Int_T i, Int_T j );
+	void InvalidateScenarios( void );
 	Real_T GetNumberOfPossibleScenarios( void ) const;
 	Int_T CalculateAccumulatedProbabilities( Bool_T Store = True );
 
+protected:
+	Scenario &Materialize( Int_T s ) const;
+
 #ifndef NDEBUG
 private:
 	void CheckArrayOfDistributions( void );
@@ -470,9 +735,16 @@ public:
 		Delta::DeltaType &type, Int_T &row, Int_T &col );
 	void NewIndepDiscreteEntry( const char *Col, const char *Row,
 		const char *PeriodLab, double Val, double Prob );
+	void NewIndepParametricEntry( const char *Col, const char *Row,
+		const char *PeriodLab, ParametricLaw::LawType Type, double P1,
+		double P2 );
 	void NewBlocksDiscrete( const char *BlockName, const char *PeriodLabel,
 		Real_T Prob );
 	void NewBlocksDiscreteEntry( const char *Row, const char *Col, Real_T Val );
+	void NewScenariosDiscrete( const char *ScenName, const char *Parent,
+		const char *PeriodLabel, Real_T Prob );
+	void NewScenariosDiscreteEntry( const char *Row, const char *Col,
+		Real_T Val );
 	void EndData( void );
 
 #ifdef COMPILE_DISTANCE_MEASUREMENT
@@ -482,6 +754,17 @@ public:
 public:
 	Real_T GetDistance( Int_T s1, Int_T s2 );
 	Real_T GetScenarioComponents( Int_T s1 );
+	Int_T GetScenarioData( Array<Real_T> &X, Scenario::DistanceMode Mode )
+		const;
+
+	//--------------------------------------------------------------------------
+	//	Scenario reduction (see "scenred.cpp").
+	//
+	Bool_T ReduceScenarios( Int_T Keep, Scenario::DistanceMode Mode,
+		Int_T Procs );
+
+private:
+	void KeepScenarios( const Int_T *Kept, const Real_T *Prob, Int_T Num );
 #endif
 };
 //
@@ -502,7 +785,7 @@ public:
 inline
 Scenario::Scenario( Int_T Len, Real_T Prob )
 	: ScenLen( Len ), Scen( ScenLen, (StochasticDataBlock *)NULL ),
-	Probability( Prob )
+	Probability( Prob ), RHS_Num( -1 ), MatrixNum( 0 ), CostNum( 0 )
 { assert( Len > 0 ); }
 
 
@@ -556,6 +839,7 @@ void Scenario::Set( Int_T pos, StochasticDataBlock *d )
 	assert( d != NULL );
 
 	Scen[pos] = d;
+	RHS_Num = -1;
 }
 
 //@BEGIN------------------------------------------------------
@@ -569,6 +853,7 @@ void Scenario::SetAgain(Int_T pos, StochasticDataBlock *d )
 	assert( d != NULL );
 
 	Scen[pos] = d;
+	RHS_Num = -1;
 }
 //@END--------------------------------------------------------
 
@@ -590,6 +875,56 @@ const
 { return Probability; }
 
 
+//
+//	Access to the flattened scenario data. Each function returns pointers to
+//	the arrays of one kind of deltas and their number. Plain pointers are used,
+//	as these loops are executed for every scenario in every iteration. The
+//	pointers are valid until the scenario is changed. "Invalidate()" has to be
+//	called when the deltas the scenario points to are modified.
+//
+inline
+void Scenario::Invalidate( void )
+{ RHS_Num = -1; }
+
+
+inline
+void Scenario::GetRHS( const Int_T *&row, const Real_T *&val, Int_T &len )
+const
+{
+	if( RHS_Num < 0 ) Flatten();
+
+	len	= RHS_Num;
+	row	= &FlatIndex[0];
+	val	= &FlatValue[0];
+}
+
+
+inline
+void Scenario::GetMatrix( const Int_T *&row, const Int_T *&col, // )
+	const Real_T *&val, Int_T &len )
+const
+{
+	if( RHS_Num < 0 ) Flatten();
+
+	len	= MatrixNum;
+	row	= &FlatIndex[0] + RHS_Num;
+	col	= row + MatrixNum;
+	val	= &FlatValue[0] + RHS_Num;
+}
+
+
+inline
+void Scenario::GetCost( const Int_T *&col, const Real_T *&val, Int_T &len )
+const
+{
+	if( RHS_Num < 0 ) Flatten();
+
+	len	= CostNum;
+	col	= &FlatIndex[0] + RHS_Num + 2 * MatrixNum;
+	val	= &FlatValue[0] + RHS_Num + MatrixNum;
+}
+
+
 //
 //	Handling the counter of scenario distance measurements.
 //
@@ -613,6 +948,14 @@ Scenarios::~Scenarios( void )
 { Cleanup(); }
 
 
+inline
+void Scenarios::SetSampling( UniformSampler::Method m, Bool_T Antithetic )
+{
+	Sampler.SetMethod( m );
+	Sampler.SetAntithetic( Antithetic );
+}
+
+
 inline
 Int_T Scenarios::GetNumberOfScenarios( void )
 const
@@ -622,6 +965,11 @@ const
 }
 
 
+//
+//	Note: the returned scenario object may be reused for another scenario as
+//	soon as a few other scenarios are accessed (see "Materialize()"). It should
+//	not be held for long.
+//
 inline
 Scenario & Scenarios::operator[]( int ScenarioNumber )
 {
@@ -629,7 +977,7 @@ Scenario & Scenarios::operator[]( int ScenarioNumber )
 	assert( ScenNum > 0 );
 	assert( ScenarioNumber >= 0 && ScenarioNumber < ScenNum );
 
-	return *ArrayOfScenarios[ ScenarioNumber ];
+	return Materialize( ScenarioNumber );
 }
 
 
@@ -641,7 +989,45 @@ const
 	assert( ScenNum > 0 );
 	assert( ScenarioNumber >= 0 && ScenarioNumber < ScenNum );
 
-	return *ArrayOfScenarios[ ScenarioNumber ];
+	return Materialize( ScenarioNumber );
+}
+
+
+//
+//	Access to the packed realization numbers.
+//
+inline
+Int_T Scenarios::GetIndex( Int_T s, Int_T i )
+const
+{
+	assert( s >= 0 && s < ScenNum && i >= 0 && i < len );
+
+	const unsigned char *p = &Indices[0] + ( (size_t) s * len + i ) *
+		IndexWidth;
+
+	switch( IndexWidth )
+	{
+	case 1:		return Int_T( *p );
+	case 2:		return Int_T( *(const unsigned short *) p );
+	default:	return *(const Int_T *) p;
+	}
+}
+
+
+inline
+void Scenarios::SetIndex( Int_T s, Int_T i, Int_T j )
+{
+	assert( s >= 0 && s < ScenNum && i >= 0 && i < len );
+	assert( j >= 0 && ( IndexWidth == 4 || j < ( 1 << ( 8 * IndexWidth ) ) ) );
+
+	unsigned char *p = &Indices[0] + ( (size_t) s * len + i ) * IndexWidth;
+
+	switch( IndexWidth )
+	{
+	case 1:		*p = (unsigned char) j;						break;
+	case 2:		*(unsigned short *) p = (unsigned short) j;	break;
+	default:	*(Int_T *) p = j;							break;
+	}
 }
 
 
@@ -663,10 +1049,17 @@ const
 inline
 Distribution::Distribution( void )
 	: len( 0 ), maxLen( INIT_DIST_LEN ),
-	block( maxLen, (StochasticDataBlock *)NULL )
+	block( maxLen, (StochasticDataBlock *)NULL ), Store( NULL ), Law( NULL ),
+	SampleChunks( 0 )
 {}
 
 
+inline
+Bool_T Distribution::IsContinuous( void )
+	const
+{ return Bool_T( Law != NULL ); }
+
+
 inline
 Int_T Distribution::Len( void )
 { return len; }
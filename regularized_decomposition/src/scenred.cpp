@@ -0,0 +1,442 @@
+/*------------------------------------------------------------------------------
+MODULE TYPE:		Stochastic data parser and scenario generator.
+PROJECT CODE:		REGULARIXED DECOMPOSITION
+PROJECT FULL NAME:	Implementation of the regularized decomposition for two
+					stage linear programs.
+
+MODULE AUTHOR:		agent.
+
+PROJECT SUPERVISOR:	----------------
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE NAME:	scenred.cpp
+CREATED:			2026.10.19
+LAST MODIFIED:		2026.10.19
+
+DEPENDENCIES:		scenario.h, distcomp.h, error.h, print.h, stdtype.h,
+					std_math.h
+					<stdlib.h>, <math.h>, <assert.h>
+
+--------------------------------------------------------------------------------
+
+SOURCE FILE CONTENTS:
+	Scenario reduction. A large (sampled or explicitly given) set of scenarios
+is replaced by a few of them, chosen by the fast forward selection of Heitsch
+and Roemisch ("Scenario reduction algorithms in stochastic programming",
+Comput. Optim. Appl. 24 (2003), 187-206). The scenarios are selected one at a
+time: the one that minimizes the (Kantorovich) distance between the original
+distribution and the one concentrated on the scenarios selected so far. Each
+scenario that is not selected then gives its probability to the nearest
+selected one. The result is an ordinary (smaller) set of scenarios, so the
+master problem is much smaller, which is useful for quick what-if solves.
+	The distance between two scenarios is that of "Scenario::GetDistance()" in
+the "STD_NORM" or "WEIGHTED_NORM" mode (the sum of absolute differences of the
+random data, possibly weighted). It is computed once for every pair of
+scenarios. The random data of all scenarios are first copied into one dense
+matrix (see "Scenarios::GetScenarioData()"), so that a distance is a simple
+loop over two rows. The distance matrix may be computed by several processes
+in parallel (see "RunInParallel()").
+	The reduction takes O( N^2 ) memory and O( K * N^2 ) time for "N"
+scenarios reduced to "K".
+
+--------------------------------------------------------------------------------
+
+PUBLIC INTERFACE:
+	Bool_T Scenarios::ReduceScenarios( Int_T Keep,
+		Scenario::DistanceMode Mode, Int_T Procs )
+
+PRIVATE INTERFACE:
+	void Scenarios::KeepScenarios( const Int_T *Kept, const Real_T *Prob,
+		Int_T Num )
+
+STATIC FUNCTIONS:
+	static void DistanceRows( void *Data, Int_T First, Int_T Step )
+	static Real_T *ComputeDistances( const Real_T *X, Int_T n, Int_T d,
+		Int_T Procs )
+	static void FreeDistances( Real_T *C, Int_T n, Int_T Procs )
+
+------------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+
+#ifndef __SCENARIO_H__
+#	include "scenario.h"
+#endif
+#ifndef __DISTCOMP_H__
+#	include "distcomp.h"
+#endif
+#ifndef __ERROR_H__
+#	include "error.h"
+#endif
+#ifndef __PRINT_H__
+#	include "print.h"
+#endif
+#ifndef __STD_MATH_H__
+#	include "std_math.h"
+#endif
+
+
+#ifdef COMPILE_DISTANCE_MEASUREMENT
+
+//------------------------------------------------------------------------------
+//	The largest number of scenarios that may be reduced (the distance matrix
+//	then takes 2GB).
+//
+#define MAX_REDUCED_SCEN_NUM	(16384)
+//
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+//	The data of the distance matrix computation.
+//
+struct DistanceWork
+{
+	Real_T *C;			// The "n" by "n" distance matrix and the "n" by "d"
+	const Real_T *X;	// data matrix (both stored by rows).
+	Int_T n, d;
+};
+
+
+/*------------------------------------------------------------------------------
+
+	static void DistanceRows( void *Data, Int_T First, Int_T Step )
+
+PURPOSE:
+	Fills the rows "First", "First + Step", ... of the distance matrix of the
+scenarios whose data are the rows of the data matrix (only the entries above
+the diagonal). A task for "RunInParallel()".
+
+PARAMETERS:
+	void *Data
+		The "DistanceWork" structure.
+
+	Int_T First, Int_T Step
+		The rows to compute.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static void DistanceRows( void *Data, Int_T First, Int_T Step )
+{
+	const DistanceWork &w = *(const DistanceWork *) Data;
+
+	for( Int_T i = First; i < w.n; i += Step )
+	{
+		const Real_T *xi = w.X + (size_t) i * w.d;
+		Real_T *ci = w.C + (size_t) i * w.n;
+
+		for( Int_T j = i + 1; j < w.n; j++ )
+			ci[j] = L1_Distance( xi, w.X + (size_t) j * w.d, w.d );
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static Real_T *ComputeDistances( const Real_T *X, Int_T n, Int_T d,
+		Int_T Procs )
+	static void FreeDistances( Real_T *C, Int_T n, Int_T Procs )
+
+PURPOSE:
+	The first function allocates and computes the (symmetric) distance matrix
+of the scenarios whose data are the rows of "X". The rows of its upper
+triangle are computed by "Procs" processes (see "RunInParallel()"), the lower
+triangle is then copied from the upper one. The second function frees the
+matrix.
+
+PARAMETERS:
+	const Real_T *X, Int_T n, Int_T d
+		The "n" by "d" data matrix.
+
+	Int_T Procs
+		Number of processes (the same for both functions).
+
+	Real_T *C
+		The distance matrix.
+
+RETURN VALUE:
+	The "n" by "n" distance matrix (or NULL, if it could not be allocated).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static Real_T *ComputeDistances( const Real_T *X, Int_T n, Int_T d, // )
+	Int_T Procs )
+{
+	if( Procs > n ) Procs = n;
+
+	Real_T *C = (Real_T *) AllocShared( (size_t) n * n * sizeof( Real_T ),
+		Procs );
+	Int_T i, j;
+
+	if( C == NULL ) return NULL;
+
+	DistanceWork w;
+
+	w.C	= C;
+	w.X	= X;
+	w.n	= n;
+	w.d	= d;
+	RunInParallel( DistanceRows, &w, Procs );
+
+	//--------------------------------------------------------------------------
+	//	Fill the diagonal and the lower triangle.
+	//
+	for( i = 0; i < n; i++ )
+	{
+		C[ (size_t) i * n + i ] = 0.0;
+		for( j = i + 1; j < n; j++ )
+			C[ (size_t) j * n + i ] = C[ (size_t) i * n + j ];
+	}
+
+	return C;
+}
+
+
+static void FreeDistances( Real_T *C, Int_T n, Int_T Procs )
+{
+	if( Procs > n ) Procs = n;
+
+	FreeShared( C, (size_t) n * n * sizeof( Real_T ), Procs );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Bool_T Scenarios::ReduceScenarios( Int_T Keep,
+		Scenario::DistanceMode Mode, Int_T Procs )
+
+PURPOSE:
+	Reduces the scenarios to "Keep" of them by the fast forward selection (see
+the file header). Let "c(i,j)" be the distance of scenarios "i" and "j", "p(i)"
+the probability of scenario "i" and "D(i)" the distance of scenario "i" to the
+nearest selected scenario (infinite at first, zero for the selected ones). In
+every step the scenario "u" that minimizes
+
+		z(u) = sum_i p(i) * min( c(u,i), D(i) )
+
+(the distance of the original distribution to the selected scenarios and "u")
+is selected, and the distances "D" are updated. The probabilities of the
+scenarios that were not selected are then added to those of the nearest
+selected ones. The scenarios kept retain their order.
+	Nothing is done if there are no more than "Keep" scenarios.
+
+PARAMETERS:
+	Int_T Keep
+		Number of the scenarios to keep.
+
+	Scenario::DistanceMode Mode
+		Distance of the scenarios ("STD_NORM" or "WEIGHTED_NORM").
+
+	Int_T Procs
+		Number of the processes computing the distance matrix.
+
+RETURN VALUE:
+	Success status (the reduction fails if there are too many scenarios, or if
+the memory for the distance matrix can not be allocated).
+
+SIDE EFFECTS:
+	Changes the set of scenarios.
+
+------------------------------------------------------------------------------*/
+
+Bool_T Scenarios::ReduceScenarios( Int_T Keep, // )
+	Scenario::DistanceMode Mode, Int_T Procs )
+{
+	assert( status == SCENARIOS_READY );
+	assert( Keep > 0 && Procs > 0 );
+	assert( Mode == Scenario::STD_NORM || Mode == Scenario::WEIGHTED_NORM );
+
+	const Int_T n = ScenNum;
+	Int_T i, k, s, u;
+
+	if( Keep >= n ) return True;
+
+	if( n > MAX_REDUCED_SCEN_NUM )
+	{
+		Error( "Too many scenarios to reduce: %d (at most %d allowed).",
+			(int) n, (int) MAX_REDUCED_SCEN_NUM );
+		return False;
+	}
+
+	//--------------------------------------------------------------------------
+	//	Copy the (weighted) random data of the scenarios into the rows of a
+	//	dense matrix.
+	//
+	Array<Real_T> X;
+	const Int_T d = GetScenarioData( X, Mode );
+
+	//--------------------------------------------------------------------------
+	//	Compute the distance matrix.
+	//
+	Real_T *C = ComputeDistances( &X[0], n, d, Procs );
+
+	if( C == NULL )
+	{
+		Error( "Not enough memory for the distance matrix of %d scenarios.",
+			(int) n );
+		return False;
+	}
+
+#ifndef NDEBUG
+	//--------------------------------------------------------------------------
+	//	Compare a few distances with those of "Scenario::GetDistance()".
+	//
+	Scenario::SetDistanceMode( Mode );
+	for( s = 1; s < n && s < 16; s++ )
+	{
+		Real_T ref = GetDistance( 0, s );
+		assert( fabs( C[s] - ref ) <= 1.0e-9 * ( 1.0 + fabs( ref ) ) );
+	}
+#endif
+
+	//--------------------------------------------------------------------------
+	//	The fast forward selection.
+	//
+	Array<Real_T> P( n ), D( n, HUGE_VAL );
+	Array<Int_T> Nearest( n, -1 ), Kept( Keep );
+	Array<Bool_T> Selected( n, False );
+
+	for( s = 0; s < n; s++ )
+		P[s] = ScenProb[s];
+
+	for( k = 0; k < Keep; k++ )
+	{
+		Int_T best = -1;
+		Real_T bestZ = HUGE_VAL;
+		const Real_T *p = &P[0], *dd = &D[0];
+
+		for( u = 0; u < n; u++ )
+		{
+			if( Selected[u] ) continue;
+
+			const Real_T *cu = C + (size_t) u * n;
+			Real_T z0 = 0.0, z1 = 0.0;
+
+			for( i = 0; i + 2 <= n; i += 2 )
+			{
+				z0 += p[i]   * ( ( cu[i]   < dd[i]   ) ? cu[i]   : dd[i]   );
+				z1 += p[i+1] * ( ( cu[i+1] < dd[i+1] ) ? cu[i+1] : dd[i+1] );
+			}
+			if( i < n )
+				z0 += p[i] * ( ( cu[i] < dd[i] ) ? cu[i] : dd[i] );
+
+			if( z0 + z1 < bestZ )
+			{
+				bestZ	= z0 + z1;
+				best	= u;
+			}
+		}
+
+		assert( best >= 0 );
+
+		const Real_T *cb = C + (size_t) best * n;
+
+		Selected[best]	= True;
+		Kept[k]			= best;
+		for( i = 0; i < n; i++ )
+			if( cb[i] < D[i] )
+			{
+				D[i]		= cb[i];
+				Nearest[i]	= best;
+			}
+		D[best]			= 0.0;
+		Nearest[best]	= best;
+	}
+
+	FreeDistances( C, n, Procs );
+
+	//--------------------------------------------------------------------------
+	//	Keep the selected scenarios in their original order. Redistribute the
+	//	probabilities.
+	//
+	Array<Int_T> Pos( n, -1 );
+	Array<Real_T> Prob( Keep, 0.0 );
+	Real_T Dist = 0.0;
+
+	for( s = 0, k = 0; s < n; s++ )
+		if( Selected[s] )
+		{
+			Pos[s] = k;
+			Kept[k++] = s;
+		}
+	assert( k == Keep );
+
+	for( s = 0; s < n; s++ )
+	{
+		Prob[ Pos[ Nearest[s] ] ] += P[s];
+		Dist += P[s] * D[s];
+	}
+
+	KeepScenarios( &Kept[0], &Prob[0], Keep );
+
+	Print( "\n\tSCENARIO REDUCTION: FAST FORWARD SELECTION.\n"
+		"\t%-40s%12d\n\t%-40s%12d\n\t%-40s%12.0f\n\t%-40s%12.2E\n",
+		"Scenarios:", (int) n, "Scenarios kept:", (int) Keep,
+		"The number of scenario comparisons:", 0.5 * n * ( n - 1.0 ),
+		"Distance to the original distribution:", Dist );
+
+	return True;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void Scenarios::KeepScenarios( const Int_T *Kept, const Real_T *Prob,
+		Int_T Num )
+
+PURPOSE:
+	Keeps only the "Num" scenarios listed (in increasing order) in "Kept" and
+gives them the probabilities "Prob". They become scenarios "0", ..., "Num-1".
+The realizations of the continuous distributions are moved with them.
+
+PARAMETERS:
+	const Int_T *Kept, const Real_T *Prob, Int_T Num
+		Scenario numbers, their new probabilities and the number of scenarios.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void Scenarios::KeepScenarios( const Int_T *Kept, const Real_T *Prob, // )
+	Int_T Num )
+{
+	assert( Kept != NULL && Prob != NULL );
+	assert( Num > 0 && Num <= ScenNum );
+
+	for( Int_T k = 0; k < Num; k++ )
+	{
+		Int_T s = Kept[k];
+
+		assert( s >= k && s < ScenNum );
+		assert( k == 0 || s > Kept[k-1] );
+
+		if( s != k )
+			for( Int_T i = 0; i < len; i++ )
+			{
+				SetIndex( k, i, GetIndex( s, i ) );
+				dist[i]->CopyRealization( k, *dist[i], s );
+			}
+		ScenProb[k] = Prob[k];
+	}
+
+	ScenNum = Num;
+	ResizeScenarios( Num );
+}
+
+#endif
@@ -14,21 +14,45 @@ SOURCE FILE NAME:	scentree.cpp
 CREATED:			1994.08.07
 LAST MODIFIED:		1996.02.03
 
-DEPENDENCIES:		scentree.h, scenario.h, error.h, print.h
-		            <assert.h>
+DEPENDENCIES:		scentree.h, scenario.h, distcomp.h, error.h, print.h
+		            <assert.h>, <stdlib.h>, <math.h>
 
 --------------------------------------------------------------------------------
 
 SOURCE FILE CONTENTS:
-	x
+	Construction of the tree of scenarios. The scenarios are the nodes of a
+complete graph, the lengths of its arcs are the distances of the scenarios
+("STD_NORM", i.e. the sum of absolute differences of the random data). A short
+spanning tree of the graph is found and the scenarios are ordered so that each
+one comes after its parent in the tree.
+	By default ("NEAREST_NEIGHBOUR_TREE", see "scentree.h") the tree is built
+from the nearest neighbours of the scenarios, found with a k-d tree (J. L.
+Bentley, "Multidimensional binary search trees used for associative
+searching", Comm. ACM 18 (1975), 509-517) over the rows of the dense scenario
+data matrix (see "Scenarios::GetScenarioData()"). The cheapest spanning forest
+of the graph of "NEIGHBOUR_NUM" nearest neighbours is found by Kruskal's
+algorithm; its trees are then joined by the Boruvka steps (each tree except
+the largest one is connected to the nearest scenario of another tree). A
+search makes at most "MAX_COMPARISONS" distance computations (once something is
+found), so the construction takes O( N log N ) time for "N" scenarios (instead
+of the O( N^2 ) of the Prim-Dijkstra algorithm), which allows for the
+"-restart tree" option on large samples. In many dimensions the neighbours
+found are not always the nearest ones, and so the tree is a little longer than
+the cheapest one (by up to 8% on the test problems). The neighbour searches
+may be done by several processes in parallel (see "RunInParallel()").
 
 ------------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <stdlib.h>
+#include <math.h>
 
 #ifndef __SCENTREE_H__
 #   include "scentree.h"
 #endif
+#ifndef __DISTCOMP_H__
+#	include "distcomp.h"
+#endif
 #ifndef __ERROR_H__
 #   include "error.h"
 #endif
@@ -45,9 +69,7 @@ PURPOSE:
 	Generates a set of scenarios using the underlying class "Scenarios" and its
 "GenerateScenarios()" function. Then proceeds to create a tree of scenarios. It
 is supposed to be the "cheapest" spanning tree with respect to the sum of
-distances between scenarios connected by arcs.
-	For this purpose a smart (well, at least I believe it's smart) heuristic
-strategy is developed.
+distances between scenarios connected by arcs (see the file header).
 
 PARAMETERS:
 	Int_T &num
@@ -79,14 +101,27 @@ Bool_T TreeOfScenarios::GenerateScenarios( Int_T &num )
 	//	Calculate the cost of traversing the scenarios in the order in which
 	//	they are generated.
 	//
-	Scenario::SetDistanceMode( Scenario::DISCRETE_MEASURE );
+	Scenario::SetDistanceMode( Scenario::STD_NORM );
 	Scenario::ResetDistanceCalculationCnt();
 
 	Print( "\n\tSCENARIO ORDERING ROUTINE: SPANNING TREE GENERATION.\n"
 		"\t%-40s%12.2E.\n",
 		"The cost in scenario generation order:", TotalStraightCost() );
 
-#ifdef PRIM_DIJKSTRA_ALGORITHM
+#if defined( NEAREST_NEIGHBOUR_TREE )
+	//==========================================================================
+	//
+	//	Short spanning tree generation from the nearest neighbours.
+	//
+	//==========================================================================
+
+	Array<Int_T> Graph( ScenNum );		//	Graph of the nodes.
+
+	Long_T Cnt = MakeTreeByNearestNeighbours( Graph );
+	Print( "\t%-40s%12ld\n", "The number of scenario comparisons:",
+		(long) Cnt );
+
+#elif defined( PRIM_DIJKSTRA_ALGORITHM )
 	//==========================================================================
 	//
 	//	Cheapest spanning tree generation by Prim-Dijkstra algorithm.
@@ -154,7 +189,770 @@ Bool_T TreeOfScenarios::GenerateScenarios( Int_T &num )
 }
 
 
-#ifdef PRIM_DIJKSTRA_ALGORITHM
+#if defined( NEAREST_NEIGHBOUR_TREE )
+
+//------------------------------------------------------------------------------
+//	The largest number of scenarios in a leaf of the k-d tree, the number of
+//	the nearest neighbours of each scenario used to build the spanning forest
+//	and the number of scenario comparisons after which a neighbour search is
+//	stopped.
+//
+#define KD_LEAF_SIZE		(8)
+#define NEIGHBOUR_NUM		(8)
+#define MAX_COMPARISONS		(128)
+//
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+//	A k-d tree over the rows of the "n" by "d" data matrix "X". Each node
+//	holds the points "Perm[Lo]", ..., "Perm[Hi-1]". An internal node splits
+//	them on coordinate "Dim" at "Split": its "Left" subtree holds the points
+//	with the coordinate not greater, its "Right" subtree the points with the
+//	coordinate not smaller than "Split". A leaf has no subtrees ("Left" and
+//	"Right" are -1). The root is node 0.
+//
+struct KD_Node
+{
+	Int_T Lo, Hi;
+	Int_T Dim;
+	Real_T Split;
+	Int_T Left, Right;
+};
+
+struct KD_Tree
+{
+	const Real_T *X;
+	Int_T n, d;
+
+	Array<Int_T> Perm;
+	Array<KD_Node> Node;
+	Int_T NodeNum;
+};
+
+
+//------------------------------------------------------------------------------
+//	A nearest neighbour search: the "K" points nearest to point "Self" other
+//	than itself (and, if "Comp" is not NULL, other than the points of its
+//	component "Comp[Self]"), but nearer than the initial "Limit". The
+//	distances of those found so far are kept in the ascending order in "Dist"
+//	(their numbers in "Ind"); once "K" are found, "Limit" is the largest of
+//	them. "Off" holds the distance of the point from the current k-d tree cell
+//	along each coordinate.
+//
+struct KD_Search
+{
+	const KD_Tree *Tree;
+	const Real_T *q;
+	Int_T Self;
+	const Int_T *Comp;
+
+	Int_T K, Found;
+	Int_T *Ind;
+	Real_T *Dist;
+	Real_T Limit;
+	Real_T *Off;
+	Long_T Cnt;
+};
+
+
+//------------------------------------------------------------------------------
+//	The data of the parallel neighbour searches: the "K" nearest neighbours of
+//	the points "Points[0]", ..., "Points[PointNum-1]" (of all points, if
+//	"Points" is NULL) are found. The results (in the shared memory) are stored
+//	"K" per point; "Cnt" holds the number of distance computations.
+//	If "Comp" is given, the nearest point of another component is sought
+//	("K" is 1). Only the nearest such point of the whole component is needed,
+//	so a point's search is limited by the nearest one found for the other
+//	points of its component (by the same process); it finds nothing ("Ind"
+//	is -1), if there is no nearer one. The points should be sorted by their
+//	components.
+//
+struct NeighbourWork
+{
+	const KD_Tree *Tree;
+	const Int_T *Points;
+	Int_T PointNum;
+	const Int_T *Comp;
+	Int_T K;
+
+	Int_T *Ind;
+	Real_T *Dist;
+	Long_T *Cnt;
+};
+
+
+//------------------------------------------------------------------------------
+//	An arc of the graph.
+//
+struct GraphArc
+{
+	Real_T Dist;
+	Int_T i, j;
+};
+
+
+/*------------------------------------------------------------------------------
+
+	static void SelectPoint( KD_Tree &t, Int_T Dim, Int_T Lo, Int_T Hi,
+		Int_T k )
+	static Int_T BuildNode( KD_Tree &t, Int_T Lo, Int_T Hi )
+	static void BuildTree( KD_Tree &t, const Real_T *X, Int_T n, Int_T d )
+
+PURPOSE:
+	The k-d tree construction. The first function permutes the points
+"t.Perm[Lo]", ..., "t.Perm[Hi-1]" so that the one with the "k"-th smallest
+coordinate "Dim" comes "k"-th, those with the coordinate not greater before it
+and the rest after it (C. A. R. Hoare's "FIND"). The second one creates a node
+of the points "t.Perm[Lo]", ..., "t.Perm[Hi-1]" and its subtrees. The points
+are split at the median of the coordinate with the largest spread. The last
+one builds the whole tree.
+
+PARAMETERS:
+	KD_Tree &t
+		The tree.
+
+	Int_T Dim, Int_T Lo, Int_T Hi, Int_T k
+		The coordinate, the range of the points and the position.
+
+	const Real_T *X, Int_T n, Int_T d
+		The "n" by "d" data matrix (stored by rows).
+
+RETURN VALUE:
+	The number of the new node (the second function).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static void SelectPoint( KD_Tree &t, Int_T Dim, Int_T Lo, Int_T Hi, // )
+	Int_T k )
+{
+	Int_T *p = &t.Perm[0];
+	const Real_T *x = t.X + Dim;
+	const Int_T d = t.d;
+
+	for( Hi--; Lo < Hi; )
+	{
+		Real_T Pivot = x[ (size_t) p[ ( Lo + Hi ) / 2 ] * d ];
+		Int_T i = Lo, j = Hi;
+
+		while( i <= j )
+		{
+			while( x[ (size_t) p[i] * d ] < Pivot ) i++;
+			while( x[ (size_t) p[j] * d ] > Pivot ) j--;
+			if( i <= j )
+			{
+				Int_T tmp = p[i];
+
+				p[i++]	= p[j];
+				p[j--]	= tmp;
+			}
+		}
+
+		if( k <= j )		Hi = j;
+		else if( k >= i )	Lo = i;
+		else				break;
+	}
+}
+
+
+static Int_T BuildNode( KD_Tree &t, Int_T Lo, Int_T Hi )
+{
+	const Int_T node = t.NodeNum++;
+
+	t.Node[node].Lo		= Lo;
+	t.Node[node].Hi		= Hi;
+	t.Node[node].Left	= t.Node[node].Right = -1;
+
+	if( Hi - Lo <= KD_LEAF_SIZE ) return node;
+
+	//--------------------------------------------------------------------------
+	//	Find the coordinate with the largest spread. Identical points form a
+	//	leaf.
+	//
+	Int_T Dim = -1, i, k;
+	Real_T Spread = 0.0;
+
+	for( k = 0; k < t.d; k++ )
+	{
+		Real_T Min, Max;
+
+		Min = Max = t.X[ (size_t) t.Perm[Lo] * t.d + k ];
+		for( i = Lo + 1; i < Hi; i++ )
+		{
+			Real_T v = t.X[ (size_t) t.Perm[i] * t.d + k ];
+
+			if( v < Min ) Min = v;
+			else if( v > Max ) Max = v;
+		}
+		if( Max - Min > Spread )
+		{
+			Spread	= Max - Min;
+			Dim		= k;
+		}
+	}
+
+	if( Dim < 0 ) return node;
+
+	//--------------------------------------------------------------------------
+	//	Split at the median. The points with the coordinate equal to the
+	//	median are not separated (with discrete distributions there are many
+	//	of them): they are gathered around the median and the split is moved
+	//	to the nearer end of their range. The splitting value is chosen so
+	//	that the search for any of the points starts in its own subtree (see
+	//	"SearchNode()": the points with the coordinate smaller than "Split" go
+	//	left, the others right).
+	//
+	Int_T Mid = Int_T( ( Lo + Hi ) / 2 );
+
+	SelectPoint( t, Dim, Lo, Hi, Mid );
+
+	Int_T *p = &t.Perm[0];
+	const Real_T *x = t.X + Dim;
+	const Real_T v = x[ (size_t) p[Mid] * t.d ];
+	Int_T EqLo = Mid, EqHi = Mid + 1, tmp;
+
+	for( i = Mid - 1; i >= Lo; i-- )
+		if( x[ (size_t) p[i] * t.d ] == v )
+		{
+			tmp = p[i]; p[i] = p[--EqLo]; p[EqLo] = tmp;
+		}
+	for( i = Mid + 1; i < Hi; i++ )
+		if( x[ (size_t) p[i] * t.d ] == v )
+		{
+			tmp = p[i]; p[i] = p[EqHi]; p[EqHi++] = tmp;
+		}
+
+	t.Node[node].Dim	= Dim;
+	t.Node[node].Split	= v;
+
+	if( EqLo > Lo && ( Mid - EqLo <= EqHi - Mid || EqHi == Hi ) )
+		Mid = EqLo;
+	else
+	{
+		Real_T Next = x[ (size_t) p[EqHi] * t.d ];
+
+		for( i = EqHi + 1; i < Hi; i++ )
+			if( x[ (size_t) p[i] * t.d ] < Next )
+				Next = x[ (size_t) p[i] * t.d ];
+
+		Mid					= EqHi;
+		t.Node[node].Split	= 0.5 * ( v + Next );
+	}
+	assert( Mid > Lo && Mid < Hi );
+
+	Int_T l = BuildNode( t, Lo, Mid );
+	Int_T r = BuildNode( t, Mid, Hi );
+
+	t.Node[node].Left	= l;
+	t.Node[node].Right	= r;
+
+	return node;
+}
+
+
+static void BuildTree( KD_Tree &t, const Real_T *X, Int_T n, Int_T d )
+{
+	assert( X != NULL && n > 0 && d >= 0 );
+
+	const Int_T MaxNodes = Int_T( 2 * n );
+
+	t.X	= X;
+	t.n	= n;
+	t.d	= d;
+
+	t.Perm.Resize( n );
+	t.Node.Resize( MaxNodes );
+	t.NodeNum = 0;
+
+	for( Int_T i = 0; i < n; i++ )
+		t.Perm[i] = i;
+
+	BuildNode( t, 0, n );
+	assert( t.NodeNum <= MaxNodes );
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static void SearchNode( KD_Search &s, Int_T node, Real_T rd )
+	static void FindNeighbours( void *Data, Int_T First, Int_T Step )
+
+PURPOSE:
+	The first function continues the nearest neighbour search "s" in the
+subtree of "node". The cells of its subtrees are searched nearer first; the
+farther one is skipped when even its lower bound on the distance is not
+smaller than that of the "K"-th neighbour found so far. The bound is updated
+incrementally (S. Arya and D. M. Mount, "Algorithms for fast vector
+quantization", Proc. DCC '93, 381-390): it is the sum of the distances of the
+point from the cell along each coordinate, and only one of them changes at a
+split. In many dimensions the bound seldom allows skipping anything, so the
+search is stopped after "MAX_COMPARISONS" distance computations (once "K"
+neighbours are found): the neighbours found are then only approximately the
+nearest ones, but they come from the nearest cells.
+	The second function is a task for "RunInParallel()": it makes the searches
+"First", "First + Step", ... of a "NeighbourWork".
+
+PARAMETERS:
+	KD_Search &s
+		The search.
+
+	Int_T node, Real_T rd
+		The node and the lower bound on the distance of its cell.
+
+	void *Data
+		The "NeighbourWork" structure.
+
+	Int_T First, Int_T Step
+		The searches to make.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static void SearchNode( KD_Search &s, Int_T node, Real_T rd )
+{
+	const KD_Tree &t = *s.Tree;
+	const KD_Node &nd = t.Node[node];
+
+	//--------------------------------------------------------------------------
+	//	Leaf: compute the distances.
+	//
+	if( s.Limit < HUGE_VAL && s.Cnt >= MAX_COMPARISONS ) return;
+
+	if( nd.Left < 0 )
+	{
+		const Int_T *Perm = &t.Perm[0];
+
+		for( Int_T i = nd.Lo; i < nd.Hi; i++ )
+		{
+			Int_T j = Perm[i];
+
+			if( s.Limit < HUGE_VAL && s.Cnt >= MAX_COMPARISONS ) break;
+
+			if( j == s.Self || ( s.Comp && s.Comp[j] == s.Comp[s.Self] ) )
+				continue;
+
+			Real_T dist = L1_Distance( s.q, t.X + (size_t) j * t.d, t.d );
+			s.Cnt++;
+
+			if( dist >= s.Limit ) continue;
+
+			Int_T k = ( s.Found < s.K ) ? s.Found++ : Int_T( s.K - 1 );
+
+			for( ; k > 0 && s.Dist[k-1] > dist; k-- )
+			{
+				s.Dist[k]	= s.Dist[k-1];
+				s.Ind[k]	= s.Ind[k-1];
+			}
+			s.Dist[k]	= dist;
+			s.Ind[k]	= j;
+
+			if( s.Found == s.K ) s.Limit = s.Dist[s.K-1];
+		}
+		return;
+	}
+
+	//--------------------------------------------------------------------------
+	//	Internal node: search the nearer subtree, then the farther one (if it
+	//	may contain a point near enough).
+	//
+	const Int_T Dim = nd.Dim;
+	const Real_T diff = s.q[Dim] - nd.Split;
+
+	SearchNode( s, ( diff < 0.0 ) ? nd.Left : nd.Right, rd );
+
+	const Real_T Old = s.Off[Dim],
+		FarRd = rd - Old + fabs( diff );
+
+	if( FarRd < s.Limit )
+	{
+		s.Off[Dim] = fabs( diff );
+		SearchNode( s, ( diff < 0.0 ) ? nd.Right : nd.Left, FarRd );
+		s.Off[Dim] = Old;
+	}
+}
+
+
+static void FindNeighbours( void *Data, Int_T First, Int_T Step )
+{
+	const NeighbourWork &w = *(const NeighbourWork *) Data;
+	const KD_Tree &t = *w.Tree;
+	Array<Real_T> Off( t.d + 1 ), Bound( ( w.Comp != NULL ) ? t.n : 1 );
+
+	assert( w.Comp == NULL || w.K == 1 );
+	Bound.Fill( HUGE_VAL, ( w.Comp != NULL ) ? t.n : 1 );
+
+	for( Int_T q = First; q < w.PointNum; q += Step )
+	{
+		KD_Search s;
+
+		s.Tree	= &t;
+		s.Self	= ( w.Points != NULL ) ? w.Points[q] : q;
+		s.q		= t.X + (size_t) s.Self * t.d;
+		s.Comp	= w.Comp;
+		s.K		= w.K;
+		s.Found	= 0;
+		s.Ind	= w.Ind + (size_t) q * w.K;
+		s.Dist	= w.Dist + (size_t) q * w.K;
+		s.Limit	= ( w.Comp != NULL ) ? Bound[ w.Comp[s.Self] ] : HUGE_VAL;
+		s.Off	= &Off[0];
+		s.Cnt	= 0;
+
+		Off.Fill( 0.0, t.d + 1 );
+		SearchNode( s, 0, 0.0 );
+
+		for( Int_T k = s.Found; k < s.K; k++ )
+			s.Ind[k] = -1;
+		if( w.Comp != NULL && s.Found > 0 )
+			Bound[ w.Comp[s.Self] ] = s.Dist[0];
+		w.Cnt[q] = s.Cnt;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static Long_T RunSearches( NeighbourWork &w, Int_T Procs )
+
+PURPOSE:
+	Makes the nearest neighbour searches of "w" by "Procs" processes. Allocates
+the results (they have to be freed by "FreeSearches()").
+
+PARAMETERS:
+	NeighbourWork &w
+		The searches ("Tree", "Points", "PointNum", "Comp" and "K" have to be
+		set).
+
+	Int_T Procs
+		Number of processes.
+
+RETURN VALUE:
+	The number of distance computations.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static Long_T RunSearches( NeighbourWork &w, Int_T Procs )
+{
+	assert( w.PointNum > 0 && w.K > 0 );
+
+	if( Procs > w.PointNum ) Procs = w.PointNum;
+
+	w.Ind	= (Int_T *) AllocShared( (size_t) w.PointNum * w.K *
+		sizeof( Int_T ), Procs );
+	w.Dist	= (Real_T *) AllocShared( (size_t) w.PointNum * w.K *
+		sizeof( Real_T ), Procs );
+	w.Cnt	= (Long_T *) AllocShared( (size_t) w.PointNum * sizeof( Long_T ),
+		Procs );
+
+	if( w.Ind == NULL || w.Dist == NULL || w.Cnt == NULL )
+		FatalError( "Out of memory." );
+
+	RunInParallel( FindNeighbours, &w, Procs );
+
+	Long_T Cnt = 0;
+
+	for( Int_T q = 0; q < w.PointNum; q++ )
+		Cnt += w.Cnt[q];
+
+	return Cnt;
+}
+
+
+static void FreeSearches( NeighbourWork &w, Int_T Procs )
+{
+	if( Procs > w.PointNum ) Procs = w.PointNum;
+
+	FreeShared( w.Ind, (size_t) w.PointNum * w.K * sizeof( Int_T ), Procs );
+	FreeShared( w.Dist, (size_t) w.PointNum * w.K * sizeof( Real_T ), Procs );
+	FreeShared( w.Cnt, (size_t) w.PointNum * sizeof( Long_T ), Procs );
+	w.Ind	= NULL;
+	w.Dist	= NULL;
+	w.Cnt	= NULL;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	static int CompareArcs( const void *a1, const void *a2 )
+	static Int_T FindRoot( Array<Int_T> &Parent, Int_T i )
+
+PURPOSE:
+	The first function compares two arcs for "qsort()" (shorter first, ties
+broken by the node numbers, so that the order does not depend on the sorting
+algorithm). The second one finds the representative of the set of node "i" in
+the disjoint set forest "Parent" (and halves the path on the way).
+
+PARAMETERS:
+	const void *a1, const void *a2
+		The arcs.
+
+	Array<Int_T> &Parent, Int_T i
+		The forest and the node.
+
+RETURN VALUE:
+	A negative, zero or a positive number (the first function) and the
+representative (the second one).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+static int CompareArcs( const void *a1, const void *a2 )
+{
+	const GraphArc &x = *(const GraphArc *) a1,
+		&y = *(const GraphArc *) a2;
+
+	if( x.Dist != y.Dist )	return ( x.Dist < y.Dist ) ? -1 : 1;
+	if( x.i != y.i )		return ( x.i < y.i ) ? -1 : 1;
+	if( x.j != y.j )		return ( x.j < y.j ) ? -1 : 1;
+	return 0;
+}
+
+
+static Int_T FindRoot( Array<Int_T> &Parent, Int_T i )
+{
+	while( Parent[i] != i )
+	{
+		Parent[i]	= Parent[ Parent[i] ];
+		i			= Parent[i];
+	}
+	return i;
+}
+
+
+/*------------------------------------------------------------------------------
+
+	Long_T TreeOfScenarios::MakeTreeByNearestNeighbours( Array<Int_T> &Graph )
+
+PURPOSE:
+	Creates a short spanning tree in the complete graph of "ScenNum" nodes from
+the nearest neighbours of the nodes (see the file header). The tree is rooted
+at node 0.
+
+PARAMETERS:
+	Array<Int_T> &Graph
+		The array that will store the graph of the spanning tree.
+
+RETURN VALUE:
+	The number of scenario comparisons (distance computations).
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+Long_T TreeOfScenarios::MakeTreeByNearestNeighbours( Array<Int_T> &Graph )
+{
+	const Int_T n = ScenNum;
+	Int_T i, k;
+	Long_T Cnt = 0;
+
+	Graph.Fill( -1, n );
+	if( n == 1 ) return 0;
+
+	//--------------------------------------------------------------------------
+	//	Build the k-d tree of the scenario data.
+	//
+	Array<Real_T> X;
+	const Int_T d = GetScenarioData( X, Scenario::STD_NORM );
+	KD_Tree t;
+
+	BuildTree( t, &X[0], n, d );
+
+	//--------------------------------------------------------------------------
+	//	Find the nearest neighbours of all scenarios and sort the arcs to
+	//	them.
+	//
+	NeighbourWork w;
+
+	w.Tree		= &t;
+	w.Points	= NULL;
+	w.PointNum	= n;
+	w.Comp		= NULL;
+	w.K			= ( NEIGHBOUR_NUM < n - 1 ) ? NEIGHBOUR_NUM : Int_T( n - 1 );
+
+	Cnt += RunSearches( w, Procs );
+
+	Array<GraphArc> Arc( (size_t) n * w.K );
+	Int_T ArcNum = 0;
+
+	for( i = 0; i < n; i++ )
+		for( k = 0; k < w.K; k++ )
+		{
+			Int_T j = w.Ind[ (size_t) i * w.K + k ];
+
+			if( j < 0 ) break;
+
+			GraphArc &a = Arc[ArcNum++];
+
+			a.Dist	= w.Dist[ (size_t) i * w.K + k ];
+			a.i		= ( i < j ) ? i : j;
+			a.j		= ( i < j ) ? j : i;
+		}
+	FreeSearches( w, Procs );
+
+	qsort( &Arc[0], ArcNum, sizeof( GraphArc ), CompareArcs );
+
+	//--------------------------------------------------------------------------
+	//	Kruskal's algorithm: the cheapest spanning forest of the neighbour
+	//	graph. The arcs of the tree are stored in "TreeI" and "TreeJ".
+	//
+	Array<Int_T> Parent( n ), Size( n, 1 ), TreeI( n ), TreeJ( n );
+	Int_T TreeArcs = 0;
+
+	for( i = 0; i < n; i++ )
+		Parent[i] = i;
+
+	for( k = 0; k < ArcNum && TreeArcs < n - 1; k++ )
+	{
+		Int_T ri = FindRoot( Parent, Arc[k].i ),
+			rj = FindRoot( Parent, Arc[k].j );
+
+		if( ri == rj ) continue;
+
+		if( Size[ri] < Size[rj] ) { Int_T tmp = ri; ri = rj; rj = tmp; }
+		Parent[rj]	= ri;
+		Size[ri]	+= Size[rj];
+
+		TreeI[TreeArcs]		= Arc[k].i;
+		TreeJ[TreeArcs++]	= Arc[k].j;
+	}
+
+	//--------------------------------------------------------------------------
+	//	Boruvka steps: while there is more than one tree, connect every tree
+	//	but the largest one to the nearest node of another tree.
+	//
+	Array<Int_T> Comp( n ), Points( n ), BestFrom( n ), BestTo( n );
+	Array<Real_T> BestDist( n );
+
+	while( TreeArcs < n - 1 )
+	{
+		Int_T Largest = -1, PointNum = 0;
+
+		for( i = 0; i < n; i++ )
+		{
+			Comp[i] = FindRoot( Parent, i );
+			if( Largest < 0 || Size[ Comp[i] ] > Size[Largest] )
+				Largest = Comp[i];
+		}
+		//
+		//	The points of the other trees, sorted by the trees (a counting
+		//	sort; "BestFrom" is used as the work array).
+		//
+		BestFrom.Fill( 0, n );
+		for( i = 0; i < n; i++ )
+			if( Comp[i] != Largest )
+				BestFrom[ Comp[i] ]++;
+		for( i = 0; i < n; i++ )
+		{
+			Int_T c = BestFrom[i];
+
+			BestFrom[i]	= PointNum;
+			PointNum	+= c;
+		}
+		for( i = 0; i < n; i++ )
+			if( Comp[i] != Largest )
+				Points[ BestFrom[ Comp[i] ]++ ] = i;
+
+		w.Points	= &Points[0];
+		w.PointNum	= PointNum;
+		w.Comp		= &Comp[0];
+		w.K			= 1;
+
+		Cnt += RunSearches( w, Procs );
+
+		//
+		//	The nearest node of another tree for each tree.
+		//
+		BestTo.Fill( -1, n );
+		for( k = 0; k < PointNum; k++ )
+		{
+			Int_T c = Comp[ Points[k] ];
+
+			if( w.Ind[k] < 0 ) continue;
+			if( BestTo[c] < 0 || w.Dist[k] < BestDist[c] )
+			{
+				BestDist[c]	= w.Dist[k];
+				BestFrom[c]	= Points[k];
+				BestTo[c]	= w.Ind[k];
+			}
+		}
+		FreeSearches( w, Procs );
+
+		for( i = 0; i < n; i++ )
+			if( BestTo[i] >= 0 )
+			{
+				Int_T ri = FindRoot( Parent, BestFrom[i] ),
+					rj = FindRoot( Parent, BestTo[i] );
+
+				if( ri == rj ) continue;
+
+				if( Size[ri] < Size[rj] ) { Int_T tmp = ri; ri = rj; rj = tmp; }
+				Parent[rj]	= ri;
+				Size[ri]	+= Size[rj];
+
+				TreeI[TreeArcs]		= BestFrom[i];
+				TreeJ[TreeArcs++]	= BestTo[i];
+			}
+	}
+	assert( TreeArcs == n - 1 );
+
+	//--------------------------------------------------------------------------
+	//	Orient the tree: a breadth-first search from node 0 over the lists of
+	//	the tree arcs adjacent to each node.
+	//
+	Array<Int_T> Start( n + 1, 0 ), Adj( 2 * n ), Queue( n );
+
+	for( k = 0; k < TreeArcs; k++ )
+	{
+		Start[ TreeI[k] + 1 ]++;
+		Start[ TreeJ[k] + 1 ]++;
+	}
+	for( i = 0; i < n; i++ )
+		Start[i+1] += Start[i];
+	for( k = 0; k < TreeArcs; k++ )
+	{
+		Adj[ Start[ TreeI[k] ]++ ] = TreeJ[k];
+		Adj[ Start[ TreeJ[k] ]++ ] = TreeI[k];
+	}
+	for( i = n; i > 0; i-- )
+		Start[i] = Start[i-1];
+	Start[0] = 0;
+
+	Array<Bool_T> mark( n, False );
+	Int_T Head = 0, Tail = 0;
+
+	Queue[Tail++]	= 0;
+	mark[0]			= True;
+	while( Head < Tail )
+	{
+		Int_T node = Queue[Head++];
+
+		for( k = Start[node]; k < Start[node+1]; k++ )
+			if( !mark[ Adj[k] ] )
+			{
+				mark[ Adj[k] ]	= True;
+				Graph[ Adj[k] ]	= node;
+				Queue[Tail++]	= Adj[k];
+			}
+	}
+	assert( Tail == n );
+
+	return Cnt;
+}
+
+#elif defined( PRIM_DIJKSTRA_ALGORITHM )
 
 /*------------------------------------------------------------------------------
 
@@ -672,7 +1470,7 @@ Int_T TreeOfScenarios::CountSubTrees( Array<Int_T> &ChainArray, // )
 	return SubTreeCnt;
 }
 
-#endif // ifdef PRIM_DIJKSTRA_ALGORITHM
+#endif // if defined( NEAREST_NEIGHBOUR_TREE )
 
 
 /*------------------------------------------------------------------------------
@@ -20,7 +20,10 @@ DEPENDENCIES:		stdtype.h, smartptr.h, scenario.h
 --------------------------------------------------------------------------------
 
 HEADER CONTENTS:
-	x
+	Declaration of class "TreeOfScenarios": a scenario repository, which
+orders the scenarios along a short spanning tree, so that each subproblem may
+be restarted from the solution of a similar one (see the "-restart tree"
+option).
 
 ------------------------------------------------------------------------------*/
 
@@ -31,7 +34,12 @@ HEADER CONTENTS:
 #	include "scenario.h"
 #endif
 
-#define PRIM_DIJKSTRA_ALGORITHM
+//
+//	The spanning tree is built from the nearest neighbours of the scenarios
+//	(see "scentree.cpp"). Define "PRIM_DIJKSTRA_ALGORITHM" instead to use the
+//	exact (and quadratic) Prim-Dijkstra algorithm.
+//
+#define NEAREST_NEIGHBOUR_TREE
 
 //==============================================================================
 //
@@ -49,6 +57,7 @@ private:
 								// of the "Order" array we store the index of
 								// it's predecessor in graph relative to the
 								// "Order" array.
+	Int_T Procs;				// Number of processes computing the distances.
 
 public:
 	//--------------------------------------------------------------------------
@@ -61,6 +70,7 @@ public:
 	//  Procedure for reading a scenario file and generating all scenarios.
 	//
 	virtual Bool_T GenerateScenarios( Int_T &num );
+	void SetProcesses( Int_T p );
 
 	//--------------------------------------------------------------------------
 	//  Data access functions: allow reading the scenarios once they are
@@ -76,7 +86,9 @@ public:
 	//
 private:
 
-#ifdef PRIM_DIJKSTRA_ALGORITHM
+#if defined( NEAREST_NEIGHBOUR_TREE )
+	Long_T MakeTreeByNearestNeighbours( Array<Int_T> &Graph );
+#elif defined( PRIM_DIJKSTRA_ALGORITHM )
 	void MakeTreeByPrimDijkstraAlgorithm( Array<Int_T> &Graph );
 #else
 	void MakeInitialGraph( Array<Int_T> &Graph );
@@ -111,7 +123,7 @@ private:
 
 inline
 TreeOfScenarios::TreeOfScenarios( void )
-	: Scenarios(), Order(), Predecessor()
+	: Scenarios(), Order(), Predecessor(), Procs( 1 )
 {}
 
 
@@ -120,13 +132,25 @@ TreeOfScenarios::~TreeOfScenarios( void )
 {}
 
 
+inline
+void TreeOfScenarios::SetProcesses( Int_T p )
+{
+	assert( p > 0 );
+	Procs = p;
+}
+
+
+//
+//	Note: the scenario objects are created on demand and may be reused (see
+//	"Scenarios::operator[]()").
+//
 inline
 Scenario & TreeOfScenarios::operator[]( int ScenarioNumber )
 {
 	assert( ScenNum > 0 );
 	assert( Order[ScenarioNumber] >= 0 && Order[ScenarioNumber] < ScenNum );
 
-	return *ArrayOfScenarios[ Order[ScenarioNumber] ];
+	return Materialize( Order[ScenarioNumber] );
 }
 
 
@@ -137,7 +161,7 @@ const
 	assert( ScenNum > 0 );
 	assert( Order[ScenarioNumber] >= 0 && Order[ScenarioNumber] < ScenNum );
 
-	return *ArrayOfScenarios[ ScenarioNumber ];
+	return Materialize( Order[ScenarioNumber] );
 }
 
 
@@ -103,6 +103,10 @@ Int_T Presolver::DealWithSigletonColumns( const int Mode )
 		for( LP.GetColumn( j, a, row, len ); len; ++a, ++row, --len )
 			if( !ExcludeRows[ *row ] ) break;
 
+		//	All the reductions below modify the row bounds or the costs.
+		//
+		if( !IsScenarioSafeRow( *row ) ) continue;
+
 		// Free singleton column.
 		//
 		if( ( Mode & LPR_SINGL_COLS ) &&
@@ -104,9 +104,13 @@ private:
 							//A2B gives which columns are basic 
 
 	Array<Real_T> X;		//solution x
+
+	Array<Real_T> Gamma;	//steepest edge weights (only if HasWeights)
+	Bool_T HasWeights;
 	
 	SolverStateDump( Int_T n, const Array<Int_T> &a2b, const Array<Real_T> &x,
-		Int_T AllocN );		//AllocN = Size of tables which store column-oriented data.
+		Int_T AllocN,		//AllocN = Size of tables which store column-oriented data.
+		const Array<Real_T> *gamma = NULL );
 
 public:
 	~SolverStateDump( void );
@@ -203,6 +207,7 @@ protected:
 		CYCLE_CNT;
 
 	PricingScheme Pricing;
+	Bool_T KeepWeights;		// Keep the SE weights over restarts.
 
 	Bool_T Initialized;
 
@@ -223,9 +228,12 @@ public:
 	SOLVE_RESULT RestartAndSolve( VerbLevel Verbosity, Long_T IterLimit = -1,
 		Bool_T ComputeDuals = True );
 	SOLVE_RESULT RestartAndSolve( VerbLevel Verbosity,
-		const SolverStateDump *dump, Long_T IterLimit = -1 );
+		const SolverStateDump *dump, Long_T IterLimit = -1,
+		Bool_T ComputePrimal = False );
 
 	SolverStateDump *GetSolverStateDump( void );
+	SolverStateDump *CreateSolverStateDump( const Array<Int_T> &Cols,
+		const Array<Int_T> &Rows );
 
 	enum CNT { Iter = 200, RC_Fault, PenaltyAdjust, TotalIter, ResidCheck,
 		SE_Reset, PrimVarCompute, DualVarCompute, AltPric, InfeasMin };
@@ -251,9 +259,9 @@ protected:
 	void ComputeDualVariables( Real_T penalty );
 	void ComputeSplitDualVariables( void );
 	void ComputeResult( void );
-	void ComputeReducedCosts( void );
-	void ComputeReducedCosts( Int_T Start );
-	void ResetWeights( void );
+	void ComputeReducedCosts( Bool_T Reset = True );
+	void ComputeReducedCosts( Int_T Start, Bool_T Reset = True );
+	void ResetWeights( Int_T Start = 0 );
 	Real_T MinimumPenaltyToMove( const Bool_T DependsOnArtif );
 	Real_T MinimumPenaltyToStayBounded( Int_T j, const Bool_T DependsOnArtif );
 	Bool_T VerifyUnboundedness( Int_T j );
@@ -339,6 +347,7 @@ public:
 
 	Solution * GetSolution( int mask, Bool_T LP_Valid = True );
 
+	void GetBasisStatus( Array<Int_T> &Cols, Array<Int_T> &Rows );
 	void OutputBasisToFile( FILE *fp );
 };
 
@@ -112,6 +112,7 @@ Solver::Solver( SimplexLP &l, const Spc &spc )
 //	H( LP.GetM() ),
 
 	DEGEN_CNT( 100 ), CYCLE_CNT( 5000 ), Pricing( PRS_RC ),
+	KeepWeights( False ),
 
 	Initialized( False ),
 
@@ -183,6 +184,7 @@ void Solver::SetSpc( const Spc &spc )
 	LENGTH_FACTOR		= spc.LENGTH_FACTOR;
 
 	Pricing				= spc.Pricing;
+	KeepWeights			= spc.KeepWeights;
 }
 
 
@@ -996,7 +996,7 @@ Bool_T Solver::PeriodicalResidCheck( SOLVER_ERROR &ErrorCode, // )
 	SOLVE_RESULT Solver::RestartAndSolve( VerbLevel Verbosity,
 		Long_T IterLimit, Bool_T ComputeDuals )
 	SOLVE_RESULT Solver::RestartAndSolve( VerbLevel Verbosity,
-		const SolverStateDump *dump, Long_T IterLimit )
+		const SolverStateDump *dump, Long_T IterLimit, Bool_T ComputePrimal )
 
 PURPOSE:
 	x
@@ -1041,17 +1041,20 @@ SOLVE_RESULT Solver::RestartAndSolve( VerbLevel Verbosity, Long_T IterLimit, //)
 	//	artificial columns. After that we may compute the objective function.
 	//
 	//	Initialize data for steepest edge pricing: weights 'gamma' and reduced
-	//	cost vector 'z'.
+	//	cost vector 'z'. The basis is the one the solver stopped at (or the one
+	//	restored from a dump), so - if so configured - the weights are kept.
+	//	Only the artificial columns, which are created anew, get reference
+	//	weights.
 	//
 	MakeSolutionFeasible( FEASIBILITY_TOL, Verbosity, False );
 	ComputeResult();
 	if( ComputeDuals )
 	{
 		ComputeDualVariables();
-		ComputeReducedCosts();
+		ComputeReducedCosts( Bool_T( !KeepWeights ) );
 	}
 	else
-		ComputeReducedCosts( StructN );
+		ComputeReducedCosts( StructN, Bool_T( !KeepWeights ) );
 
 	//
 	//	Now we have a feasible starting solution. All solver data is properly
@@ -1062,7 +1065,7 @@ SOLVE_RESULT Solver::RestartAndSolve( VerbLevel Verbosity, Long_T IterLimit, //)
 
 
 SOLVE_RESULT Solver::RestartAndSolve( VerbLevel Verbosity, // )
-	const SolverStateDump *dump, Long_T IterLimit )
+	const SolverStateDump *dump, Long_T IterLimit, Bool_T ComputePrimal )
 {
 	assert( dump != NULL );
 
@@ -1072,6 +1075,18 @@ SOLVE_RESULT Solver::RestartAndSolve( VerbLevel Verbosity, // )
 	x.Copy( dump->X, AllocN, AllocN );
 	A2B.Copy( dump->A2B, AllocN, AllocN );
 
+	//--------------------------------------------------------------------------
+	//	The steepest edge weights of the current basis are of no use for the
+	//	restored one. Take the ones stored with the dump or reset them.
+	//
+	if( dump->HasWeights )
+		gamma.Copy( dump->Gamma, AllocN, AllocN );
+	else if( KeepWeights )
+	{
+		ResetWeights();
+		SE_ResetCnt++;
+	}
+
 	//--------------------------------------------------------------------------
 	//	Restore the B2A array. Factorize the basis.
 	//
@@ -1088,6 +1103,13 @@ SOLVE_RESULT Solver::RestartAndSolve( VerbLevel Verbosity, // )
 	assert( i == M );
 	UpdateBasis();
 
+	//--------------------------------------------------------------------------
+	//	The basic variables stored in the dump correspond to the right hand
+	//	side for which the dump was made. If requested, recompute them for the
+	//	current right hand side.
+	//
+	if( ComputePrimal ) ComputePrimalVariables();
+
 	//--------------------------------------------------------------------------
 	//	We have restored a solution stored in the "dump" structure. Now we
 	//	can run the solver.
@@ -286,8 +286,8 @@ void Solver::ComputeResult( void )
 
 /*------------------------------------------------------------------------------
 
-	void Solver::ComputeReducedCosts( void )
-	void Solver::ComputeReducedCosts( Int_T Start )
+	void Solver::ComputeReducedCosts( Bool_T Reset )
+	void Solver::ComputeReducedCosts( Int_T Start, Bool_T Reset )
 
 PURPOSE:
 	Assuming that the dual variables ('y') are already computed, we compute in
@@ -305,6 +305,12 @@ PARAMETERS:
 	Int_T Start
 		The starting column for RC calculation.
 
+	Bool_T Reset
+		If 'True' (default), the steepest edge weights are reset as well.
+		Callers pass 'False' when the basis has not changed since the weights
+		were computed (restarts, penalty adjustments, optimality checks). Then
+		only the weights of the artificial columns are reset.
+
 RETURN VALUE:
 	None.
 
@@ -313,7 +319,7 @@ SIDE EFFECTS:
 
 ------------------------------------------------------------------------------*/
 
-void Solver::ComputeReducedCosts( void )
+void Solver::ComputeReducedCosts( Bool_T Reset )
 {
 	Ptr<Real_T> a;
 	Ptr<Int_T> col;
@@ -341,13 +347,17 @@ void Solver::ComputeReducedCosts( void )
 		if( IsZero( z[i] ) )
 			z[i] = 0.0;
 
-	ResetWeights();
-
-	SE_ResetCnt++;
+	if( Reset )
+	{
+		ResetWeights();
+		SE_ResetCnt++;
+	}
+	else
+		ResetWeights( Int_T( LP.GetStructN() + LP.GetSlackN() ) );
 }
 
 
-void Solver::ComputeReducedCosts( Int_T Start )
+void Solver::ComputeReducedCosts( Int_T Start, Bool_T Reset )
 {
 	Ptr<Real_T> A;
 	Ptr<Int_T> Row;
@@ -362,21 +372,26 @@ void Solver::ComputeReducedCosts( Int_T Start )
 		z[j] = ( IsNonZero( rc ) ) ? rc : 0.0;
 	}
 
-	ResetWeights();
-
-	SE_ResetCnt++;
+	if( Reset )
+	{
+		ResetWeights();
+		SE_ResetCnt++;
+	}
+	else
+		ResetWeights( Int_T( LP.GetStructN() + LP.GetSlackN() ) );
 }
 
 
 /*------------------------------------------------------------------------------
 
-	void Solver::ResetWeights( void )
+	void Solver::ResetWeights( Int_T Start )
 
 PURPOSE:
 	Reset steepest edge or approximate steepest edge weights.
 
 PARAMETERS:
-	None.
+	Int_T Start
+		Only the weights of columns 'Start' and up are reset (default: all).
 
 RETURN VALUE:
 	None.
@@ -386,7 +401,7 @@ SIDE EFFECTS:
 
 ------------------------------------------------------------------------------*/
 
-void Solver::ResetWeights( void )
+void Solver::ResetWeights( Int_T Start )
 {
 	if( Pricing >= PRS_SE )
 	{
@@ -394,7 +409,7 @@ void Solver::ResetWeights( void )
 		Ptr<Int_T> row;
 		Int_T len;
 
-		for( Int_T j = 0; j < N; j++ )
+		for( Int_T j = Start; j < N; j++ )
 		{
 			LP.GetColumn( j, a, row, len );
 			gamma[j] = (double)len + 1.0;
@@ -65,6 +65,9 @@ USED MACROS AND THEIR MEANING:
 #ifndef __SOLVTOL_H__
 #	include "solvtol.h"
 #endif
+#ifndef __INVERSE_H__
+#	include "inverse.h"
+#endif
 
 
 /*------------------------------------------------------------------------------
@@ -205,15 +208,19 @@ Solution *Solver::GetSolution( int mode, Bool_T LP_Valid )
 
 /*------------------------------------------------------------------------------
 
-	void Solver::OutputBasisToFile( FILE *fp )
+	void Solver::GetBasisStatus( Array<Int_T> &Cols, Array<Int_T> &Rows )
 
 PURPOSE:
-	Generates a standard simplex basis (expressed in terms of basic rows and
-columns).
+	Expresses the current simplex basis in the standard form (in terms of basic
+rows and columns). Structural columns are described by their positions
+('A2B_BASIC', 'A2B_LO', 'A2B_UP' or 'A2B_IN'). Rows are described by the
+position of their slack (or artificial) variables, translated so that 'A2B_LO'
+and 'A2B_UP' denote a row activity on its lower and upper limit respectively.
 
 PARAMETERS:
-	FILE *fp
-		A stream to utput the basis file to.
+	Array<Int_T> &Cols, Array<Int_T> &Rows
+		On exit: the status of the structural columns (at least 'StructN'
+		entries) and of the rows (at least 'M' entries).
 
 RETURN VALUE:
 	None.
@@ -222,39 +229,11 @@ SIDE EFFECTS:
 	None.
 
 ------------------------------------------------------------------------------*/
-static void OutputSection( FILE *fp, Array<Int_T> &Pos, Int_T n,
-	const SortedArrayOfLabels &Labels );
 
-void Solver::OutputBasisToFile( FILE *fp )
+void Solver::GetBasisStatus( Array<Int_T> &Cols, Array<Int_T> &Rows )
 {
-	assert( fp != NULL );
-
-	//--------------------------------------------------------------------------
-	//	Output the basis file header if an optimal solution was found.
-	//
-	assert( Status >= SR_OPTIMUM );
-
-	if( Status != SR_OPTIMUM )
-	{
-		fprintf( fp, "BASIS         %-8s  ", LP.GetName() );
-
-		if( Status == SR_INFEASIBLE )
-			fprintf( fp, "INFEASIBLE\n" );
-		else if( Status == SR_UNBOUNDED )
-			fprintf( fp, "UNBOUNDED\n" );
-		else
-			fprintf( fp, "UNSOLVED\n" );
-
-		return;
-	}
-
-	//--------------------------------------------------------------------------
-	//	If necessary (i.e. if a solution was found) construct the basis.
-	//
 	Int_T StructN		= LP.GetStructN(),
 		i;
-	Array<Int_T> &Rows	= w1Ind;
-	WorkVector<Int_T> Cols( StructN );
 
 	//--------------------------------------------------------------------------
 	//	Find basic columns (a subset of the structural columns).
@@ -300,7 +279,7 @@ void Solver::OutputBasisToFile( FILE *fp )
 					break;
 
 				case A2B_IN:
-					Rows[i] = A2B[i];
+					Rows[i] = A2B_IN;
 					break;
 
 #ifndef NDEBUG
@@ -330,6 +309,62 @@ void Solver::OutputBasisToFile( FILE *fp )
 	assert( InBasis == M );
 #endif
 
+}
+
+
+/*------------------------------------------------------------------------------
+
+	void Solver::OutputBasisToFile( FILE *fp )
+
+PURPOSE:
+	Generates a standard simplex basis (expressed in terms of basic rows and
+columns).
+
+PARAMETERS:
+	FILE *fp
+		A stream to utput the basis file to.
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+static void OutputSection( FILE *fp, Array<Int_T> &Pos, Int_T n,
+	const SortedArrayOfLabels &Labels );
+
+void Solver::OutputBasisToFile( FILE *fp )
+{
+	assert( fp != NULL );
+
+	//--------------------------------------------------------------------------
+	//	Output the basis file header if an optimal solution was found.
+	//
+	assert( Status >= SR_OPTIMUM );
+
+	if( Status != SR_OPTIMUM )
+	{
+		fprintf( fp, "BASIS         %-8s  ", LP.GetName() );
+
+		if( Status == SR_INFEASIBLE )
+			fprintf( fp, "INFEASIBLE\n" );
+		else if( Status == SR_UNBOUNDED )
+			fprintf( fp, "UNBOUNDED\n" );
+		else
+			fprintf( fp, "UNSOLVED\n" );
+
+		return;
+	}
+
+	//--------------------------------------------------------------------------
+	//	If necessary (i.e. if a solution was found) construct the basis.
+	//
+	Int_T StructN = LP.GetStructN();
+	WorkVector<Int_T> Cols( StructN ), Rows( M );
+
+	GetBasisStatus( Cols, Rows );
+
 	//--------------------------------------------------------------------------
 	//	Output the optimal basis.
 	//
@@ -372,7 +407,7 @@ static void OutputSection( FILE *fp, Array<Int_T> &Pos, Int_T n, // )
 /*------------------------------------------------------------------------------
 
 	SolverStateDump::SolverStateDump( Int_T n, const Array<Int_T> &a2b,
-		const Array<Real_T> &x, Int_T AllocN )
+		const Array<Real_T> &x, Int_T AllocN, const Array<Real_T> *gamma )
 
 PURPOSE:
 	x
@@ -381,6 +416,9 @@ PARAMETERS:
 	int x
 	xxx
 
+	const Array<Real_T> *gamma
+		Steepest edge weights to be stored with the basis (or NULL).
+
 RETURN VALUE:
 	x
 
@@ -390,13 +428,16 @@ SIDE EFFECTS:
 ------------------------------------------------------------------------------*/
 
 SolverStateDump::SolverStateDump( Int_T n, const Array<Int_T> &a2b, // )
-	const Array<Real_T> &x, Int_T AllocN )
-	: N( n ), A2B( AllocN, -1 ), X( AllocN, 0.0 )
+	const Array<Real_T> &x, Int_T AllocN, const Array<Real_T> *gamma )
+	: N( n ), A2B( AllocN, -1 ), X( AllocN, 0.0 ),
+	Gamma( gamma ? AllocN : 0 ), HasWeights( gamma ? True : False )
 {
 	assert( n > 0 );
 
 	A2B.Copy( a2b, n, n );
 	X.Copy( x, n, n );
+	if( HasWeights )
+		Gamma.Copy( *gamma, AllocN, AllocN );
 }
 
 
@@ -423,12 +464,183 @@ SolverStateDump *Solver::GetSolverStateDump( void )
 {
 	assert( Initialized );
 
-	SolverStateDump *dump = new SolverStateDump( N, A2B, x, AllocN );
+	//--------------------------------------------------------------------------
+	//	The steepest edge weights are only stored if they are going to be
+	//	reused on restart.
+	//
+	SolverStateDump *dump = new SolverStateDump( N, A2B, x, AllocN,
+		( KeepWeights && Pricing >= PRS_SE ) ? &gamma : NULL );
 
 	if( dump == NULL ) FatalError( "Out of memory." );
 	return dump;
 }
 
+/*------------------------------------------------------------------------------
+
+	SolverStateDump *Solver::CreateSolverStateDump( const Array<Int_T> &Cols,
+		const Array<Int_T> &Rows )
+
+PURPOSE:
+	Builds a solver state (a basis and a basic solution) from a standard basis
+description (see "Solver::GetBasisStatus()"). This allows to start the solver
+from a basis found for a different (e.g. a larger) problem with the same row
+and column structure.
+	The columns marked as basic are pivoted one by one into the current basis
+(e.g. the one constructed by "InitializeSolver()"), each replacing a column
+which is not wanted in the basis. Columns linearly dependent on the ones already
+pivoted in are skipped, so the resulting basis is never singular. Non-basic
+variables are placed on their bounds (invalid positions, e.g. on an infinite
+bound, are corrected) and the basic variables are computed.
+
+PARAMETERS:
+	const Array<Int_T> &Cols, const Array<Int_T> &Rows
+		Status of structural columns and rows (as produced by
+		"Solver::GetBasisStatus()"). Any values other than 'A2B_BASIC',
+		'A2B_LO', 'A2B_UP' and 'A2B_IN' are treated as 'A2B_UNDEF' (i.e. the
+		default non-basic position is chosen).
+
+RETURN VALUE:
+	A pointer to a newly allocated solver state dump, or NULL if numerical
+difficulties were encountered. The caller is responsible for deleting the
+object.
+
+SIDE EFFECTS:
+	The solver basis and solution are overwritten. After a failure the solver
+has to be re-initialized.
+
+------------------------------------------------------------------------------*/
+
+static Int_T NonBasicPosition( Short_T vt, Int_T Pos );
+
+SolverStateDump *Solver::CreateSolverStateDump( const Array<Int_T> &Cols, // )
+	const Array<Int_T> &Rows )
+{
+	assert( Initialized );
+
+	Int_T StructN	= LP.GetStructN(),
+		SlackEnd	= Int_T( StructN + LP.GetSlackN() ),
+		i, j, p;
+	Ptr<Real_T> a;
+	Ptr<Int_T> row;
+	Int_T len;
+
+	//--------------------------------------------------------------------------
+	//	Translate the standard basis description into the (desired) positions
+	//	of the structural and slack columns. The row status is translated back
+	//	into the slack status (compare "Solver::GetBasisStatus()").
+	//
+	WorkVector<Int_T> Pos( SlackEnd );
+
+	for( j = 0; j < StructN; j++ )
+		Pos[j] = Cols[j];
+
+	for( ; j < SlackEnd; j++ )
+	{
+		LP.GetColumn( j, a, row, len );
+		assert( len == 1 );
+		i = *row;
+
+		if( Rows[i] == A2B_LO || Rows[i] == A2B_UP )
+		{
+			Bool_T AtLo = ( Rows[i] == A2B_LO ) ? True : False;
+
+			if( LP.GetRowType(i) & RT_LE ) AtLo = Bool_T( !AtLo );
+			Pos[j] = AtLo ? A2B_LO : A2B_UP;
+		}
+		else
+			Pos[j] = Rows[i];
+	}
+
+	//--------------------------------------------------------------------------
+	//	Pivot the wanted columns into the basis. Columns already in the basis
+	//	are locked in their positions.
+	//
+	WorkVector<Bool_T> Locked( M );
+
+	for( i = 0; i < M; i++ )
+	{
+		j = B2A[i];
+		Locked[i] = ( j < SlackEnd && Pos[j] == A2B_BASIC ) ? True : False;
+	}
+
+	for( j = 0; j < SlackEnd; j++ )
+	{
+		if( A2B[j] >= 0 || Pos[j] != A2B_BASIC ) continue;
+
+		//----------------------------------------------------------------------
+		//	Compute the direction vector. Choose the largest pivot among the
+		//	basic columns which may be replaced.
+		//
+		LP.GetColumn( j, a, row, w1Len );
+		for( i = 0; i < w1Len; i++, ++a, ++row )
+		{
+			w1[i]		= *a;
+			w1Ind[i]	= *row;
+		}
+		B->SparseFTRAN( w1, w1Ind, w1Len );
+
+		Real_T PivMax = PIVOT_TOL;
+
+		for( p = -1, i = 0; i < w1Len; i++ )
+			if( !Locked[ w1Ind[i] ] && fabs( w1[i] ) > PivMax )
+			{
+				PivMax	= fabs( w1[i] );
+				p		= w1Ind[i];
+			}
+
+		if( p < 0 ) continue;
+
+		//----------------------------------------------------------------------
+		//	Exchange the columns.
+		//
+		A2B[ B2A[p] ]	= A2B_UNDEF;
+		B2A[p]			= j;
+		A2B[j]			= p;
+		Locked[p]		= True;
+
+		if( UpdateBasis( p ) == SLV_UPDATE_FAILED ) return NULL;
+	}
+
+	//--------------------------------------------------------------------------
+	//	Place the non-basic variables on their bounds (the artificial variables
+	//	at zero). Factorize the basis and compute the basic variables.
+	//
+	x.Fill( 0.0, AllocN );
+	for( j = 0; j < N; j++ )
+		if( A2B[j] < 0 )
+		{
+			A2B[j] = ( j < SlackEnd ) ? NonBasicPosition( VarType[j], Pos[j] ) :
+				A2B_LO;
+
+			if( A2B[j] == A2B_UP )
+				x[j] = u[j];
+		}
+
+	UpdateCnt = 0;
+	if( !FactorizeBasis() ) return NULL;
+	ComputePrimalVariables();
+
+	//--------------------------------------------------------------------------
+	//	The weights were not updated while pivoting: store reference weights.
+	//
+	ResetWeights();
+
+	return GetSolverStateDump();
+}
+
+
+static Int_T NonBasicPosition( Short_T vt, Int_T Pos )
+{
+	if( Pos == A2B_UP && ( vt & VT_HAS_UP_BND ) && !( vt & VT_FX ) )
+		return A2B_UP;
+	else if( vt & ( VT_FX | VT_HAS_LO_BND ) )
+		return A2B_LO;
+	else if( vt & VT_HAS_UP_BND )
+		return A2B_UP;
+	else
+		return A2B_IN;
+}
+
 
 /*------------------------------------------------------------------------------
 
@@ -101,8 +101,12 @@ void Solver::InGoingColumnNumber( Int_T &q, VerbLevel Verbosity )
 		MakeSolutionFeasible( FEASIBILITY_TOL, Verbosity, False );
 	FixArtificialVariables();
 
+	//--------------------------------------------------------------------------
+	//	The basis has not changed, so the steepest edge weights (if so
+	//	configured) are kept here and below.
+	//
 	ComputeDualVariables();
-	ComputeReducedCosts();
+	ComputeReducedCosts( Bool_T( !KeepWeights ) );
 
 	if( FindColumnCandidates( q ) != SLV_OPTIMUM )
 		return;
@@ -141,7 +145,7 @@ void Solver::InGoingColumnNumber( Int_T &q, VerbLevel Verbosity )
 		LP.SetPenalty( 10.0 * MinM );
 		ComputeDualVariables( LP.GetPenalty() );
 
-		ComputeReducedCosts();
+		ComputeReducedCosts( Bool_T( !KeepWeights ) );
 		ComputeResult();
 		FindColumnCandidates( q );
 		assert( q >= 0 );
@@ -699,7 +703,7 @@ Bool_T Solver::VerifyUnboundedness( Int_T j )
 	LP.SetPenalty( 10.0 * MinM );
 	ComputeDualVariables();
 
-	ComputeReducedCosts();
+	ComputeReducedCosts( Bool_T( !KeepWeights ) );
 	ComputeResult();
 
 	return False;
@@ -19,7 +19,10 @@ DEPENDENCIES:		myalloc.h, std_tmpl.h, smartptr.h, stdtype.h, sort_lab.h
 --------------------------------------------------------------------------------
 
 SOURCE FILE CONTENTS:
-	x
+	Implementation of the "SortedArrayOfLabels" class. Labels are found by name
+using a hash index, which is updated on every "AddLabel()" call. Hence the
+look-ups are equally fast while a file is being read (labels unsorted) and
+afterwards (labels sorted).
 
 ------------------------------------------------------------------------------*/
 
@@ -45,6 +48,9 @@ SOURCE FILE CONTENTS:
 
 	template HTable * REALLOC( HTable *& Table, size_t Len );
 	template void FREE( HTable *& Table );
+
+	template int * MALLOC( int *& Table, size_t Len );
+	template void FREE( int *& Table );
 #endif
 //
 //------------------------------------------------------------------------------
@@ -65,7 +71,8 @@ HTable *SortedArrayOfLabels::hstart		= NULL,
 //
 
 SortedArrayOfLabels::SortedArrayOfLabels( size_t InitLen )
-	: Label( NULL ), h( NULL ), len( 0 ), maxlen( InitLen ), Status( EMPTY )
+	: Label( NULL ), h( NULL ), len( 0 ), maxlen( InitLen ), Status( EMPTY ),
+	HIndex( NULL ), HSize( 0 )
 {
 	MALLOC( Label, maxlen );
 
@@ -83,6 +90,9 @@ void SortedArrayOfLabels::DiscardLabels( void )
 	for( int i = 0; i < (int)len; i++ )
 		Label[i][0] = '\0';
 
+	for( int j = 0; j < (int)HSize; j++ )
+		HIndex[j] = -1;
+
 	len = 0;
 	Status = EMPTY;
 }
@@ -105,6 +115,56 @@ int SortedArrayOfLabels::CmpLabels( const void *lab1, const void *lab2 )
 }
 
 
+//------------------------------------------------------------------------------
+//
+//	Hash index maintenance.
+//
+//	The index is an open addressing table with linear probing. It is never
+//	more than half full. Labels are only added (never deleted) between the
+//	rebuilds, so among equal labels the one added first is always found first
+//	on the probe sequence.
+//
+
+unsigned long SortedArrayOfLabels::HashLabel( const char *lab )
+{
+	unsigned long hv = 2166136261UL;
+
+	for( unsigned k = 0; k < LAB_LEN && lab[k]; k++ )
+		hv = ( hv ^ (unsigned char) lab[k] ) * 16777619UL;
+
+	return hv ^ ( hv >> 15 );
+}
+
+
+void SortedArrayOfLabels::HashInsert( int i )
+{
+	assert( HSize > 0 && i >= 0 && i < (int)len );
+
+	size_t mask = HSize - 1,
+		j		= (size_t) HashLabel( Label[i] ) & mask;
+
+	while( HIndex[j] >= 0 )
+		j = ( j + 1 ) & mask;
+
+	HIndex[j] = i;
+}
+
+
+void SortedArrayOfLabels::RebuildHash( size_t MinSize )
+{
+	FREE( HIndex );
+
+	for( HSize = 64; HSize < MinSize; HSize *= 2 )
+		;
+	MALLOC( HIndex, HSize );
+
+	for( int j = 0; j < (int)HSize; j++ )
+		HIndex[j] = -1;
+	for( int i = 0; i < (int)len; i++ )
+		HashInsert( i );
+}
+
+
 //------------------------------------------------------------------------------
 //
 //	Data manipulation - storage, access, sorting.
@@ -129,6 +189,11 @@ int SortedArrayOfLabels::AddLabel( const char *lab )
 	Label[len][LAB_LEN]	= '\0';
 	len++;
 
+	if( 2 * len > HSize )
+		RebuildHash( 2 * Max( len, maxlen ) );
+	else
+		HashInsert( len - 1 );
+
 	return 0;
 }
 
@@ -195,41 +260,21 @@ const char *SortedArrayOfLabels::FindLabel( size_t i, LabelOrder lo )
 int SortedArrayOfLabels::FindLabel( const char *lab, int last_n )
 	const
 {
-	switch( Status )
-	{
-	case EMPTY:
-		break;
-
-	case FILLED:
-		{
-			for( int i = (last_n > 0) ? len - last_n : 0; i < (int)len; i++ )
-				if( strncmp( Label[i], lab, LAB_LEN ) == 0 )
-					return i;
-		}
-		break;
+	if( Status == EMPTY ) return -1;
 
-	case SORTED:
-		{
-			assert( h != NULL );
+	//--------------------------------------------------------------------------
+	//	Scan the probe sequence. Return the first (i.e. the lowest numbered)
+	//	matching label out of the last 'last_n' ones (out of all by default).
+	//
+	assert( HIndex != NULL );
 
-			HTable hEntry = { (char *) lab, 0 };
-
-#ifndef NDEBUG
-			hstart	= h;
-			hend	= h+len;
-			hentry	= &hEntry;
-#endif
-			HTable *item = (HTable *) bsearch( &hEntry, h, len, sizeof( HTable ),
-				SortedArrayOfLabels::CmpLabels );
+	int first		= (last_n > 0) ? len - last_n : 0;
+	size_t mask		= HSize - 1,
+		j			= (size_t) HashLabel( lab ) & mask;
 
-#ifndef NDEBUG
-			hstart	= NULL;
-			hend	= NULL;
-			hentry	= NULL;
-#endif
-			if( item ) return item->LNr;
-		}
-	}
+	for( int i; ( i = HIndex[j] ) >= 0; j = ( j + 1 ) & mask )
+		if( i >= first && strncmp( Label[i], lab, LAB_LEN ) == 0 )
+			return i;
 
 	return -1;
 }
@@ -271,6 +316,7 @@ int SortedArrayOfLabels::RemoveLabels( const Array<Bool_T> &Exclude )
 
 //	REALLOC( Label,	maxlen );
 	Status = FILLED;
+	RebuildHash( 2 * len );
 
 	return 0;
 }
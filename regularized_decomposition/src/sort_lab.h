@@ -19,7 +19,9 @@ DEPENDENCIES:		myalloc.h, std_tmpl.h, smartptr.h, stdtype.h,
 --------------------------------------------------------------------------------
 
 HEADER CONTENTS:
-	x
+	An array of labels, which may be sorted (for detecting duplicates and for
+ordered access) and which maintains a hash index (open addressing, linear
+probing) for finding labels by name in constant expected time.
 
 ------------------------------------------------------------------------------*/
 
@@ -61,6 +63,10 @@ private:
 	enum LabelStatus { EMPTY, FILLED, SORTED };
 
 	static int CmpLabels( const void *lab1, const void *lab2 );
+	static unsigned long HashLabel( const char *lab );
+
+	void HashInsert( int i );
+	void RebuildHash( size_t MinSize );
 
 private:
 	charLEN *Label;
@@ -68,6 +74,9 @@ private:
 	size_t len, maxlen;
 	LabelStatus Status;
 
+	int *HIndex;		// Hash index: label numbers or -1 for an empty slot.
+	size_t HSize;		// Size of the hash index (a power of 2, or 0).
+
 #ifndef NDEBUG
 	static HTable *hstart, *hend, *hentry;
 #endif
@@ -123,6 +132,7 @@ SortedArrayOfLabels::~SortedArrayOfLabels( void )
 {
 	FREE( Label );
 	FREE( h );
+	FREE( HIndex );
 }
 
 
@@ -131,8 +141,9 @@ void SortedArrayOfLabels::FreeMemory( void )
 {
 	FREE( Label );
 	FREE( h );
+	FREE( HIndex );
 	
-	maxlen = len = 0;
+	maxlen = len = HSize = 0;
 	Status = EMPTY;
 }
 
@@ -15,7 +15,7 @@ CREATED:			1994.12.10
 LAST MODIFIED:		1996.10.07
 
 DEPENDENCIES:		sub_man.h, rd_sublp.h, smplx_lp.h, solv_lp.h, mps_lp.h,
-					scenario.h, stdtype.h, smartptr.h, print.h
+					scenario.h, stdtype.h, smartptr.h, print.h, run_stat.h
 					<assert.h>
 
 --------------------------------------------------------------------------------
@@ -39,6 +39,9 @@ SOURCE FILE CONTENTS:
 #ifndef __SMPLX_LP_H__
 #	include "smplx_lp.h"
 #endif
+#ifndef __RUN_STAT_H__
+#	include "run_stat.h"
+#endif
 
 
 
@@ -103,6 +106,7 @@ RD_SubproblemManager::RD_SubproblemManager( const SolvableLP &A, // )
 	//	The scenarios.
 	//
 	Scen( NULL ), NumberOfScenarios( -1 ), SolverState(),
+	CrashCols(), CrashRows(), UseCrashBasis( False ), CrashState( NULL ),
 
 	//
 	//	Other data.
@@ -123,6 +127,12 @@ RD_SubproblemManager::~RD_SubproblemManager( void )
 			delete SolverState[i];
 			SolverState[i] = NULL;
 		}
+
+	if( CrashState != NULL )
+	{
+		delete CrashState;
+		CrashState = NULL;
+	}
 }
 
 
@@ -160,6 +170,58 @@ void RD_SubproblemManager::SetScenarios( const Scenarios &sc )
 }
 
 
+/*------------------------------------------------------------------------------
+
+	void RD_SubproblemManager::SetCrashBasis( const Array<Int_T> &Cols,
+		const Array<Int_T> &Rows )
+
+PURPOSE:
+	Stores a standard basis (status of the second stage columns and rows) found
+by solving the crash LP. On the first subproblem solution the basis is turned
+into a solver state, which is then used to start every subproblem that has no
+solver state of its own (i.e. on the first sweep through a batch of scenarios).
+If the basis cannot be used (it is empty or numerical difficulties occur), the
+subproblems are solved from scratch, as usual.
+
+PARAMETERS:
+	const Array<Int_T> &Cols, const Array<Int_T> &Rows
+		Status of the subproblem's structural columns and rows (see
+		"Solver::GetBasisStatus()").
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void RD_SubproblemManager::SetCrashBasis( const Array<Int_T> &Cols, // )
+	const Array<Int_T> &Rows )
+{
+	assert( ObjectState == INITIALIZED || ObjectState == READY );
+
+	Int_T n = SubproblemLP.GetStructN(),
+		m = SubproblemLP.GetM(),
+		i;
+
+	CrashCols.Resize( n );
+	CrashCols.Copy( Cols, n, n );
+	CrashRows.Resize( m );
+	CrashRows.Copy( Rows, m, m );
+
+	//--------------------------------------------------------------------------
+	//	A basis with no basic columns in the second stage carries no
+	//	information (the solver would start from its own initial basis anyway).
+	//
+	UseCrashBasis = False;
+	for( i = 0; i < n && !UseCrashBasis; i++ )
+		if( CrashCols[i] == A2B_BASIC ) UseCrashBasis = True;
+	for( i = 0; i < m && !UseCrashBasis; i++ )
+		if( CrashRows[i] == A2B_BASIC ) UseCrashBasis = True;
+}
+
+
 /*------------------------------------------------------------------------------
 
 	Bool_T RD_SubproblemManager::SolveSubproblem( Int_T block, Int_T yn,
@@ -273,16 +335,39 @@ Bool_T RD_SubproblemManager::SolveSubproblem( Int_T block, Int_T yn, // )
 
 		if( !SubproblemSolver.InitializeSolver( V_NONE ) )
 			FatalError( "Unable to solve the first subproblem." );
-		sr = SubproblemSolver.Solve( V_NONE );
+
+		//----------------------------------------------------------------------
+		//	Build the solver state from the crash basis (only once). Should
+		//	this fail, re-initialize the solver and forget the crash basis.
+		//
+		if( UseCrashBasis && CrashState == NULL )
+		{
+			CrashState = SubproblemSolver.CreateSolverStateDump( CrashCols,
+				CrashRows );
+
+			if( CrashState == NULL )
+			{
+				if( Verbosity >= V_LOW )
+					Print( "\tCrash basis rejected.\n" );
+				UseCrashBasis = False;
+
+				if( !SubproblemSolver.InitializeSolver( V_NONE ) )
+					FatalError( "Unable to solve the first subproblem." );
+			}
+		}
+
+		sr = ( CrashState != NULL ) ?
+			SubproblemSolver.RestartAndSolve( V_NONE, CrashState, -1, True ) :
+			SubproblemSolver.Solve( V_NONE );
 	}
 	//
 	//	If the scenario has been changed, we solve the node at the root of the
 	//	tree. We restart from the solution of the same node for the previous
-	//	scenario.
+	//	scenario. (When the root has zero weight, the sweep starts further on
+	//	and restarts as in the middle of the bunch; see "SolveBlocks()".)
 	//
-	else if( PreviousBlockNumber == CALL_AFTER_Y_CHANGED )
+	else if( PreviousBlockNumber == CALL_AFTER_Y_CHANGED && block == 0 )
 	{
-		assert( block == 0 );
 		assert( Restart == RANDOM || SolverState[0] != NULL );
 
 		sr = ( Restart == SELF || Restart == TREE ) ?
@@ -297,9 +382,14 @@ Bool_T RD_SubproblemManager::SolveSubproblem( Int_T block, Int_T yn, // )
 		switch( Restart )
 		{
 		case SELF:
-			sr = ( SolverState[block] != NULL ) ?
-				SubproblemSolver.RestartAndSolve( V_NONE, SolverState[block] ) :
-				SubproblemSolver.RestartAndSolve( V_NONE, -1, True );
+			if( SolverState[block] != NULL )
+				sr = SubproblemSolver.RestartAndSolve( V_NONE,
+					SolverState[block] );
+			else if( CrashState != NULL )
+				sr = SubproblemSolver.RestartAndSolve( V_NONE, CrashState, -1,
+					True );
+			else
+				sr = SubproblemSolver.RestartAndSolve( V_NONE, -1, True );
 			break;
 
 		case RANDOM:
@@ -340,6 +430,9 @@ Bool_T RD_SubproblemManager::SolveSubproblem( Int_T block, Int_T yn, // )
 
 	SubsSolved++;
 	TotalIterCnt += SubproblemSolver.GetNumberOfIterations();
+	if( sr == SR_OPTIMUM || sr == SR_INFEASIBLE )
+		RunStat.Subproblem( block, SubproblemSolver.GetNumberOfIterations(),
+			( sr == SR_OPTIMUM ) ? True : False );
 
 	switch( sr )
 	{
@@ -424,3 +517,40 @@ void RD_SubproblemManager::ReSizeSolverState ( int nos, int InitScen )
 }
 
 //@END--------------------------------------------------------------------------
+
+
+/*------------------------------------------------------------------------------
+
+	void RD_SubproblemManager::AppendScenarios( Int_T nos )
+
+PURPOSE:
+	Informs the subproblem manager that the scenario repository has grown to
+"nos" scenarios (by "Scenarios::AppendScenario()"). The solver states of the
+existing scenarios are kept, the new scenarios get none (they are restarted
+from the crash basis or the last subproblem solved). The next subproblem
+solved recomputes the right hand side "T*y".
+
+PARAMETERS:
+	Int_T nos
+		The new number of scenarios (not less than the current one).
+
+RETURN VALUE:
+	None.
+
+SIDE EFFECTS:
+	None.
+
+------------------------------------------------------------------------------*/
+
+void RD_SubproblemManager::AppendScenarios( Int_T nos )
+{
+	assert( nos >= NumberOfScenarios );
+	assert( Scen != NULL && Scen->GetNumberOfScenarios() == nos );
+	assert( Restart != TREE );
+
+	ReSizeSolverState( nos, NumberOfScenarios );
+	NumberOfScenarios = nos;
+
+	if( PreviousBlockNumber != FIRST_CALL )
+		PreviousBlockNumber = CALL_AFTER_APPEND;
+}
@@ -82,11 +82,19 @@ private:
 									// subproblem. The solver states are stored
 									// here.
 
+	Array<Int_T> CrashCols, CrashRows;
+									// Standard basis (status of columns and
+									// rows) passed from the crash LP solution.
+	Bool_T UseCrashBasis;
+	SolverStateDump *CrashState;	// Solver state built of the crash basis.
+									// Used for every subproblem which has no
+									// solver state of its own.
+
 	//--------------------------------------------------------------------------
 	//	Other data.
 	//
 	enum ObjState { EMPTY, INITIALIZED, READY, IN_SOLUTION } ObjectState;
-	enum { FIRST_CALL = -2, CALL_AFTER_Y_CHANGED = -1 };
+	enum { CALL_AFTER_APPEND = -3, FIRST_CALL = -2, CALL_AFTER_Y_CHANGED = -1 };
 
 	Int_T PreviousBlockNumber;
 
@@ -105,6 +113,7 @@ public:
 
 	void SetScenarios( const Scenarios &sc );
 	void SetVerbosity( VerbLevel v );
+	void SetCrashBasis( const Array<Int_T> &Cols, const Array<Int_T> &Rows );
 
 	Bool_T SolveSubproblem( Int_T block, Int_T yn, const Real_T *y, Real_T &val,
     	Real_T *grad );
@@ -115,6 +124,7 @@ public:
 	void SetNumOfScenarios( int s ); 
 	void ChangePreviousBlockNumber ( int pbn );
 	void ReSizeSolverState ( int nos, int InitScen );
+	void AppendScenarios( Int_T nos );
 
 	void SetObjState ( void ); 
 	//@END------------------------------------------
@@ -24,6 +24,7 @@ MODULE FUNCTIONS:
 		TimeInfo::TimeInfo()
 		TimeInfo::MarkTime()
 		TimeInfo::TimeDifference()
+		TimeInfo::WallTimeDifference()
 
 --------------------------------------------------------------------------------
 
@@ -33,6 +34,8 @@ MODULE PURPOSE:
 	current time (in clock ticks) in one of the fields of the TimeInfo class
 	object. 'TimeDifference' computes the time between two events (stored
 	in fields of class object) and returns result in seconds.
+	'WallTimeDifference' does the same for the wall clock time (which is
+	stored by 'MarkTime' as well).
 
 	The module is compiled only when TIMER_ON macro is declared.
 
@@ -46,6 +49,10 @@ MODULE PURPOSE:
 #endif
 
 
+#if defined( unix ) || defined( __unix ) || defined( __unix__ )
+#	include <sys/time.h>
+#endif
+
 #if defined( solaris ) && defined( gnucc )
 	extern "C"
 	{
@@ -94,7 +101,9 @@ MODULE PURPOSE:
 //		events as an argument. The number of events has to be positive.
 //
 TimeInfo::TimeInfo( size_t NumberOfEvents )
-	: Mark( NumberOfEvents > 0 ? NumberOfEvents : 1 ), Events( NumberOfEvents )
+	: Mark( NumberOfEvents > 0 ? NumberOfEvents : 1 ),
+	Wall( NumberOfEvents > 0 ? NumberOfEvents : 1, 0.0 ),
+	Events( NumberOfEvents )
 {
 	assert( Events > 1 );
 }
@@ -122,6 +131,15 @@ void TimeInfo::MarkTime( int WhatTime )
 
 	//@END-------------
 #endif
+
+#if defined( unix ) || defined( __unix ) || defined( __unix__ )
+	struct timeval tv;
+
+	gettimeofday( &tv, NULL );
+	Wall[WhatTime] = (double) tv.tv_sec + 1.0e-6 * (double) tv.tv_usec;
+#else
+	Wall[WhatTime] = (double) time( NULL );
+#endif
 }
 
 
@@ -155,3 +173,16 @@ double TimeInfo::TimeDifference( int From, int To )
 	//@END------------
 #endif
 }
+
+
+//------------------------------------------------------------------------------
+//
+//	TimeInfo::WallTimeDifference
+//		Same as 'TimeDifference', but for the wall clock time.
+//
+double TimeInfo::WallTimeDifference( int From, int To )
+{
+	assert( From >= 0 && From < (int)Events && To > From && To < (int)Events );
+
+	return Wall[To] - Wall[From];
+}
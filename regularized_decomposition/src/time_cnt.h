@@ -26,6 +26,9 @@
 		System V time measuring functions (namely "times()") are to be used.
 		The "time_cnt.cc" module defines functions needed for measuring 
 		performance of simplex algorithm.
+		Along with the processor time the wall clock time of each event is
+		stored. The two differ when some of the work is done by another
+		process (see "StartStochReader()" in "probcach.cpp").
 
 ------------------------------------------------------------------------------*/
 #ifndef __TIME_CNT_H__
@@ -67,6 +70,8 @@ class TimeInfo
 #endif
 	Mark;
 
+	Array<double> Wall;			// Wall clock times (in seconds).
+
 	size_t Events;
 
 public:
@@ -74,6 +79,7 @@ public:
 
 	void MarkTime( int WhatTime );
 	double TimeDifference( int From, int To );
+	double WallTimeDifference( int From, int To );
 };
 
 #endif
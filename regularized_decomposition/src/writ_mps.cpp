@@ -13,7 +13,7 @@ SOURCE FILE NAME:	writ_mps.cpp
 CREATED:			1993.09.27
 LAST MODIFIED:		1996.04.16
 
-DEPENDENCIES:		compile.h, mps_lp.h, lp_codes.h, print.h,
+DEPENDENCIES:		compile.h, mps_lp.h, lp_codes.h, print.h, mps_out.h,
 					simplex.h, solv_lp.h, std_math.h, sort_lab.h
 					<stdio.h>, <math.h>, <assert.h>
 
@@ -59,6 +59,9 @@ STATIC DATA:
 #ifndef __SIMPLEX_H__
 #	include "simplex.h"
 #endif
+#ifndef __MPS_OUT_H__
+#	include "mps_out.h"
+#endif
 
 
 /*------------------------------------------------------------------------------
@@ -103,72 +106,66 @@ Bool_T MPS_LP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 {
 	Int_T i;
 	Int_T cs, ce;
-	char c = '\0';
+	const char *c = NULL;
 	Bool_T RHS_Present, RangesPresent, BoundsPresent;
 
 	assert( MPS_File != NULL && OS == OS_FULL );
 
+	MPS_Output Out( MPS_File );
+
 	//--------------------------------------------------------------------------
 	//	NAME line.
 	//
 	if( Verbosity >= V_HIGH )
 		Print( "\nWriting output file.\n" );
-	if( fprintf( MPS_File, "%-14s%-8s\n", "NAME", Name ) == EOF )
-		goto error;
+	Out.Printf( "%-14s%-8s\n", "NAME", Name );
 
 	//--------------------------------------------------------------------------
 	//	ROWS section.
 	//
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting ROWS\n" );
-	if( fprintf( MPS_File, "%s\n", "ROWS" ) == EOF )
-		goto error;
+	Out.Text( "ROWS\n" );
 	for( i = 0; i < m; i++ )
 	{
 		switch( RowType[i] & RT_TYPE )
 		{
-		case RT_FR:	c = 'N'; break;
-		case RT_EQ:	c = 'E'; break;
-		case RT_GE:	c = 'G'; break;
-		case RT_LE:	c = 'L'; break;
+		case RT_FR:	c = " N  "; break;
+		case RT_EQ:	c = " E  "; break;
+		case RT_GE:	c = " G  "; break;
+		case RT_LE:	c = " L  "; break;
 		default:	abort();
 		}
-		if( fprintf( MPS_File, " %c  %-8s\n", c,
-			RowLabels.FindLabel( i ) ) == EOF )
-			goto error;
+		Out.Text( c );
+		Out.Field( RowLabels.FindLabel( i ) );
+		Out.NewLine();
 	}
 
 	//--------------------------------------------------------------------------
-	//	COLUMNS section.
+	//	COLUMNS section (two entries per line).
 	//
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting COLUMNS\n" );
-	if( fprintf( MPS_File, "%s\n", "COLUMNS" ) == EOF )
-		goto error;
+	Out.Text( "COLUMNS\n" );
 	for( i = 0; i < n; i++ )
 	{
+		const char *clab = ColLabels.FindLabel( i );
+
 		cs = ColStart[i];
 		ce = ColStart[i+1];
 
 		for( register Int_T j = cs; j < ce; j++ )
-		{
-			if( fprintf( MPS_File, "    %-8s  %-8s  %12G",
-				ColLabels.FindLabel( i ),
-				RowLabels.FindLabel( Row[ (size_t) j ] ),
-				ac[ (size_t) j ] ) == EOF )
-				goto error;
 			if( j != ce - 1 )
 			{
+				Out.Entry( "    ", clab,
+					RowLabels.FindLabel( Row[ (size_t) j ] ), ac[ (size_t) j ],
+					RowLabels.FindLabel( Row[ (size_t) j + 1 ] ),
+					ac[ (size_t) j + 1 ] );
 				j++;
-				if( fprintf( MPS_File, "   %-8s  %12G",
-					RowLabels.FindLabel( Row[ (size_t) j ] ),
-					ac[ (size_t) j ] )
-					== EOF )
-					goto error;
 			}
-			if( fprintf( MPS_File, "\n" ) == EOF )
-				goto error;
-		}
+			else
+				Out.Entry( "    ", clab,
+					RowLabels.FindLabel( Row[ (size_t) j ] ), ac[ (size_t) j ] );
 	}
 
 	//--------------------------------------------------------------------------
@@ -177,20 +174,16 @@ Bool_T MPS_LP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 	RHS_Present = False;
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting RHS\n" );
-	if( fprintf( MPS_File, "%s\n", "RHS" ) == EOF )
-		goto error;
+	Out.Text( "RHS\n" );
 	for( i = 0; i < m; i++ )
 		if( IsNonZero( b[i] ) && !( RowType[i] & RT_FR ) )
 		{
-			if( fprintf( MPS_File, "    %-8s  %-8s  %12G\n",
-				RHS_Name, RowLabels.FindLabel( i ), b[i] ) == EOF )
-				goto error;
+			Out.Entry( "    ", RHS_Name, RowLabels.FindLabel( i ), b[i] );
 			RHS_Present = True;
 		}
 	if( !RHS_Present )
-		if( fprintf( MPS_File, "    %-8s  %-8s  %12G\n",
-			RHS_Name, RowLabels.FindLabel( 0, LO_UNSORTED ), 0.0 ) == EOF )
-			goto error;
+		Out.Entry( "    ", RHS_Name, RowLabels.FindLabel( 0, LO_UNSORTED ),
+			0.0 );
 
 	//--------------------------------------------------------------------------
 	//	RANGES section.
@@ -204,12 +197,9 @@ Bool_T MPS_LP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 				RangesPresent = True;
 				if( Verbosity >= V_HIGH )
 					Print( "\tWriting RANGES\n" );
-				if( fprintf( MPS_File, "%s\n", "RANGES" ) == EOF )
-					goto error;
+				Out.Text( "RANGES\n" );
 			}
-			if( fprintf( MPS_File, "    %-8s  %-8s  %12G\n",
-				RangesName, RowLabels.FindLabel( i ), r[i] ) == EOF )
-				goto error;
+			Out.Entry( "    ", RangesName, RowLabels.FindLabel( i ), r[i] );
 		}
 
 	//--------------------------------------------------------------------------
@@ -223,6 +213,8 @@ Bool_T MPS_LP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 			( VarType[i] & VT_LO && IsNonZero( l[i] ) ) ||
 			!( VarType[i] & ( VT_LO | VT_UP ) ) )
 		{
+			const char *lab = ColLabels.FindLabel( i );
+
 			//------------------------------------------------------------------
 			//	If it hasn't been done before - write BONDS section header.
 			//
@@ -231,41 +223,27 @@ Bool_T MPS_LP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 				BoundsPresent = True;
 				if( Verbosity >= V_HIGH )
 					Print( "\tWriting BOUNDS\n" );
-				if( fprintf( MPS_File, "%s\n", "BOUNDS" ) == EOF )
-					goto error;
+				Out.Text( "BOUNDS\n" );
 			}
 
 			//------------------------------------------------------------------
 			//	Detect FREE variables.
 			//
 			if( !( VarType[i] & ( VT_LO | VT_UP ) ) )
-			{
-				if( fprintf( MPS_File, " %2s %-8s  %-8s\n",
-					"FR", BoundsName, ColLabels.FindLabel( i ) ) == EOF )
-					goto error;
-			}
+				Out.Entry( " FR ", BoundsName, lab );
 			//------------------------------------------------------------------
 			//	Detect FIXED variables.
 			//
 			else if( VarType[i] == VT_FIXED )
-			{
-				if( fprintf( MPS_File, " %2s %-8s  %-8s  %12G\n",
-					"FX", BoundsName, ColLabels.FindLabel( i ), l[i] ) == EOF )
-					goto error;
-			}
+				Out.Entry( " FX ", BoundsName, lab, l[i] );
 			//------------------------------------------------------------------
 			//	Detect non-positive (MI) variables.
 			//
 			else if( ( VarType[i] & VT_UP ) && !( VarType[i] & VT_LO ) )
 			{
-				if( fprintf( MPS_File, " %2s %-8s  %-8s\n",
-					"MI", BoundsName, ColLabels.FindLabel( i ) ) == EOF )
-					goto error;
+				Out.Entry( " MI ", BoundsName, lab );
 				if( IsNonZero( u[i] ) )
-					if( fprintf( MPS_File, " %2s %-8s  %-8s  %12G\n",
-						"UP", BoundsName, ColLabels.FindLabel( i ), u[i] )
-						== EOF )
-						goto error;
+					Out.Entry( " UP ", BoundsName, lab, u[i] );
 			}
 			//------------------------------------------------------------------
 			//	For all other variables print out non-zero lower bounds and
@@ -274,16 +252,10 @@ Bool_T MPS_LP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 			else
 			{
 				if( VarType[i] & VT_LO && IsNonZero( l[i] )  )
-					if( fprintf( MPS_File, " %2s %-8s  %-8s  %12G\n",
-						"LO", BoundsName, ColLabels.FindLabel( i ), l[i] )
-						== EOF )
-						goto error;
+					Out.Entry( " LO ", BoundsName, lab, l[i] );
 
 				if( VarType[i] & VT_UP )
-					if( fprintf( MPS_File, " %2s %-8s  %-8s  %12G\n",
-						"UP", BoundsName, ColLabels.FindLabel( i ), u[i] )
-						== EOF )
-						goto error;
+					Out.Entry( " UP ", BoundsName, lab, u[i] );
 			}
 		}
 
@@ -292,15 +264,14 @@ Bool_T MPS_LP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 	//
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting ENDATA\n" );
-	if( fprintf( MPS_File, "%s\n", "ENDATA" ) == EOF )
-		goto error;
+	Out.Text( "ENDATA\n" );
+
+	if( !Out.Flush() )
+		return False;
 
 	if( Verbosity >= V_HIGH )
 		Print( "Finished writing.\n\n" );
 	return True;
-
-error:
-	return False;
 }
 
 
@@ -331,13 +302,14 @@ Bool_T SolvableLP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 
 	assert( MPS_File != NULL && OS == OS_FULL );
 
+	MPS_Output Out( MPS_File );
+
 	//--------------------------------------------------------------------------
 	//	NAME line.
 	//
 	if( Verbosity >= V_HIGH )
 		Print( "\nWriting output file.\n" );
-	if( fprintf( MPS_File, "%-14s%-8s\n", "NAME", Name ) == EOF )
-		goto error;
+	Out.Printf( "%-14s%-8s\n", "NAME", Name );
 
 	//--------------------------------------------------------------------------
 	//	ROWS section (finished by the objective vector name).
@@ -345,27 +317,27 @@ Bool_T SolvableLP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting ROWS\n" );
 
-	if( fprintf( MPS_File, "%s\n", "ROWS" ) == EOF )
-		goto error;
+	Out.Text( "ROWS\n" );
 
 	for( i = 0; i < m; i++ )
 	{
-		char C = '\0';
+		const char *C = NULL;
 
 		switch( RowType[i] & RT_TYPE )
 		{
-		case RT_EQ:	C = 'E'; break;
-		case RT_GE:	C = 'G'; break;
-		case RT_LE:	C = 'L'; break;
+		case RT_EQ:	C = " E  "; break;
+		case RT_GE:	C = " G  "; break;
+		case RT_LE:	C = " L  "; break;
 		default:	abort();
 		}
-		if( fprintf( MPS_File, " %c  %-8s\n", C, RowLabels.FindLabel( i ) )
-			== EOF )
-			goto error;
+		Out.Text( C );
+		Out.Field( RowLabels.FindLabel( i ) );
+		Out.NewLine();
 	}
 
-	if( fprintf( MPS_File, " N  %-8s\n", Obj ) == EOF )
-		goto error;
+	Out.Text( " N  " );
+	Out.Field( Obj );
+	Out.NewLine();
 
 	//--------------------------------------------------------------------------
 	//	COLUMNS section (each column followed by its cost coefficient).
@@ -374,38 +346,23 @@ Bool_T SolvableLP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting COLUMNS\n" );
 
-	if( fprintf( MPS_File, "%s\n", "COLUMNS" ) == EOF )
-		goto error;
+	Out.Text( "COLUMNS\n" );
 
 	for( j = 0; j < n; j++ )
 	{
-		Ptr<Real_T> a;
-		Ptr<Int_T> row;
-		Int_T len;
-		const char *clab = ColLabels.FindLabel( j );
-
-		for( MPS_LP::GetColumn( j, a, row, len ); len; --len, ++a, ++row )
-		{
-			if( fprintf( MPS_File, "    %-8s  %-8s  %12G",
-				clab, RowLabels.FindLabel( *row ), *a ) == EOF )
-				goto error;
+		const Real_T *a		= GetNonZerosByColumns() + ColStart[j];
+		const Int_T *row	= GetRowNumbers() + ColStart[j];
+		Int_T len			= ColStart[j+1] - ColStart[j];
+		const char *clab	= ColLabels.FindLabel( j );
 
-			if( len > 1 )
-			{
-				--len; ++a; ++row;
-				if( fprintf( MPS_File, "   %-8s  %12G",
-					RowLabels.FindLabel( *row ), *a ) == EOF )
-					goto error;
-			}
-
-			if( fprintf( MPS_File, "\n" ) == EOF )
-				goto error;
-		}
+		for( ; len > 1; len -= 2, a += 2, row += 2 )
+			Out.Entry( "    ", clab, RowLabels.FindLabel( row[0] ), a[0],
+				RowLabels.FindLabel( row[1] ), a[1] );
+		if( len )
+			Out.Entry( "    ", clab, RowLabels.FindLabel( *row ), *a );
 
 		if( IsNonZero( c[j] ) )
-			if( fprintf( MPS_File, "    %-8s  %-8s  %12G\n",
-				clab, Obj, c[j] ) == EOF )
-				goto error;
+			Out.Entry( "    ", clab, Obj, c[j] );
 	}
 
 	//--------------------------------------------------------------------------
@@ -416,21 +373,17 @@ Bool_T SolvableLP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting RHS\n" );
 
-	if( fprintf( MPS_File, "%s\n", "RHS" ) == EOF )
-		goto error;
+	Out.Text( "RHS\n" );
 
 	for( i = 0; i < m; i++ )
 		if( IsNonZero( b[i] ) )
 		{
-			if( fprintf( MPS_File, "    %-8s  %-8s  %12G\n",
-				RHS_Name, RowLabels.FindLabel( i ), b[i] ) == EOF )
-				goto error;
+			Out.Entry( "    ", RHS_Name, RowLabels.FindLabel( i ), b[i] );
 			RHS_Present = True;
 		}
 	if( !RHS_Present )
-		if( fprintf( MPS_File, "    %-8s  %-8s  %12G\n",
-			RHS_Name, RowLabels.FindLabel( 0, LO_UNSORTED ), 0.0 ) == EOF )
-			goto error;
+		Out.Entry( "    ", RHS_Name, RowLabels.FindLabel( 0, LO_UNSORTED ),
+			0.0 );
 
 	//--------------------------------------------------------------------------
 	//	RANGES section.
@@ -445,12 +398,9 @@ Bool_T SolvableLP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 				RangesPresent = True;
 				if( Verbosity >= V_HIGH )
 					Print( "\tWriting RANGES\n" );
-				if( fprintf( MPS_File, "%s\n", "RANGES" ) == EOF )
-					goto error;
+				Out.Text( "RANGES\n" );
 			}
-			if( fprintf( MPS_File, "    %-8s  %-8s  %12G\n",
-				RangesName, RowLabels.FindLabel( i ), r[i] ) == EOF )
-				goto error;
+			Out.Entry( "    ", RangesName, RowLabels.FindLabel( i ), r[i] );
 		}
 
 	//--------------------------------------------------------------------------
@@ -478,40 +428,27 @@ Bool_T SolvableLP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 				if( Verbosity >= V_HIGH )
 					Print( "\tWriting BOUNDS\n" );
 
-				if( fprintf( MPS_File, "%s\n", "BOUNDS" ) == EOF )
-					goto error;
+				Out.Text( "BOUNDS\n" );
 			}
 
 			//------------------------------------------------------------------
 			//	Detect FREE variables.
 			//
 			if( !( vt & ( VT_LO | VT_UP ) ) )
-			{
-				if( fprintf( MPS_File, " %2s %-8s  %-8s\n",
-					"FR", BoundsName, lab ) == EOF )
-					goto error;
-			}
+				Out.Entry( " FR ", BoundsName, lab );
 			//------------------------------------------------------------------
 			//	Detect FIXED variables.
 			//
 			else if( vt == VT_FIXED )
-			{
-				if( fprintf( MPS_File, " %2s %-8s  %-8s  %12G\n",
-					"FX", BoundsName, lab, l[j] ) == EOF )
-					goto error;
-			}
+				Out.Entry( " FX ", BoundsName, lab, l[j] );
 			//------------------------------------------------------------------
 			//	Detect non-positive (MI) variables.
 			//
 			else if( ( vt & VT_UP ) && !( vt & VT_LO ) )
 			{
-				if( fprintf( MPS_File, " %2s %-8s  %-8s\n",
-					"MI", BoundsName, lab ) == EOF )
-					goto error;
+				Out.Entry( " MI ", BoundsName, lab );
 				if( IsNonZero( u[j] ) )
-					if( fprintf( MPS_File, " %2s %-8s  %-8s  %12G\n",
-						"UP", BoundsName, lab, u[j] ) == EOF )
-						goto error;
+					Out.Entry( " UP ", BoundsName, lab, u[j] );
 			}
 			//------------------------------------------------------------------
 			//	For all other variables print out non-zero lower bounds and
@@ -520,14 +457,10 @@ Bool_T SolvableLP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 			else
 			{
 				if( vt & VT_LO && IsNonZero( l[j] ) )
-					if( fprintf( MPS_File, " %2s %-8s  %-8s  %12G\n",
-						"LO", BoundsName, lab, l[j] ) == EOF )
-						goto error;
+					Out.Entry( " LO ", BoundsName, lab, l[j] );
 
 				if( vt & VT_UP )
-					if( fprintf( MPS_File, " %2s %-8s  %-8s  %12G\n",
-						"UP", BoundsName, lab, u[j] ) == EOF )
-						goto error;
+					Out.Entry( " UP ", BoundsName, lab, u[j] );
 			}
 		}
 	}
@@ -538,13 +471,12 @@ Bool_T SolvableLP::WriteMPS( FILE *MPS_File, VerbLevel Verbosity )
 	if( Verbosity >= V_HIGH )
 		Print( "\tWriting ENDATA\n" );
 
-	if( fprintf( MPS_File, "%s\n", "ENDATA" ) == EOF )
-		goto error;
+	Out.Text( "ENDATA\n" );
+
+	if( !Out.Flush() )
+		return False;
 
 	if( Verbosity >= V_HIGH )
 		Print( "Finished writing.\n\n" );
 	return True;
-
-error:
-	return False;
 }
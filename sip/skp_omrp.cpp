@@ -2,6 +2,7 @@
 #include "sip_solver.h"
 #include "randomc.h"                   // define classes for random number generators
 #include "stocc.h"                     // define random library classes
+#include "obm_stat.h"
 
 #define DEBUG_DEMAND 0  // True to debug demand generation
 #define DEBUG_GAP    0  // True to debug gap-estimation 
@@ -158,8 +159,10 @@ int main( int argc, char** argv )
    //other arrays
 
    double *       gapest,              //gap estimate of single numCIs procedure in each replication
-          *       indivGaps;           //gap esimates for individual samples
-   int    *       indivCounts;
+                  candidateMean;       //average objective of xhat over a batch
+   OverlappingBatchMeans
+                  obm( batchSize, gamma, numBatches );
+                                       //gap esimates for individual samples
 
    // Variables for calculating MSE
 
@@ -200,16 +203,10 @@ int main( int argc, char** argv )
    StochasticLib1 sto( seed );            // make instance of random library
 
    gapest  = new double [totssize]; 
-   indivGaps = new double[sampleSize];
-   indivCounts = new int[sampleSize];
 
    for( repCounter = 0; repCounter < numCIs; repCounter++ )
    {
-      for( ii = 0; ii < sampleSize; ii++ )
-      {
-         indivGaps[ii] = 0.0;
-         indivCounts[ii] = 0;
-      }
+      obm.Clear();
       // Create sample for this confidence interval
       for( ii = 0; ii < SET; ii++ )
          for( int jj = 0; jj < sampleSize; jj++ )
@@ -221,25 +218,23 @@ int main( int argc, char** argv )
       { 
          // MODIFY -- Code doesn't work because gapest only accounts for xnstar, not xhat.
          Solve_SIP( batchSize, batchCounter*gamma, W, xnstar, gapest[(repCounter*numBatches)+batchCounter] );
-         gapest[(repCounter*numBatches)+batchCounter] -= f_bar_n( xhat, W, batchSize, batchCounter*gamma );
-         // Loop for calculating Gbar
-         for( gammaCounter = 0; gammaCounter < batchSize; gammaCounter++ )
-         {
-            indivGaps[batchCounter*gamma + gammaCounter] += f_scenario( xnstar, W, batchCounter*gamma + gammaCounter ) - f_scenario( xhat, W, batchCounter*gamma+ gammaCounter );
-            indivCounts[batchCounter*gamma + gammaCounter] += 1;
-         }
+         candidateMean = f_bar_n( xhat, W, batchSize, batchCounter*gamma );
+         gapest[(repCounter*numBatches)+batchCounter] -= candidateMean;
+         // Loop for calculating Gbar: only the scenarios near the ends of the
+         // sample need their own gaps, the batch mean accounts for the rest.
+         // (The mean is taken at xnstar: the value returned by Solve_SIP may
+         // differ from it slightly.)
+         obm.AddBatch( batchCounter, f_bar_n( xnstar, W, batchSize, batchCounter*gamma ) - candidateMean );
+         for( gammaCounter = 0; gammaCounter < obm.HeadPoints( batchCounter ); gammaCounter++ )
+            obm.AddPoint( batchCounter, gammaCounter, f_scenario( xnstar, W, batchCounter*gamma + gammaCounter ) - f_scenario( xhat, W, batchCounter*gamma+ gammaCounter ) );
+         for( gammaCounter = obm.TailStart( batchCounter ); gammaCounter < batchSize; gammaCounter++ )
+            obm.AddPoint( batchCounter, gammaCounter, f_scenario( xnstar, W, batchCounter*gamma + gammaCounter ) - f_scenario( xhat, W, batchCounter*gamma+ gammaCounter ) );
 
       }  //end of loop with batchCounter (numBatches) 
 
       // Divide by the "vertical" component to get the true gap estimate
       // and finish by averaging
-      gbar[repCounter] = 0.0;
-      for( ii = 0; ii < sampleSize; ii++ )
-      {
-         indivGaps[ii] /= indivCounts[ii];
-         gbar[repCounter] += indivGaps[ii];
-      }
-      gbar[repCounter] /= sampleSize;
+      gbar[repCounter] = obm.GetMean();
 
    }  //end of for loop with numCIs
 
@@ -306,8 +301,6 @@ int main( int argc, char** argv )
 
    //if (demand)  delete [] demand; 
    if (gapest)  delete [] gapest; 
-   if( indivGaps ) delete [] indivGaps; 
-   if( indivCounts ) delete [] indivCounts; 
 
    //demand  = NULL; 
    gapest  = NULL; 
@@ -441,21 +434,7 @@ int main( int argc, char** argv )
 
 double CalculateVariance ( const double* y1, double ybar1, int size, int currRep, int degreesFreedom )
 {
-   int ii; 
-   double sv1, sumsquare; 
-   
-   sumsquare = 0.0; 
-
-   for( ii = 0; ii < size; ii++ )
-   {
-      // Change currRed*size to reflect overlapping batches.  I think currRep*gamma + ii should do it.
-      sv1 = y1[(currRep*size)+ii] - ybar1; 
-      sumsquare += pow(sv1,2);
-   }
-
-   sumsquare *= ( 1.0 / (double) degreesFreedom);
-
-   return sumsquare;    
+   return OverlappingBatchMeans::Variance( y1 + currRep*size, size, ybar1, degreesFreedom );
 } // end of CalculateVariance 
 
 